@@ -0,0 +1,73 @@
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto TABLE_NAME = std::string{"commit_benchmark_table"};
+
+// Called by all benchmark threads, but creates the table only once (and again after the StorageManager was reset)
+void create_table_if_missing() {
+  static auto mutex = std::mutex{};
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (StorageManager::get().has_table(TABLE_NAME)) return;
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data,
+                                             Chunk::MAX_SIZE, UseMvcc::Yes);
+  // Insert appends to the last chunk
+  table->append_mutable_chunk();
+  StorageManager::get().add_table(TABLE_NAME, table);
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Measures the throughput of the commit pipeline, i.e., how many (empty) transactions per second can get a commit ID
+ * and be published, depending on the number of threads committing concurrently.
+ */
+static void BM_Commit(benchmark::State& state) {  // NOLINT
+  while (state.KeepRunning()) {
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    transaction_context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Commit)->ThreadRange(1, 64)->UseRealTime();
+
+/**
+ * Same as above, but every transaction inserts a row, so that the commit also has to write the row's MVCC columns
+ */
+static void BM_InsertAndCommit(benchmark::State& state) {  // NOLINT
+  create_table_if_missing();
+
+  const auto values = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data);
+  values->append({42});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  while (state.KeepRunning()) {
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    const auto insert = std::make_shared<Insert>(TABLE_NAME, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InsertAndCommit)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "cost_model/cost_feature_operator_proxy.hpp"
+#include "cost_model/cost_model_physical.hpp"
+#include "cxxopts.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_mpsm.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "table_generator.hpp"
+
+/**
+ * Calibrates the coefficients of the CostModelPhysical for the machine it runs on.
+ *
+ * For a grid of input sizes, each join implementation is executed on generated tables (the right one indexed, so that
+ * the JoinIndex can be measured as well). The weights of the CostFeatures that CostModelPhysical::default_coefficients()
+ * lists for an operator are then fitted to the measured walltimes using least squares on the relative error. The
+ * resulting coefficients are written as JSON and can be loaded with import_cost_model_coefficients().
+ */
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+struct Measurement {
+  std::vector<float> features;
+  float walltime;
+};
+
+const auto CALIBRATION_ROW_COUNTS = std::vector<size_t>{1'000, 10'000, 100'000, 1'000'000};
+constexpr auto CALIBRATION_CHUNK_SIZE = size_t{100'000};
+
+std::shared_ptr<TableWrapper> create_input(const size_t row_count, const size_t distinct_value_count,
+                                           const bool create_index) {
+  const auto column_data_distribution =
+      ColumnDataDistribution::make_uniform_config(0.0, static_cast<double>(distinct_value_count));
+  const auto table = TableGenerator{}.generate_table({column_data_distribution}, row_count,
+                                                     std::min(row_count, CALIBRATION_CHUNK_SIZE),
+                                                     EncodingType::Dictionary);
+  if (create_index) table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+std::shared_ptr<AbstractOperator> create_join(const OperatorType operator_type,
+                                              const std::shared_ptr<const AbstractOperator>& left,
+                                              const std::shared_ptr<const AbstractOperator>& right) {
+  const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+
+  switch (operator_type) {
+    case OperatorType::JoinHash:
+      return std::make_shared<JoinHash>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+    case OperatorType::JoinSortMerge:
+      return std::make_shared<JoinSortMerge>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+    case OperatorType::JoinIndex:
+      return std::make_shared<JoinIndex>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+    case OperatorType::JoinMPSM:
+      return std::make_shared<JoinMPSM>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+    default:
+      Fail("Unexpected OperatorType");
+  }
+}
+
+/**
+ * Minimizes the sum of squared relative errors, i.e., sum_i ((features_i * weights - walltime_i) / walltime_i)^2,
+ * by solving the normal equations. Without the normalization, the largest inputs would dominate the fit and the
+ * model would be useless for small joins.
+ * Returns std::nullopt if the system is singular.
+ */
+std::optional<std::vector<float>> fit_weights(const std::vector<Measurement>& measurements) {
+  if (measurements.empty()) return std::nullopt;
+
+  const auto feature_count = measurements.front().features.size();
+
+  // Augmented matrix [X^T X | X^T y]
+  auto matrix = std::vector<std::vector<double>>(feature_count, std::vector<double>(feature_count + 1, 0.0));
+
+  for (const auto& measurement : measurements) {
+    const auto scale = 1.0 / std::max(static_cast<double>(measurement.walltime), 1.0);
+    for (auto row = size_t{0}; row < feature_count; ++row) {
+      const auto x_row = measurement.features[row] * scale;
+      for (auto column = size_t{0}; column < feature_count; ++column) {
+        matrix[row][column] += x_row * measurement.features[column] * scale;
+      }
+      matrix[row][feature_count] += x_row * measurement.walltime * scale;
+    }
+  }
+
+  // Gaussian elimination with partial pivoting
+  for (auto pivot = size_t{0}; pivot < feature_count; ++pivot) {
+    auto max_row = pivot;
+    for (auto row = pivot + 1; row < feature_count; ++row) {
+      if (std::abs(matrix[row][pivot]) > std::abs(matrix[max_row][pivot])) max_row = row;
+    }
+    if (std::abs(matrix[max_row][pivot]) < 1e-12) return std::nullopt;
+    std::swap(matrix[pivot], matrix[max_row]);
+
+    for (auto row = size_t{0}; row < feature_count; ++row) {
+      if (row == pivot) continue;
+      const auto factor = matrix[row][pivot] / matrix[pivot][pivot];
+      for (auto column = pivot; column <= feature_count; ++column) {
+        matrix[row][column] -= factor * matrix[pivot][column];
+      }
+    }
+  }
+
+  auto weights = std::vector<float>(feature_count);
+  for (auto row = size_t{0}; row < feature_count; ++row) {
+    // Negative weights would make the model predict negative runtimes for some inputs. Clamping them is crude, but the
+    // features are chosen so that all of them should contribute positively anyway.
+    weights[row] = std::max(0.0f, static_cast<float>(matrix[row][feature_count] / matrix[row][row]));
+  }
+
+  return weights;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"Cost Model Calibration"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "print this help message")
+    ("o,output", "File to write the calibrated coefficients to", cxxopts::value<std::string>()->default_value("cost_model_coefficients.json")) // NOLINT
+    ("r,runs", "Number of runs per operator and input size", cxxopts::value<size_t>()->default_value("3")); // NOLINT
+  // clang-format on
+
+  const auto parse_result = cli_options.parse(argc, argv);
+  if (parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto output_path = parse_result["output"].as<std::string>();
+  const auto run_count = parse_result["runs"].as<size_t>();
+
+  auto coefficients = CostModelPhysical::default_coefficients();
+  const auto operator_types = std::vector<OperatorType>{OperatorType::JoinHash, OperatorType::JoinSortMerge,
+                                                        OperatorType::JoinIndex, OperatorType::JoinMPSM};
+
+  auto measurements = std::unordered_map<OperatorType, std::vector<Measurement>>{};
+
+  for (const auto left_row_count : CALIBRATION_ROW_COUNTS) {
+    for (const auto right_row_count : CALIBRATION_ROW_COUNTS) {
+      std::cout << "- Measuring " << left_row_count << " x " << right_row_count << " rows" << std::endl;
+
+      // Choose the value range so that every probing row finds about one match on the right side
+      const auto left = create_input(left_row_count, right_row_count, false);
+      const auto right = create_input(right_row_count, right_row_count, true);
+
+      for (const auto operator_type : operator_types) {
+        for (auto run = size_t{0}; run < run_count; ++run) {
+          const auto join = create_join(operator_type, left, right);
+          join->execute();
+
+          const auto feature_proxy = CostFeatureOperatorProxy{join};
+          auto measurement = Measurement{{}, static_cast<float>(join->performance_data().walltime.count())};
+          for (const auto& [cost_feature, weight] : coefficients.at(operator_type)) {
+            measurement.features.emplace_back(feature_proxy.extract_feature(cost_feature).scalar());
+          }
+          measurements[operator_type].emplace_back(std::move(measurement));
+        }
+      }
+    }
+  }
+
+  for (const auto operator_type : operator_types) {
+    const auto weights = fit_weights(measurements[operator_type]);
+    if (!weights) {
+      std::cout << "- Could not fit " << operator_type_to_string.left.at(operator_type)
+                << ", keeping the default coefficients" << std::endl;
+      continue;
+    }
+
+    // std::map iterates in the same order as during the measurement
+    auto weight_iter = weights->begin();
+    for (auto& [cost_feature, weight] : coefficients.at(operator_type)) {
+      weight = *weight_iter;
+      ++weight_iter;
+    }
+  }
+
+  export_cost_model_coefficients(coefficients, output_path);
+  std::cout << "- Wrote coefficients to '" << output_path << "'" << std::endl;
+
+  return 0;
+}
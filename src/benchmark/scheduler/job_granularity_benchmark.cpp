@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_granularity.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto ROW_COUNT = size_t{10'000'000};
+
+std::shared_ptr<Table> create_table(const size_t chunk_size) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data,
+                                       static_cast<uint32_t>(chunk_size));
+
+  for (auto chunk_begin = size_t{0}; chunk_begin < ROW_COUNT; chunk_begin += chunk_size) {
+    auto values = std::vector<int32_t>(std::min(chunk_size, ROW_COUNT - chunk_begin));
+    for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+      values[value_idx] = static_cast<int32_t>((chunk_begin + value_idx) % 1'000);
+    }
+    table->append_chunk({std::make_shared<ValueColumn<int32_t>>(values)});
+  }
+
+  return table;
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Scans a table of 10M rows with chunk sizes from 1k to 10M rows. With adaptive job granularity, the runtime should
+ * be roughly independent of the chunk size, except for the largest chunk sizes, where there are fewer chunks than
+ * workers (TableScan cannot split chunks).
+ */
+static void BM_TableScanByChunkSize(benchmark::State& state) {  // NOLINT
+  Topology::use_default_topology();
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto table_wrapper = std::make_shared<TableWrapper>(create_table(state.range(0)));
+  table_wrapper->execute();
+
+  while (state.KeepRunning()) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 10);
+    table_scan->execute();
+  }
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+BENCHMARK(BM_TableScanByChunkSize)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * Sums up a table of 10M rows in 1k-row chunks with a fixed number of rows per job, i.e., shows how many rows a job
+ * needs to process for the scheduling overhead to be negligible. Used to determine JobGranularity::MIN_ROWS_PER_JOB.
+ */
+static void BM_JobGranularityRowsPerJob(benchmark::State& state) {  // NOLINT
+  Topology::use_default_topology();
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto table = create_table(1'000);
+  const auto chunks = JobGranularity::chunks_of(*table);
+
+  while (state.KeepRunning()) {
+    const auto batches = JobGranularity::plan_jobs(chunks, SplitChunks::No, state.range(0));
+
+    auto sum = std::atomic<int64_t>{0};
+    JobGranularity::execute_jobs(batches.size(), [&](const size_t batch_idx) {
+      auto batch_sum = int64_t{0};
+      for (const auto& morsel : batches[batch_idx]) {
+        const auto& column =
+            static_cast<const ValueColumn<int32_t>&>(*table->get_chunk(morsel.chunk_id)->get_column(ColumnID{0}));
+        for (const auto value : column.values()) {
+          batch_sum += value;
+        }
+      }
+      sum += batch_sum;
+    });
+    benchmark::DoNotOptimize(sum.load());
+  }
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+BENCHMARK(BM_JobGranularityRowsPerJob)
+    ->RangeMultiplier(4)
+    ->Range(1'000, 4'096'000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "../benchmark_basic_fixture.hpp"
+#include "benchmark/benchmark.h"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+/**
+ * Measures the latency of single short queries that arrive at an otherwise idle scheduler, i.e., how long it takes
+ * for idle workers to pick up new tasks. Args are the time in ms the scheduler is idle before each query.
+ */
+BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_PointQueryLatencyOnIdleScheduler)(benchmark::State& state) {
+  Topology::use_default_topology();
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto idle_time = std::chrono::milliseconds(state.range(0));
+
+  while (state.KeepRunning()) {
+    // Give the workers time to run out of work and go idle
+    state.PauseTiming();
+    std::this_thread::sleep_for(idle_time);
+    state.ResumeTiming();
+
+    auto table_scan = std::make_shared<TableScan>(_table_wrapper_a, ColumnID{0}, PredicateCondition::Equals, 7);
+    const auto tasks = OperatorTask::make_tasks_from_operator(table_scan, CleanupTemporaries::Yes);
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  }
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_PointQueryLatencyOnIdleScheduler)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(20)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace opossum
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 
 #include <fstream>
@@ -7,6 +8,7 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
+#include "storage/base_value_column.hpp"
 #include "storage/table.hpp"
 #include "utils/filesystem.hpp"
 #include "utils/performance_warning.hpp"
@@ -271,7 +273,11 @@ EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encodin
     }
   }
 
-  return EncodingConfig{default_spec, std::move(type_encoding_mapping), std::move(custom_encoding_mapping)};
+  const auto auto_memory_weight =
+      encoding_config_json.value("auto_memory_weight", EncodingSelector::DEFAULT_MEMORY_WEIGHT);
+
+  return EncodingConfig{default_spec, std::move(type_encoding_mapping), std::move(custom_encoding_mapping),
+                        auto_memory_weight};
 }
 
 std::string CLIConfigParser::detailed_help(const cxxopts::Options& options) {
@@ -284,10 +290,11 @@ EncodingConfig::EncodingConfig(ColumnEncodingSpec default_encoding_spec)
     : EncodingConfig{std::move(default_encoding_spec), {}, {}} {}
 
 EncodingConfig::EncodingConfig(ColumnEncodingSpec default_encoding_spec, DataTypeEncodingMapping type_encoding_mapping,
-                               TableColumnEncodingMapping encoding_mapping)
+                               TableColumnEncodingMapping encoding_mapping, float auto_memory_weight)
     : default_encoding_spec{std::move(default_encoding_spec)},
       type_encoding_mapping{std::move(type_encoding_mapping)},
-      custom_encoding_mapping{std::move(encoding_mapping)} {}
+      custom_encoding_mapping{std::move(encoding_mapping)},
+      auto_memory_weight{auto_memory_weight} {}
 
 EncodingConfig EncodingConfig::unencoded() { return EncodingConfig{ColumnEncodingSpec{EncodingType::Unencoded}}; }
 
@@ -350,6 +357,8 @@ nlohmann::json EncodingConfig::to_json() const {
     json["custom"] = table_mapping;
   }
 
+  json["auto_memory_weight"] = auto_memory_weight;
+
   return json;
 }
 
@@ -387,7 +396,28 @@ void BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     chunk_spec.push_back(config.default_encoding_spec);
   }
 
-  return ChunkEncoder::encode_all_chunks(table, chunk_spec);
+  const auto has_auto_encoding = std::any_of(chunk_spec.cbegin(), chunk_spec.cend(), [](const auto& column_spec) {
+    return column_spec.encoding_type == EncodingType::Auto;
+  });
+  if (!has_auto_encoding) return ChunkEncoder::encode_all_chunks(table, chunk_spec);
+
+  // The selector chooses the encoding of each Auto column per chunk, as the data characteristics may differ
+  const auto selector = EncodingSelector{config.auto_memory_weight};
+  const auto column_types = table->column_data_types();
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+
+    auto resolved_chunk_spec = chunk_spec;
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      if (resolved_chunk_spec[column_id].encoding_type != EncodingType::Auto) continue;
+
+      const auto value_column = std::dynamic_pointer_cast<const BaseValueColumn>(chunk->get_column(column_id));
+      Assert(value_column, "Encodings can only be selected for value columns.");
+      resolved_chunk_spec[column_id] = selector.select(*value_column);
+    }
+
+    ChunkEncoder::encode_chunk(chunk, column_types, resolved_chunk_spec);
+  }
 }
 
 // This is intentionally limited to 80 chars per line, as cxxopts does this too and it looks bad otherwise.
@@ -431,6 +461,9 @@ look like this:
 All encoding/compression types can be viewed with the `help` command or seen
 in constant_mappings.cpp.
 The encoding is always required, the compression is optional.
+With the encoding "Auto", the encoding and compression of each column are
+chosen per chunk based on its data. The optional "auto_memory_weight" (between
+0 and 1, default 0.5) weighs memory usage against scan speed for this choice.
 
 {
   "default": {
@@ -464,6 +497,8 @@ The encoding is always required, the compression is optional.
         "compression": <VECTOR_COMPRESSION_TYPE_STRING>
       }
     }
-  }
+  },
+
+  "auto_memory_weight": <FLOAT>                       // optional
 })";
 }  // namespace opossum
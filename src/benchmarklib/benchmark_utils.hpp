@@ -9,6 +9,7 @@
 
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/encoding_selector.hpp"
 #include "storage/encoding_type.hpp"
 
 namespace opossum {
@@ -70,7 +71,8 @@ struct BenchmarkState {
 struct EncodingConfig {
   EncodingConfig();
   EncodingConfig(ColumnEncodingSpec default_encoding_spec, DataTypeEncodingMapping type_encoding_mapping,
-                 TableColumnEncodingMapping encoding_mapping);
+                 TableColumnEncodingMapping encoding_mapping,
+                 float auto_memory_weight = EncodingSelector::DEFAULT_MEMORY_WEIGHT);
   explicit EncodingConfig(ColumnEncodingSpec default_encoding_spec);
 
   static EncodingConfig unencoded();
@@ -79,6 +81,9 @@ struct EncodingConfig {
   const DataTypeEncodingMapping type_encoding_mapping;
   const TableColumnEncodingMapping custom_encoding_mapping;
 
+  // Passed to the EncodingSelector that resolves columns with EncodingType::Auto
+  const float auto_memory_weight;
+
   static ColumnEncodingSpec encoding_spec_from_strings(const std::string& encoding_str,
                                                        const std::string& compression_str);
   static EncodingType encoding_string_to_type(const std::string& encoding_str);
@@ -8,6 +8,7 @@
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "server/server.hpp"
+#include "storage/background_chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
 
@@ -26,6 +27,9 @@ int main(int argc, char* argv[]) {
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
+    // Encode the chunks that are filled through INSERT statements once they are completed.
+    opossum::BackgroundChunkEncoder background_chunk_encoder;
+
     boost::asio::io_service io_service;
 
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
@@ -170,15 +170,18 @@ void TransactionContext::on_operator_finished() {
   DebugAssert((_num_active_operators > 0), "Bug detected");
   const auto num_before = _num_active_operators--;
 
+  // Only the last operator takes the mutex, so that a waiting thread cannot miss the notification
   if (num_before == 1) {
+    std::lock_guard<std::mutex> lock(_active_operators_mutex);
     _active_operators_cv.notify_all();
   }
 }
 
 void TransactionContext::_wait_for_active_operators_to_finish() const {
-  std::unique_lock<std::mutex> lock(_active_operators_mutex);
   if (_num_active_operators == 0) return;
-  _active_operators_cv.wait(lock, [&] { return _num_active_operators != 0; });
+
+  std::unique_lock<std::mutex> lock(_active_operators_mutex);
+  _active_operators_cv.wait(lock, [&] { return _num_active_operators == 0; });
 }
 
 bool TransactionContext::_transition(TransactionPhase from_phase, TransactionPhase to_phase,
@@ -5,6 +5,8 @@
 #include <memory>
 #include <vector>
 
+#include "tbb/concurrent_vector.h"
+
 #include "types.hpp"
 
 namespace opossum {
@@ -107,7 +109,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   bool commit();
 
   /**
-   * Add an operator to the list of read-write operators.
+   * Add an operator to the list of read-write operators. Lock-free, so that operators executed in parallel can
+   * register themselves without contention.
    * Update must not call this because it consists of a Delete and an Insert, which call this themselves.
    */
   void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
@@ -174,7 +177,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
  private:
   const TransactionID _transaction_id;
   const CommitID _snapshot_commit_id;
-  std::vector<std::shared_ptr<AbstractReadWriteOperator>> _rw_operators;
+  tbb::concurrent_vector<std::shared_ptr<AbstractReadWriteOperator>> _rw_operators;
 
   std::atomic<TransactionPhase> _phase;
   std::shared_ptr<CommitContext> _commit_context;
@@ -71,19 +71,41 @@ std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   return next_context;
 }
 
+/**
+ * Logic of the batched commit
+ *
+ * A transaction can only be published (i.e., _last_commit_id be set to its commit id) once all transactions with a
+ * smaller commit id have been published. Instead of advancing _last_commit_id by one for each pending context, the
+ * thread whose context directly follows the last published one collects all consecutive pending contexts and
+ * publishes them with a single compare-and-swap. Other threads whose contexts are part of the batch fail their own
+ * compare-and-swap and return right away. As the successful compare-and-swaps always start at the current
+ * _last_commit_id, the batches never overlap, and every callback is fired exactly once.
+ *
+ * A context might become pending right after the batch was collected. Its own compare-and-swap then either succeeds
+ * after the batch was published, or fails before. In the latter case, it is picked up by the next iteration here.
+ */
 void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
-  auto current_context = context;
+  auto first_context = context;
 
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+  while (first_context->is_pending()) {
+    auto expected_last_commit_id = first_context->commit_id() - 1;
+    if (_last_commit_id.load() != expected_last_commit_id) return;
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+    auto last_context = first_context;
+    while (last_context->has_next() && last_context->next()->is_pending()) {
+      last_context = last_context->next();
+    }
 
-    current_context->fire_callback();
+    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, last_context->commit_id())) return;
 
-    if (!current_context->has_next()) return;
+    for (auto current_context = first_context; current_context != last_context;
+         current_context = current_context->next()) {
+      current_context->fire_callback();
+    }
+    last_context->fire_callback();
 
-    current_context = current_context->next();
+    if (!last_context->has_next()) return;
+    first_context = last_context->next();
   }
 }
 
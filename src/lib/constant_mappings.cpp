@@ -9,8 +9,10 @@
 #include "sql/Expr.h"
 #include "sql/SelectStatement.h"
 
+#include "cost_model/cost_feature.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/aggregate_expression.hpp"
+#include "operators/abstract_operator.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/table.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
@@ -82,7 +84,12 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::RunLength, "RunLength"},
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
+    {EncodingType::Delta, "Delta"},
+    {EncodingType::PatchedFrameOfReference, "PatchedFrameOfReference"},
+    {EncodingType::Alp, "ALP"},
+    {EncodingType::FrontCodedDictionary, "FrontCodedDictionary"},
     {EncodingType::Unencoded, "Unencoded"},
+    {EncodingType::Auto, "Auto"},
 });
 
 const boost::bimap<VectorCompressionType, std::string> vector_compression_type_to_string =
@@ -116,4 +123,62 @@ const boost::bimap<JitExpressionType, std::string> jit_expression_type_to_string
                                                 {JitExpressionType::IsNull, "IS NULL"},
                                                 {JitExpressionType::IsNotNull, "IS NOT NULL"}});
 
+const boost::bimap<OperatorType, std::string> operator_type_to_string =
+    make_bimap<OperatorType, std::string>({{OperatorType::Aggregate, "Aggregate"},
+                                           {OperatorType::Alias, "Alias"},
+                                           {OperatorType::Delete, "Delete"},
+                                           {OperatorType::Difference, "Difference"},
+                                           {OperatorType::ExportBinary, "ExportBinary"},
+                                           {OperatorType::ExportCsv, "ExportCsv"},
+                                           {OperatorType::GetTable, "GetTable"},
+                                           {OperatorType::ImportBinary, "ImportBinary"},
+                                           {OperatorType::ImportCsv, "ImportCsv"},
+                                           {OperatorType::IndexScan, "IndexScan"},
+                                           {OperatorType::Insert, "Insert"},
+                                           {OperatorType::JitOperatorWrapper, "JitOperatorWrapper"},
+                                           {OperatorType::JoinHash, "JoinHash"},
+                                           {OperatorType::JoinIndex, "JoinIndex"},
+                                           {OperatorType::JoinMPSM, "JoinMPSM"},
+                                           {OperatorType::JoinNestedLoop, "JoinNestedLoop"},
+                                           {OperatorType::JoinSortMerge, "JoinSortMerge"},
+                                           {OperatorType::Limit, "Limit"},
+                                           {OperatorType::Print, "Print"},
+                                           {OperatorType::Product, "Product"},
+                                           {OperatorType::Projection, "Projection"},
+                                           {OperatorType::Sort, "Sort"},
+                                           {OperatorType::TableScan, "TableScan"},
+                                           {OperatorType::TableWrapper, "TableWrapper"},
+                                           {OperatorType::UnionAll, "UnionAll"},
+                                           {OperatorType::UnionPositions, "UnionPositions"},
+                                           {OperatorType::Update, "Update"},
+                                           {OperatorType::Validate, "Validate"},
+                                           {OperatorType::CreateView, "CreateView"},
+                                           {OperatorType::DropView, "DropView"},
+                                           {OperatorType::ShowColumns, "ShowColumns"},
+                                           {OperatorType::ShowTables, "ShowTables"},
+                                           {OperatorType::Mock, "Mock"}});
+
+const boost::bimap<CostFeature, std::string> cost_feature_to_string =
+    make_bimap<CostFeature, std::string>({{CostFeature::LeftInputRowCount, "LeftInputRowCount"},
+                                          {CostFeature::RightInputRowCount, "RightInputRowCount"},
+                                          {CostFeature::InputRowCountProduct, "InputRowCountProduct"},
+                                          {CostFeature::LeftInputReferenceRowCount, "LeftInputReferenceRowCount"},
+                                          {CostFeature::RightInputReferenceRowCount, "RightInputReferenceRowCount"},
+                                          {CostFeature::LeftInputRowCountLogN, "LeftInputRowCountLogN"},
+                                          {CostFeature::RightInputRowCountLogN, "RightInputRowCountLogN"},
+                                          {CostFeature::LargerInputRowCount, "LargerInputRowCount"},
+                                          {CostFeature::SmallerInputRowCount, "SmallerInputRowCount"},
+                                          {CostFeature::LargerInputReferenceRowCount, "LargerInputReferenceRowCount"},
+                                          {CostFeature::SmallerInputReferenceRowCount, "SmallerInputReferenceRowCount"},
+                                          {CostFeature::OutputRowCount, "OutputRowCount"},
+                                          {CostFeature::OutputReferenceRowCount, "OutputReferenceRowCount"},
+                                          {CostFeature::LeftDataType, "LeftDataType"},
+                                          {CostFeature::RightDataType, "RightDataType"},
+                                          {CostFeature::PredicateCondition, "PredicateCondition"},
+                                          {CostFeature::LeftInputIsReferences, "LeftInputIsReferences"},
+                                          {CostFeature::RightInputIsReferences, "RightInputIsReferences"},
+                                          {CostFeature::RightOperandIsColumn, "RightOperandIsColumn"},
+                                          {CostFeature::LeftInputIsMajor, "LeftInputIsMajor"},
+                                          {CostFeature::RightInputIsIndexed, "RightInputIsIndexed"}});
+
 }  // namespace opossum
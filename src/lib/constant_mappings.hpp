@@ -17,6 +17,8 @@ enum class VectorCompressionType : uint8_t;
 enum class AggregateFunction;
 enum class ExpressionType;
 enum class TableType;
+enum class OperatorType;
+enum class CostFeature;
 
 extern const boost::bimap<PredicateCondition, std::string> predicate_condition_to_string;
 extern const std::unordered_map<OrderByMode, std::string> order_by_mode_to_string;
@@ -31,5 +33,7 @@ extern const boost::bimap<EncodingType, std::string> encoding_type_to_string;
 extern const boost::bimap<VectorCompressionType, std::string> vector_compression_type_to_string;
 extern const boost::bimap<TableType, std::string> table_type_to_string;
 extern const boost::bimap<JitExpressionType, std::string> jit_expression_type_to_string;
+extern const boost::bimap<OperatorType, std::string> operator_type_to_string;
+extern const boost::bimap<CostFeature, std::string> cost_feature_to_string;
 
 }  // namespace opossum
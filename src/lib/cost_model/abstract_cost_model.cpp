@@ -59,6 +59,11 @@ Cost AbstractCostModel::estimate_lqp_node_cost(const std::shared_ptr<AbstractLQP
       return 0.0f;
   }
 
+  return estimate_lqp_node_cost(node, operator_type);
+}
+
+Cost AbstractCostModel::estimate_lqp_node_cost(const std::shared_ptr<AbstractLQPNode>& node,
+                                               const OperatorType operator_type) const {
   CostFeatureLQPNodeProxy feature_proxy(node);
   return _cost_model_impl(operator_type, feature_proxy);
 }
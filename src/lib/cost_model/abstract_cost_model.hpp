@@ -45,6 +45,12 @@ class AbstractCostModel {
    */
   Cost estimate_lqp_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  /**
+   * @return the Cost of an LQP node if it was executed by an Operator of type `operator_type`. Used, e.g., by the
+   *         LQPTranslator to choose between different join implementations.
+   */
+  Cost estimate_lqp_node_cost(const std::shared_ptr<AbstractLQPNode>& node, const OperatorType operator_type) const;
+
  protected:
   /**
    * Override to implement the actual cost model
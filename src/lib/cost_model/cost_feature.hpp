@@ -44,7 +44,8 @@ enum class CostFeature {
   LeftInputIsReferences,
   RightInputIsReferences,  // *Input is References
   RightOperandIsColumn,    // Only valid for TableScans
-  LeftInputIsMajor         // LeftInputRowCount > RightInputRowCount
+  LeftInputIsMajor,        // LeftInputRowCount > RightInputRowCount
+  RightInputIsIndexed      // Only valid for Joins. The right input is a stored table with an index on the join column
 };
 
 using CostFeatureWeights = std::map<CostFeature, float>;
@@ -1,17 +1,22 @@
 #include "cost_feature_lqp_node_proxy.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "expression/between_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "resolve_type.hpp"
 #include "statistics/column_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 
 namespace opossum {
 
@@ -103,6 +108,19 @@ CostFeatureVariant CostFeatureLQPNodeProxy::_extract_feature_from_join_node(cons
     case CostFeature::RightOperandIsColumn:
       return true;
 
+    case CostFeature::RightInputIsIndexed: {
+      // Indexes are only available on stored tables. The JoinIndex cannot use them once any other operator (e.g., a
+      // Validate or a TableScan) sits between the join and the table.
+      if (_node->right_input()->type != LQPNodeType::StoredTable) return false;
+
+      const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(_node->right_input());
+      const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+      const auto index_infos = table->get_indexes();
+      return std::any_of(index_infos.begin(), index_infos.end(), [&](const auto& index_info) {
+        return index_info.column_ids == std::vector<ColumnID>{operator_predicate->column_ids.second};
+      });
+    }
+
     default:
       Fail("Unexpected CostFeature");
   }
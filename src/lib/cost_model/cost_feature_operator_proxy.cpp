@@ -1,5 +1,7 @@
 #include "cost_feature_operator_proxy.hpp"
 
+#include <vector>
+
 #include "operators/abstract_operator.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_nested_loop.hpp"
@@ -7,6 +9,7 @@
 #include "operators/product.hpp"
 #include "operators/table_scan.hpp"
 #include "resolve_type.hpp"
+#include "storage/chunk.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -77,6 +80,21 @@ CostFeatureVariant CostFeatureOperatorProxy::_extract_feature_impl(const CostFea
         Fail("CostFeature not defined for LQPNodeType");
       }
 
+    case CostFeature::RightInputIsIndexed: {
+      const auto join_op = std::dynamic_pointer_cast<AbstractJoinOperator>(_op);
+      Assert(join_op, "CostFeature not defined for non-join operators");
+      Assert(_op->input_table_right(), "Can't extract CostFeature since the input table is not available");
+
+      const auto& right_table = *_op->input_table_right();
+      if (right_table.type() != TableType::Data || right_table.chunk_count() == 0) return false;
+
+      const auto column_ids = std::vector<ColumnID>{join_op->column_ids().second};
+      for (ChunkID chunk_id{0}; chunk_id < right_table.chunk_count(); ++chunk_id) {
+        if (right_table.get_chunk(chunk_id)->get_indices(column_ids).empty()) return false;
+      }
+      return true;
+    }
+
     default:
       Fail("Extraction of this feature is not implemented. Maybe it should be handled in AbstractCostFeatureProxy?");
   }
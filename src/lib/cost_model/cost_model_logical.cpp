@@ -21,7 +21,13 @@ Cost CostModelLogical::_cost_model_impl(const OperatorType operator_type,
     case OperatorType::TableScan:
       return feature_proxy.extract_feature(CostFeature::LeftInputRowCount).scalar();
 
+    case OperatorType::JoinIndex:
+      // Every row of the left input probes the index, every match has to be written
+      return feature_proxy.extract_feature(CostFeature::LeftInputRowCount).scalar() +
+             feature_proxy.extract_feature(CostFeature::OutputRowCount).scalar();
+
     case OperatorType::JoinSortMerge:
+    case OperatorType::JoinMPSM:
       // Model the cost of the sorting as the dominant cost
       return feature_proxy.extract_feature(CostFeature::LeftInputRowCountLogN).scalar() +
              feature_proxy.extract_feature(CostFeature::RightInputRowCountLogN).scalar();
@@ -0,0 +1,114 @@
+#include "cost_model_physical.hpp"
+
+#include <fstream>
+#include <limits>
+
+#include "abstract_cost_feature_proxy.hpp"
+#include "constant_mappings.hpp"
+#include "operators/abstract_operator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CostModelPhysicalCoefficients CostModelPhysical::default_coefficients() {
+  // Rough per-row runtimes in microseconds. They are chosen so that, without calibration, the JoinHash is preferred
+  // for equi joins, the JoinSortMerge for all others, and the JoinIndex only if it probes a comparatively small input.
+  // The JoinMPSM only pays off on NUMA systems and is therefore only chosen with calibrated coefficients.
+  return {
+      {OperatorType::JoinHash, {{CostFeature::LeftInputRowCount, 0.15f}, {CostFeature::RightInputRowCount, 0.15f}}},
+      {OperatorType::JoinSortMerge,
+       {{CostFeature::LeftInputRowCount, 0.15f},
+        {CostFeature::RightInputRowCount, 0.15f},
+        {CostFeature::LeftInputRowCountLogN, 0.02f},
+        {CostFeature::RightInputRowCountLogN, 0.02f}}},
+      {OperatorType::JoinMPSM,
+       {{CostFeature::LeftInputRowCount, 0.2f},
+        {CostFeature::RightInputRowCount, 0.2f},
+        {CostFeature::LeftInputRowCountLogN, 0.02f},
+        {CostFeature::RightInputRowCountLogN, 0.02f}}},
+      {OperatorType::JoinIndex, {{CostFeature::LeftInputRowCount, 0.5f}, {CostFeature::OutputRowCount, 0.02f}}},
+      {OperatorType::JoinNestedLoop, {{CostFeature::InputRowCountProduct, 0.01f}}},
+      {OperatorType::Product, {{CostFeature::InputRowCountProduct, 0.01f}}},
+      {OperatorType::TableScan, {{CostFeature::LeftInputRowCount, 0.01f}, {CostFeature::OutputRowCount, 0.01f}}},
+      {OperatorType::UnionPositions,
+       {{CostFeature::LeftInputRowCountLogN, 0.02f}, {CostFeature::RightInputRowCountLogN, 0.02f}}},
+  };
+}
+
+CostModelPhysical::CostModelPhysical(const CostModelPhysicalCoefficients& coefficients)
+    : _coefficients(coefficients) {}
+
+std::string CostModelPhysical::name() const { return "CostModelPhysical"; }
+
+Cost CostModelPhysical::get_reference_operator_cost(const std::shared_ptr<AbstractOperator>& op) const {
+  return static_cast<Cost>(op->performance_data().walltime.count());
+}
+
+const CostModelPhysicalCoefficients& CostModelPhysical::coefficients() const { return _coefficients; }
+
+Cost CostModelPhysical::_cost_model_impl(const OperatorType operator_type,
+                                         const AbstractCostFeatureProxy& feature_proxy) const {
+  // Operators without coefficients must never look cheap to the LQPTranslator
+  const auto coefficients_iter = _coefficients.find(operator_type);
+  if (coefficients_iter == _coefficients.end()) return std::numeric_limits<Cost>::infinity();
+
+  auto cost = Cost{0.0f};
+  for (const auto& [cost_feature, weight] : coefficients_iter->second) {
+    cost += weight * feature_proxy.extract_feature(cost_feature).scalar();
+  }
+  return cost;
+}
+
+CostModelPhysicalCoefficients import_cost_model_coefficients(const std::string& path) {
+  std::ifstream stream(path);
+  Assert(stream.good(), std::string("Couldn't open file '") + path + "'");
+
+  nlohmann::json json;
+  stream >> json;
+  return import_cost_model_coefficients(json);
+}
+
+void export_cost_model_coefficients(const CostModelPhysicalCoefficients& coefficients, const std::string& path) {
+  std::ofstream stream(path);
+  Assert(stream.good(), std::string("Couldn't open file '") + path + "'");
+  stream << export_cost_model_coefficients(coefficients).dump(2) << std::endl;
+}
+
+CostModelPhysicalCoefficients import_cost_model_coefficients(const nlohmann::json& json) {
+  Assert(json.is_object(), "Cost model coefficients should be stored in an object");
+
+  auto coefficients = CostModelPhysicalCoefficients{};
+
+  for (auto operator_iter = json.begin(); operator_iter != json.end(); ++operator_iter) {
+    const auto operator_type_iter = operator_type_to_string.right.find(operator_iter.key());
+    Assert(operator_type_iter != operator_type_to_string.right.end(), "No such OperatorType: " + operator_iter.key());
+
+    auto& weights = coefficients[operator_type_iter->second];
+    for (auto feature_iter = operator_iter.value().begin(); feature_iter != operator_iter.value().end();
+         ++feature_iter) {
+      const auto cost_feature_iter = cost_feature_to_string.right.find(feature_iter.key());
+      Assert(cost_feature_iter != cost_feature_to_string.right.end(), "No such CostFeature: " + feature_iter.key());
+
+      weights.emplace(cost_feature_iter->second, feature_iter.value().get<float>());
+    }
+  }
+
+  return coefficients;
+}
+
+nlohmann::json export_cost_model_coefficients(const CostModelPhysicalCoefficients& coefficients) {
+  auto json = nlohmann::json::object();
+
+  for (const auto& [operator_type, weights] : coefficients) {
+    auto& operator_json = json[operator_type_to_string.left.at(operator_type)];
+    operator_json = nlohmann::json::object();
+
+    for (const auto& [cost_feature, weight] : weights) {
+      operator_json[cost_feature_to_string.left.at(cost_feature)] = weight;
+    }
+  }
+
+  return json;
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+#include "json.hpp"
+
+#include "abstract_cost_model.hpp"
+#include "cost_feature.hpp"
+
+namespace opossum {
+
+/**
+ * Weights of the (scalar) CostFeatures per OperatorType
+ */
+using CostModelPhysicalCoefficients = std::unordered_map<OperatorType, CostFeatureWeights>;
+
+/**
+ * Cost model that predicts the runtime of an Operator in microseconds as a weighted sum of its CostFeatures, e.g.,
+ * `0.15 * LeftInputRowCount + 0.02 * LeftInputRowCountLogN`.
+ *
+ * In contrast to the CostModelLogical, it distinguishes between the physical join implementations (JoinHash,
+ * JoinSortMerge, JoinIndex, JoinMPSM) and is used by the LQPTranslator to select one of them.
+ *
+ * Operators without coefficients are assigned an infinite Cost.
+ *
+ * The default coefficients are only a rough approximation. Coefficients for the machine at hand are obtained by
+ * running hyriseCostModelCalibration, which executes the operators on generated tables and fits the weights to the
+ * measured runtimes. Its output can be loaded with import_cost_model_coefficients().
+ */
+class CostModelPhysical : public AbstractCostModel {
+ public:
+  static CostModelPhysicalCoefficients default_coefficients();
+
+  explicit CostModelPhysical(const CostModelPhysicalCoefficients& coefficients = default_coefficients());
+
+  std::string name() const override;
+
+  /**
+   * @return the measured walltime of the operator in microseconds
+   */
+  Cost get_reference_operator_cost(const std::shared_ptr<AbstractOperator>& op) const override;
+
+  const CostModelPhysicalCoefficients& coefficients() const;
+
+ protected:
+  Cost _cost_model_impl(const OperatorType operator_type, const AbstractCostFeatureProxy& feature_proxy) const override;
+
+ private:
+  const CostModelPhysicalCoefficients _coefficients;
+};
+
+CostModelPhysicalCoefficients import_cost_model_coefficients(const std::string& path);
+void export_cost_model_coefficients(const CostModelPhysicalCoefficients& coefficients, const std::string& path);
+
+CostModelPhysicalCoefficients import_cost_model_coefficients(const nlohmann::json& json);
+nlohmann::json export_cost_model_coefficients(const CostModelPhysicalCoefficients& coefficients);
+
+}  // namespace opossum
@@ -184,13 +184,7 @@ ExpressionEvaluator::_evaluate_like_expression<ExpressionEvaluator::Bool>(const
     }
   } else if (!left_results->is_literal() && right_results->is_literal()) {
     // E.g., `a LIKE '%hello%'` -- A single matcher for all rows
-    LikeMatcher like_matcher{right_results->values.front()};
-
-    for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-      like_matcher.resolve(invert_results, [&](const auto& matcher) {
-        result_values[row_idx] = matcher(left_results->values[row_idx]);
-      });
-    }
+    LikeMatcher{right_results->values.front()}.match_all(left_results->values, invert_results, result_values);
   } else {
     // E.g., `'hello' LIKE b` -- A new matcher for each row but the value to check is constant
     for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
@@ -754,9 +748,9 @@ std::shared_ptr<BaseColumn> ExpressionEvaluator::evaluate_expression_to_column(c
       }
 
       if (view.is_nullable()) {
-        pmr_concurrent_vector<bool> nulls(_output_row_count);
+        NullValueVector nulls(_output_row_count);
         for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
-          nulls[chunk_offset] = view.is_null(chunk_offset);
+          if (view.is_null(chunk_offset)) nulls.set(chunk_offset, true);
         }
         column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(nulls));
       } else {
@@ -1,12 +1,99 @@
 #include "like_matcher.hpp"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
 #include "boost/algorithm/string/replace.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-LikeMatcher::LikeMatcher(const std::string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
+namespace {
+
+using Segment = LikeMatcher::GenericPattern::Segment;
+
+LikeMatcher::GenericPattern compile_generic_pattern(const std::string& pattern) {
+  auto generic_pattern = LikeMatcher::GenericPattern{};
+  generic_pattern.contains_any_chars = pattern.find('%') != std::string::npos;
+
+  auto segment_begin = size_t{0};
+  while (true) {
+    const auto segment_end = std::min(pattern.find('%', segment_begin), pattern.size());
+    auto segment = Segment{pattern.substr(segment_begin, segment_end - segment_begin), 0, 0};
+
+    // Find the longest run of characters between the '_' wildcards
+    auto run_begin = size_t{0};
+    for (auto position = size_t{0}; position <= segment.string.size(); ++position) {
+      if (position < segment.string.size() && segment.string[position] != '_') continue;
+
+      if (position - run_begin > segment.literal_length) {
+        segment.literal_begin = run_begin;
+        segment.literal_length = position - run_begin;
+      }
+      run_begin = position + 1;
+    }
+
+    // Consecutive '%' result in empty segments, which only need to be kept at the beginning and the end
+    const auto is_first_segment = segment_begin == 0;
+    const auto is_last_segment = segment_end == pattern.size();
+    if (is_first_segment || is_last_segment || !segment.string.empty()) {
+      generic_pattern.segments.emplace_back(std::move(segment));
+    }
+
+    if (is_last_segment) break;
+    segment_begin = segment_end + 1;
+  }
+
+  return generic_pattern;
+}
+
+// The caller needs to make sure that string holds enough characters after position
+bool segment_matches_at(const Segment& segment, const std::string_view string, const size_t position) {
+  for (auto index = size_t{0}; index < segment.string.size(); ++index) {
+    if (segment.string[index] != '_' && segment.string[index] != string[position + index]) return false;
+  }
+  return true;
+}
+
+// Return the position of the first occurrence of segment in string at or after offset
+size_t find_segment(const Segment& segment, const std::string_view string, const size_t offset) {
+  if (segment.literal_length == 0) {
+    // The segment only consists of '_'
+    return offset + segment.string.size() <= string.size() ? offset : std::string_view::npos;
+  }
+
+  const auto literal = std::string_view{segment.string}.substr(segment.literal_begin, segment.literal_length);
+
+  auto search_offset = offset + segment.literal_begin;
+  while (true) {
+    const auto literal_position = LikeMatcher::find(string, literal, search_offset);
+    if (literal_position == std::string_view::npos) return std::string_view::npos;
+
+    const auto segment_position = literal_position - segment.literal_begin;
+    if (segment_position + segment.string.size() > string.size()) return std::string_view::npos;
+    if (segment_matches_at(segment, string, segment_position)) return segment_position;
+
+    search_offset = literal_position + 1;
+  }
+}
+
+}  // namespace
+
+LikeMatcher::LikeMatcher(const std::string& pattern, const bool case_insensitive)
+    : _case_insensitive(case_insensitive) {
+  if (case_insensitive) {
+    auto lower_pattern = pattern;
+    _to_lower(lower_pattern);
+    _pattern_variant = pattern_string_to_pattern_variant(lower_pattern);
+  } else {
+    _pattern_variant = pattern_string_to_pattern_variant(pattern);
+  }
+}
 
 LikeMatcher::PatternTokens LikeMatcher::pattern_string_to_tokens(const std::string& pattern) {
   PatternTokens tokens;
@@ -51,12 +138,12 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
   } else {
     /**
      * Pattern is either MultipleContainsPattern, e.g., '%hello%world%how%are%you%' or, if it isn't we fall back to
-     * using a regex matcher.
+     * using a GenericPattern.
      *
      * A MultipleContainsPattern begins and ends with '%' and  contains only strings and '%'.
      */
 
-    // Pick ContainsMultiple or Regex
+    // Pick ContainsMultiple or GenericPattern
     auto pattern_is_contains_multiple = true;   // Set to false if tokens don't match %(, string, %)* pattern
     auto strings = std::vector<std::string>{};  // arguments used for ContainsMultiple, if it gets used
     auto expect_any_chars = true;               // If true, expect '%', if false, expect a string
@@ -79,14 +166,90 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
-    if (pattern_is_contains_multiple) {
+    // The pattern also needs to end with '%', which is not the case for, e.g., '%hello%world' or an empty pattern
+    if (pattern_is_contains_multiple && !expect_any_chars) {
       return MultipleContainsPattern{strings};
     } else {
-      return std::regex(sql_like_to_regex(pattern));
+      return compile_generic_pattern(pattern);
     }
   }
 }
 
+std::optional<std::string> LikeMatcher::starts_with_prefix() const {
+  // Sorted data is ordered case-sensitively, so the lower-cased prefix of a case-insensitive matcher cannot be used
+  if (_case_insensitive || _pattern_variant.type() != typeid(StartsWithPattern)) return std::nullopt;
+  return boost::get<StartsWithPattern>(_pattern_variant).string;
+}
+
+bool LikeMatcher::is_case_insensitive() const { return _case_insensitive; }
+
+bool LikeMatcher::GenericPattern::matches(const std::string_view string) const {
+  const auto& first_segment = segments.front();
+  if (!contains_any_chars) {
+    return string.size() == first_segment.string.size() && segment_matches_at(first_segment, string, 0);
+  }
+
+  const auto& last_segment = segments.back();
+  if (string.size() < first_segment.string.size() + last_segment.string.size()) return false;
+
+  const auto last_segment_begin = string.size() - last_segment.string.size();
+  if (!segment_matches_at(first_segment, string, 0) || !segment_matches_at(last_segment, string, last_segment_begin)) {
+    return false;
+  }
+
+  // The segments in between must neither overlap with the first nor with the last segment
+  const auto remaining_string = string.substr(0, last_segment_begin);
+  auto current_position = first_segment.string.size();
+  for (auto segment_idx = size_t{1}; segment_idx + 1 < segments.size(); ++segment_idx) {
+    current_position = find_segment(segments[segment_idx], remaining_string, current_position);
+    if (current_position == std::string_view::npos) return false;
+    current_position += segments[segment_idx].string.size();
+  }
+
+  return true;
+}
+
+size_t LikeMatcher::find(const std::string_view haystack, const std::string_view needle, const size_t offset) {
+  if (offset > haystack.size() || needle.size() > haystack.size() - offset) return std::string_view::npos;
+  if (needle.empty()) return offset;
+
+  auto position = offset;
+
+#ifdef __SSE2__
+  // Based on the "generic SIMD" substring search by Wojciech Muła: A position can only be a match if both the first
+  // and the last character of needle match. The loads of the last characters end within haystack as long as the
+  // block does not exceed last_position.
+  const auto last_position = haystack.size() - needle.size();
+  const auto first_chars = _mm_set1_epi8(needle.front());
+  const auto last_chars = _mm_set1_epi8(needle.back());
+
+  for (; position + 16 <= last_position + 1; position += 16) {
+    const auto block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack.data() + position));
+    const auto block_last =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack.data() + position + needle.size() - 1));
+
+    const auto matches =
+        _mm_and_si128(_mm_cmpeq_epi8(block_first, first_chars), _mm_cmpeq_epi8(block_last, last_chars));
+    auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+    while (mask != 0) {
+      const auto candidate = position + static_cast<size_t>(__builtin_ctz(mask));
+      // The first and the last character are already known to match
+      const auto inner_size = needle.size() < 2 ? size_t{0} : needle.size() - 2;
+      if (std::memcmp(haystack.data() + candidate + 1, needle.data() + 1, inner_size) == 0) return candidate;
+      mask &= mask - 1;
+    }
+  }
+#endif
+
+  // Positions that do not fill an entire block
+  return haystack.find(needle, position);
+}
+
+void LikeMatcher::_to_lower(std::string& string) {
+  std::transform(string.begin(), string.end(), string.begin(),
+                 [](const char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; });
+}
+
 std::string LikeMatcher::sql_like_to_regex(std::string sql_like) {
   // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
   // backslashes introduced by the other substitutions
@@ -1,7 +1,8 @@
 #pragma once
 
-#include <regex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "boost/variant.hpp"
@@ -13,7 +14,10 @@ namespace opossum {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. All other patterns are compiled into a GenericPattern, which does not need backtracking.
+ *
+ * A case-insensitive matcher (as needed for ILIKE) lower-cases the pattern and each string before matching. Only ASCII
+ * characters are folded.
  */
 class LikeMatcher {
  public:
@@ -22,7 +26,7 @@ class LikeMatcher {
    */
   static std::string sql_like_to_regex(std::string sql_like);
 
-  explicit LikeMatcher(const std::string& pattern);
+  explicit LikeMatcher(const std::string& pattern, const bool case_insensitive = false);
 
   enum class Wildcard { SingleChar /* '_' */, AnyChars /* '%' */ };
   using PatternToken = boost::variant<std::string, Wildcard>;  // Keep type order, users rely on which()
@@ -36,7 +40,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern will fall back to a GenericPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -54,16 +58,49 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<std::string> strings;
   };
+  // Any other pattern, e.g., 'H_llo%W%ld'. Each '%' splits the pattern into segments of characters and '_', which have
+  // a fixed length. The first and the last segment are matched at the beginning and the end of the string, all others
+  // are searched for from left to right. As the segments have a fixed length, the leftmost occurrence of a segment is
+  // always the best one and no backtracking is necessary.
+  struct GenericPattern final {
+    struct Segment final {
+      std::string string;
+
+      // The longest run of characters without '_' in string, which is searched for to find the segment
+      size_t literal_begin;
+      size_t literal_length;
+    };
+
+    // If the pattern contains no '%', segments holds exactly one segment that needs to match the entire string
+    std::vector<Segment> segments;
+    bool contains_any_chars;
+
+    bool matches(const std::string_view string) const;
+  };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to a GenericPattern.
    */
   using AllPatternVariant =
-      boost::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      boost::variant<GenericPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const std::string& pattern);
 
+  /**
+   * @return the position of the first occurrence of needle in haystack at or after offset, or std::string_view::npos.
+   *         With SSE2, the first and the last character of needle are compared with 16 positions of haystack at once
+   *         and the remaining characters are only compared where both of them match.
+   */
+  static size_t find(const std::string_view haystack, const std::string_view needle, const size_t offset = 0u);
+
+  /**
+   * @return the prefix if the pattern has the form 'hello%' and the matcher is case-sensitive, std::nullopt otherwise.
+   *         In sorted data, such as dictionaries, the strings matching such a pattern can be found using binary search.
+   */
+  std::optional<std::string> starts_with_prefix() const;
+
+  bool is_case_insensitive() const;
+
   /**
    * The functor will be called with a concrete matcher.
    * Usage example:
@@ -75,49 +112,88 @@ class LikeMatcher {
   void resolve(const bool invert_results, const Functor& functor) const {
     if (_pattern_variant.type() == typeid(StartsWithPattern)) {
       const auto& prefix = boost::get<StartsWithPattern>(_pattern_variant).string;
-      functor([&](const std::string& string) -> bool {
-        if (string.size() < prefix.size()) return invert_results;
-        return (string.compare(0, prefix.size(), prefix) == 0) ^ invert_results;
+      _resolve_case(invert_results, functor, [&](const std::string_view string) {
+        return string.size() >= prefix.size() && string.compare(0, prefix.size(), prefix) == 0;
       });
 
     } else if (_pattern_variant.type() == typeid(EndsWithPattern)) {
       const auto& suffix = boost::get<EndsWithPattern>(_pattern_variant).string;
-      functor([&](const std::string& string) -> bool {
-        if (string.size() < suffix.size()) return invert_results;
-        return (string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0) ^ invert_results;
+      _resolve_case(invert_results, functor, [&](const std::string_view string) {
+        return string.size() >= suffix.size() &&
+               string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0;
       });
 
     } else if (_pattern_variant.type() == typeid(ContainsPattern)) {
       const auto& contains_str = boost::get<ContainsPattern>(_pattern_variant).string;
-      functor([&](const std::string& string) -> bool {
-        return (string.find(contains_str) != std::string::npos) ^ invert_results;
+      _resolve_case(invert_results, functor, [&](const std::string_view string) {
+        return find(string, contains_str) != std::string_view::npos;
       });
 
     } else if (_pattern_variant.type() == typeid(MultipleContainsPattern)) {
       const auto& contains_strs = boost::get<MultipleContainsPattern>(_pattern_variant).strings;
 
-      functor([&](const std::string& string) -> bool {
+      _resolve_case(invert_results, functor, [&](const std::string_view string) {
         auto current_position = size_t{0};
         for (const auto& contains_str : contains_strs) {
-          current_position = string.find(contains_str, current_position);
-          if (current_position == std::string::npos) return invert_results;
+          current_position = find(string, contains_str, current_position);
+          if (current_position == std::string_view::npos) return false;
           current_position += contains_str.size();
         }
-        return !invert_results;
+        return true;
       });
 
-    } else if (_pattern_variant.type() == typeid(std::regex)) {
-      const auto& regex = boost::get<std::regex>(_pattern_variant);
+    } else if (_pattern_variant.type() == typeid(GenericPattern)) {
+      const auto& generic_pattern = boost::get<GenericPattern>(_pattern_variant);
 
-      functor([&](const std::string& string) -> bool { return std::regex_match(string, regex) ^ invert_results; });
+      _resolve_case(invert_results, functor,
+                    [&](const std::string_view string) { return generic_pattern.matches(string); });
 
     } else {
       Fail("Pattern not implemented. Probably a bug.");
     }
   }
 
+  /**
+   * Match all strings at once, e.g., a dictionary or the values of a ValueColumn. The pattern is resolved only once
+   * and the result for strings[i] is written to matches[i], which needs to hold at least strings.size() entries.
+   * @return the number of matches
+   */
+  template <typename Strings, typename Matches>
+  size_t match_all(const Strings& strings, const bool invert_results, Matches& matches) const {
+    DebugAssert(matches.size() >= strings.size(), "Not enough space for the matches");
+
+    auto match_count = size_t{0};
+    resolve(invert_results, [&](const auto& matcher) {
+      auto index = size_t{0};
+      for (const auto& string : strings) {
+        const auto result = matcher(string);
+        matches[index++] = result;
+        match_count += static_cast<size_t>(result);
+      }
+    });
+
+    return match_count;
+  }
+
  private:
+  // Call functor with a matcher that applies match to each string, which is lower-cased first if the LikeMatcher is
+  // case-insensitive. The lower-cased copy reuses its buffer, so that no allocation happens for most strings.
+  template <typename Functor, typename Match>
+  void _resolve_case(const bool invert_results, const Functor& functor, const Match& match) const {
+    auto lower_string = std::string{};
+    functor([&](const std::string& string) -> bool {
+      if (!_case_insensitive) return match(string) ^ invert_results;
+
+      lower_string.assign(string);
+      _to_lower(lower_string);
+      return match(lower_string) ^ invert_results;
+    });
+  }
+
+  static void _to_lower(std::string& string);
+
   AllPatternVariant _pattern_variant;
+  bool _case_insensitive;
 };
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard);
@@ -47,11 +47,11 @@ template <typename T>
 class CsvConverter : public BaseCsvConverter {
  public:
   explicit CsvConverter(ChunkOffset size, const ParseConfig& config = {}, bool is_nullable = false)
-      : _parsed_values(size), _null_values(size, false), _is_nullable(is_nullable), _config(config) {}
+      : _parsed_values(size), _null_values(size), _is_nullable(is_nullable), _config(config) {}
 
   void insert(std::string& value, ChunkOffset position) override {
     if (_is_nullable && value.length() == 0) {
-      _null_values[position] = true;
+      _null_values.set(position, true);
       return;
     }
 
@@ -60,7 +60,7 @@ class CsvConverter : public BaseCsvConverter {
              "Unquoted null found in CSV file. Quote it for string literal \"null\", leave field empty for null value, "
              "or set 'reject_null_strings' to false in parse config.");
       if (_is_nullable) {
-        _null_values[position] = true;
+        _null_values.set(position, true);
         return;
       }
     }
@@ -98,7 +98,7 @@ class CsvConverter : public BaseCsvConverter {
    */
   std::function<T(const std::string&)> _get_conversion_function();
   tbb::concurrent_vector<T> _parsed_values;
-  tbb::concurrent_vector<bool> _null_values;
+  NullValueVector _null_values;
   const bool _is_nullable;
   ParseConfig _config;
 };
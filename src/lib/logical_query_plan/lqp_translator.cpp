@@ -8,6 +8,8 @@
 #include "abstract_lqp_node.hpp"
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
+#include "cost_model/cost_feature_lqp_node_proxy.hpp"
+#include "cost_model/cost_model_physical.hpp"
 #include "create_view_node.hpp"
 #include "delete_node.hpp"
 #include "drop_view_node.hpp"
@@ -34,6 +36,8 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_mpsm.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_view.hpp"
@@ -64,6 +68,10 @@ using namespace std::string_literals;  // NOLINT
 
 namespace opossum {
 
+LQPTranslator::LQPTranslator() : LQPTranslator(std::make_shared<CostModelPhysical>()) {}
+
+LQPTranslator::LQPTranslator(const std::shared_ptr<AbstractCostModel>& cost_model) : _cost_model(cost_model) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -325,14 +333,66 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   Assert(operator_join_predicate, "Couldn't translate join predicate: "s + join_node->join_predicate->as_column_name());
 
   const auto predicate_condition = operator_join_predicate->predicate_condition;
+  const auto& column_ids = operator_join_predicate->column_ids;
+
+  switch (_select_join_operator_type(join_node, *operator_join_predicate)) {
+    case OperatorType::JoinHash:
+      return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode, column_ids,
+                                        predicate_condition);
+    case OperatorType::JoinIndex:
+      return std::make_shared<JoinIndex>(input_left_operator, input_right_operator, join_node->join_mode, column_ids,
+                                         predicate_condition);
+    case OperatorType::JoinMPSM:
+      return std::make_shared<JoinMPSM>(input_left_operator, input_right_operator, join_node->join_mode, column_ids,
+                                        predicate_condition);
+    default:
+      return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
+                                             column_ids, predicate_condition);
+  }
+}
+
+OperatorType LQPTranslator::_select_join_operator_type(const std::shared_ptr<JoinNode>& join_node,
+                                                       const OperatorJoinPredicate& operator_join_predicate) const {
+  const auto join_mode = join_node->join_mode;
+  const auto predicate_condition = operator_join_predicate.predicate_condition;
+
+  const auto left_data_type =
+      join_node->left_input()->column_expressions()[operator_join_predicate.column_ids.first]->data_type();
+  const auto right_data_type =
+      join_node->right_input()->column_expressions()[operator_join_predicate.column_ids.second]->data_type();
+  const auto data_types_match = left_data_type == right_data_type;
+
+  // Only the JoinHash can join columns of different data types. If costs are equal, the candidate listed first wins.
+  auto candidates = std::vector<OperatorType>{};
+  if (JoinHash::supports(join_mode, predicate_condition)) candidates.emplace_back(OperatorType::JoinHash);
 
-  if (predicate_condition == PredicateCondition::Equals && join_node->join_mode != JoinMode::Outer) {
-    return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
-                                      operator_join_predicate->column_ids, predicate_condition);
+  if (data_types_match) {
+    if (JoinSortMerge::supports(join_mode, predicate_condition)) candidates.emplace_back(OperatorType::JoinSortMerge);
+
+    if (JoinIndex::supports(join_mode, predicate_condition) &&
+        CostFeatureLQPNodeProxy{join_node}.extract_feature(CostFeature::RightInputIsIndexed).boolean()) {
+      candidates.emplace_back(OperatorType::JoinIndex);
+    }
+
+    if (JoinMPSM::supports(join_mode, predicate_condition)) candidates.emplace_back(OperatorType::JoinMPSM);
+  }
+
+  // No specialized implementation is applicable, fall back to the JoinSortMerge
+  if (candidates.empty()) return OperatorType::JoinSortMerge;
+  if (candidates.size() == 1) return candidates.front();
+
+  auto best_operator_type = candidates.front();
+  auto best_cost = _cost_model->estimate_lqp_node_cost(join_node, best_operator_type);
+
+  for (auto candidate_iter = candidates.begin() + 1; candidate_iter != candidates.end(); ++candidate_iter) {
+    const auto cost = _cost_model->estimate_lqp_node_cost(join_node, *candidate_iter);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_operator_type = *candidate_iter;
+    }
   }
 
-  return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
-                                         operator_join_predicate->column_ids, predicate_condition);
+  return best_operator_type;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
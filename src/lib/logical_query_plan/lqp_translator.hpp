@@ -9,9 +9,11 @@
 
 namespace opossum {
 
+class AbstractCostModel;
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class JoinNode;
 class PredicateNode;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
@@ -19,9 +21,15 @@ struct OperatorJoinPredicate;
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * Where multiple Operators can execute an LQP node (currently only for joins), the AbstractCostModel is used to pick
+ * the cheapest one. By default, this is a CostModelPhysical with its default coefficients.
  */
 class LQPTranslator {
  public:
+  LQPTranslator();
+  explicit LQPTranslator(const std::shared_ptr<AbstractCostModel>& cost_model);
+
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -41,6 +49,8 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  OperatorType _select_join_operator_type(const std::shared_ptr<JoinNode>& join_node,
+                                          const OperatorJoinPredicate& operator_join_predicate) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -74,6 +84,8 @@ class LQPTranslator {
   static AllParameterVariant _translate_to_all_parameter_variant(const AbstractLQPNode& input_node,
                                                                  const AbstractExpression& expression);
 
+  const std::shared_ptr<AbstractCostModel> _cost_model;
+
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
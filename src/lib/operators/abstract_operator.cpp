@@ -41,7 +41,13 @@ void AbstractOperator::execute() {
       return;
     }
     transaction_context->on_operator_started();
-    _output = _on_execute(transaction_context);
+    try {
+      _output = _on_execute(transaction_context);
+    } catch (...) {
+      // Otherwise, committing or rolling back the transaction would wait for this operator forever
+      transaction_context->on_operator_finished();
+      throw;
+    }
     transaction_context->on_operator_finished();
   } else {
     _output = _on_execute(nullptr);
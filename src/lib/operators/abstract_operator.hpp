@@ -68,6 +68,9 @@ enum class OperatorType {
 // Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
 
 class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>, private Noncopyable {
+  // Needs to copy operators and to set the output of pipelines
+  friend class OperatorTask;
+
  public:
   AbstractOperator(
       const OperatorType type, const std::shared_ptr<const AbstractOperator>& left = nullptr,
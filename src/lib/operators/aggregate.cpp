@@ -13,9 +13,7 @@
 #include "aggregate/aggregate_traits.hpp"
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/job_granularity.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
@@ -327,23 +325,35 @@ void Aggregate::_aggregate() {
     }
   }
 
-  // Now that we have the data structures in place, we can start the actual work
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(_groupby_column_ids.size());
-
-  for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
-    jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, this]() {
-      const auto column_id = _groupby_column_ids.at(group_column_index);
-      const auto data_type = input_table->column_data_type(column_id);
+  // Now that we have the data structures in place, we can start the actual work. Each group column is processed by a
+  // job of its own. Within these, the chunks are processed in batches (see JobGranularity), which assign preliminary
+  // IDs. Batches are merged in their order, so that the final IDs are assigned in the order of the values' first
+  // occurrence, just like when processing all chunks in a single batch.
+  const auto batches = JobGranularity::plan_jobs(JobGranularity::chunks_of(*input_table), SplitChunks::No);
+
+  // Returns the key entry for a row that is set by the group column with the given index
+  const auto key_entry = [&](const ChunkID chunk_id, const ChunkOffset chunk_offset,
+                             const size_t group_column_index) -> AggregateKeyEntry& {
+    if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+      return keys_per_chunk[chunk_id][chunk_offset];
+    } else {
+      return keys_per_chunk[chunk_id][chunk_offset][group_column_index];
+    }
+  };
 
-      resolve_data_type(data_type, [&](auto type) {
-        using ColumnDataType = typename decltype(type)::type;
+  JobGranularity::execute_jobs(_groupby_column_ids.size(), [&](const size_t group_column_index) {
+    const auto column_id = _groupby_column_ids.at(group_column_index);
+    const auto data_type = input_table->column_data_type(column_id);
 
-        /*
-        Store unique IDs for equal values in the groupby column (similar to dictionary encoding). 
-        The ID 0 is reserved for NULL values. The combined IDs build an AggregateKey for each row.
-        */
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
 
+      /*
+      Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
+      The ID 0 is reserved for NULL values. The combined IDs build an AggregateKey for each row.
+      Returns the distinct values of the batch in the order of their IDs.
+      */
+      const auto assign_ids = [&](const MorselBatch& batch) {
         // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
         // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
         // allocate a bit too much.
@@ -352,9 +362,10 @@ void Aggregate::_aggregate() {
 
         auto id_map = std::unordered_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>,
                                          std::equal_to<ColumnDataType>, decltype(allocator)>(allocator);
-        AggregateKeyEntry id_counter = 1u;
+        auto values = std::vector<ColumnDataType>{};
 
-        for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+        for (const auto& morsel : batch) {
+          const auto chunk_id = morsel.chunk_id;
           const auto chunk_in = input_table->get_chunk(chunk_id);
           const auto base_column = chunk_in->get_column(column_id);
 
@@ -364,34 +375,58 @@ void Aggregate::_aggregate() {
             ChunkOffset chunk_offset{0};
             iterable.for_each([&](const auto& value) {
               if (value.is_null()) {
-                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                  keys_per_chunk[chunk_id][chunk_offset] = 0u;
-                } else {
-                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = 0u;
-                }
+                key_entry(chunk_id, chunk_offset, group_column_index) = 0u;
               } else {
-                auto inserted = id_map.try_emplace(value.value(), id_counter);
-                // store either the current id_counter or the existing ID of the value
-                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                  keys_per_chunk[chunk_id][chunk_offset] = inserted.first->second;
-                } else {
-                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = inserted.first->second;
-                }
+                // store either the next ID or the existing ID of the value
+                auto inserted = id_map.try_emplace(value.value(), values.size() + 1);
+                key_entry(chunk_id, chunk_offset, group_column_index) = inserted.first->second;
 
                 // if the id_map didn't have the value as a key and a new element was inserted
-                if (inserted.second) ++id_counter;
+                if (inserted.second) values.emplace_back(value.value());
               }
 
               ++chunk_offset;
             });
           });
         }
+
+        return values;
+      };
+
+      if (batches.size() == 1) {
+        assign_ids(batches.front());
+        return;
+      }
+
+      auto values_per_batch = std::vector<std::vector<ColumnDataType>>(batches.size());
+      JobGranularity::execute_jobs(batches.size(), [&](const size_t batch_idx) {
+        values_per_batch[batch_idx] = assign_ids(batches[batch_idx]);
       });
-    }));
-    jobs.back()->schedule();
-  }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+      // Translate the IDs of each batch into the final IDs
+      auto final_ids = std::unordered_map<ColumnDataType, AggregateKeyEntry>{};
+      auto id_translations = std::vector<std::vector<AggregateKeyEntry>>(batches.size());
+      for (auto batch_idx = size_t{0}; batch_idx < batches.size(); ++batch_idx) {
+        auto& id_translation = id_translations[batch_idx];
+        id_translation.reserve(values_per_batch[batch_idx].size() + 1);
+        id_translation.emplace_back(0u);  // NULL
+
+        for (const auto& value : values_per_batch[batch_idx]) {
+          id_translation.emplace_back(final_ids.try_emplace(value, final_ids.size() + 1).first->second);
+        }
+      }
+
+      JobGranularity::execute_jobs(batches.size(), [&](const size_t batch_idx) {
+        const auto& id_translation = id_translations[batch_idx];
+        for (const auto& morsel : batches[batch_idx]) {
+          for (auto chunk_offset = morsel.begin_offset; chunk_offset < morsel.end_offset; ++chunk_offset) {
+            auto& entry = key_entry(morsel.chunk_id, chunk_offset, group_column_index);
+            entry = id_translation[entry];
+          }
+        }
+      });
+    });
+  });
 
   /*
   AGGREGATION PHASE
@@ -636,7 +671,7 @@ write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
 
   size_t i = 0;
   for (auto& kv : *results) {
-    null_values[i] = !kv.second.current_aggregate;
+    null_values.set(i, !kv.second.current_aggregate);
 
     if (kv.second.current_aggregate) {
       values[i] = *kv.second.current_aggregate;
@@ -700,7 +735,7 @@ write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
 
   size_t i = 0;
   for (auto& kv : *results) {
-    null_values[i] = !kv.second.current_aggregate;
+    null_values.set(i, !kv.second.current_aggregate);
 
     if (kv.second.current_aggregate) {
       values[i] = *kv.second.current_aggregate / static_cast<AggregateType>(kv.second.aggregate_count);
@@ -4,7 +4,7 @@
 #include <string>
 
 #include "concurrency/transaction_context.hpp"
-#include "statistics/table_statistics.hpp"
+#include "statistics/update_table_statistics.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/assert.hpp"
@@ -44,14 +44,16 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
       auto expected = 0u;
       // Actual row lock for delete happens here
       const auto success =
-          referenced_chunk->get_scoped_mvcc_columns_lock()->tids[row_id.chunk_offset].compare_exchange_strong(
-              expected, _transaction_id);
+          referenced_chunk->get_scoped_mvcc_columns_lock()->compare_exchange_tid(row_id.chunk_offset, expected,
+                                                                                 _transaction_id);
 
       // the row is already locked and the transaction needs to be rolled back
       if (!success) {
         _mark_as_failed();
         return nullptr;
       }
+
+      referenced_chunk->get_scoped_mvcc_columns_lock()->on_delete_locked();
     }
   }
 
@@ -65,20 +67,13 @@ void Delete::_on_commit_records(const CommitID cid) {
     for (const auto& row_id : *pos_list) {
       auto chunk = _table->get_chunk(row_id.chunk_id);
 
-      chunk->get_scoped_mvcc_columns_lock()->end_cids[row_id.chunk_offset] = cid;
+      chunk->get_scoped_mvcc_columns_lock()->set_end_cid(row_id.chunk_offset, cid);
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
   }
 }
 
-void Delete::_finish_commit() {
-  const auto table_statistics = _table->table_statistics();
-  if (table_statistics) {
-    _table->set_table_statistics(std::make_shared<TableStatistics>(table_statistics->table_type(),
-                                                                   table_statistics->row_count() - _num_rows_deleted,
-                                                                   table_statistics->column_statistics()));
-  }
-}
+void Delete::_finish_commit() { update_table_statistics(_table, 0.0f, static_cast<float>(_num_rows_deleted)); }
 
 void Delete::_on_rollback_records() {
   for (const auto& pos_list : _pos_lists) {
@@ -89,12 +84,14 @@ void Delete::_on_rollback_records() {
 
       // unlock all rows locked in _on_execute
       const auto result =
-          chunk->get_scoped_mvcc_columns_lock()->tids[row_id.chunk_offset].compare_exchange_strong(expected, 0u);
+          chunk->get_scoped_mvcc_columns_lock()->compare_exchange_tid(row_id.chunk_offset, expected, 0u);
 
       // If the above operation fails, it means the row is locked by another transaction. This must have been
       // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
       // unlocking rows here as well.
       if (!result) return;
+
+      chunk->get_scoped_mvcc_columns_lock()->on_delete_unlocked();
     }
   }
 }
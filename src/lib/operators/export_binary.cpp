@@ -8,6 +8,7 @@
 
 #include "import_export/binary.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
@@ -95,11 +96,10 @@ void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector
   export_string_values(ofstream, value_block);
 }
 
-// specialized implementation for bool values
-template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<bool>& values) {
+// implementation for the null values of value columns
+void export_values(std::ofstream& ofstream, const opossum::NullValueVector& values) {
   // Cast to fixed-size format used in binary file
-  const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
+  const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.cbegin(), values.cend());
   export_values(ofstream, writable_bools);
 }
 
@@ -189,7 +189,7 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_column(const BaseValueColumn&
     export_values(context->ofstream, column.null_values());
   }
 
-  export_values(context->ofstream, column.values());
+  column.with_values([&](const auto& values) { export_values(context->ofstream, values); });
 }
 
 template <typename T>
@@ -278,6 +278,12 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_column(const BaseDictionaryCol
     // Write the dictionary size and dictionary
     export_value(context->ofstream, static_cast<ValueID>(column.dictionary()->size()));
     export_values(context->ofstream, *column.dictionary());
+  } else if (base_column.encoding_type() == EncodingType::FrontCodedDictionary) {
+    const auto& column = static_cast<const FrontCodedDictionaryColumn<std::string>&>(base_column);
+
+    // The front-coded dictionary is decoded and written like a regular one
+    export_value(context->ofstream, static_cast<ValueID>(column.front_coded_dictionary()->size()));
+    export_values(context->ofstream, *column.dictionary());
   } else {
     const auto& column = static_cast<const DictionaryColumn<T>&>(base_column);
 
@@ -183,7 +183,7 @@ std::shared_ptr<ValueColumn<T>> ImportBinary::_import_value_column(std::ifstream
     const auto nullables = _read_values<bool>(file, row_count);
     const auto values = _read_values<T>(file, row_count);
     return std::make_shared<ValueColumn<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()},
-                                            tbb::concurrent_vector<bool>{nullables.begin(), nullables.end()});
+                                            NullValueVector{nullables.begin(), nullables.end()});
   } else {
     const auto values = _read_values<T>(file, row_count);
     return std::make_shared<ValueColumn<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()});
@@ -66,6 +66,7 @@ void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex) {
   auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
     const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id));
+    matches_out->guarantee_single_chunk();
 
     const auto chunk = _in_table->get_chunk(chunk_id);
     // The output chunk is allocated on the same NUMA node as the input chunk. Also, the ChunkAccessCounter is
@@ -7,9 +7,11 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
+#include "statistics/update_table_statistics.hpp"
 #include "storage/base_encoded_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_column.hpp"
+#include "tasks/chunk_compression_task.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 
@@ -54,16 +56,21 @@ class TypedColumnProcessor : public AbstractTypedColumnProcessor {
     auto target_is_nullable = casted_target->is_nullable();
 
     if (auto casted_source = std::dynamic_pointer_cast<const ValueColumn<T>>(source)) {
-      std::copy_n(casted_source->values().begin() + source_start_index, length, values.begin() + target_start_index);
+      casted_source->with_values([&](const auto& source_values) {
+        std::copy_n(source_values.begin() + source_start_index, length, values.begin() + target_start_index);
+      });
 
       if (casted_source->is_nullable()) {
         // Values to insert contain null, copy them
+        const auto& source_null_values = casted_source->null_values();
         if (target_is_nullable) {
-          std::copy_n(casted_source->null_values().begin() + source_start_index, length,
-                      casted_target->null_values().begin() + target_start_index);
-        } else {
-          for (const auto null_value : casted_source->null_values()) {
-            Assert(!null_value, "Trying to insert NULL into non-NULL column");
+          auto& target_null_values = casted_target->null_values();
+          for (auto i = size_t{0}; i < length; ++i) {
+            target_null_values.set(target_start_index + i, source_null_values[source_start_index + i]);
+          }
+        } else if (source_null_values.contains_nulls()) {
+          for (auto i = size_t{0}; i < length; ++i) {
+            Assert(!source_null_values[source_start_index + i], "Trying to insert NULL into non-NULL column");
           }
         }
       }
@@ -76,7 +83,7 @@ class TypedColumnProcessor : public AbstractTypedColumnProcessor {
       Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target.");
 
       // Ignore source value and only set null to true
-      casted_target->null_values()[target_start_index] = true;
+      casted_target->null_values().set(target_start_index, true);
     } else {
       // } else if(auto casted_source = std::dynamic_pointer_cast<ReferenceColumn>(source)){
       // since we have no guarantee that a referenceColumn references only a single other column,
@@ -87,7 +94,7 @@ class TypedColumnProcessor : public AbstractTypedColumnProcessor {
         if (variant_is_null(ref_value)) {
           Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target");
           values[target_start_index + i] = T{};
-          casted_target->null_values()[target_start_index + i] = true;
+          casted_target->null_values().set(target_start_index + i, true);
         } else {
           values[target_start_index + i] = type_cast<T>(ref_value);
         }
@@ -127,8 +134,10 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     auto last_chunk = _target_table->get_chunk(start_chunk_id);
     start_index = last_chunk->size();
 
-    // If last chunk is compressed, add a new uncompressed chunk
-    if (!last_chunk->is_mutable()) {
+    // If last chunk is compressed, add a new uncompressed chunk. The same goes for full chunks, as the
+    // BackgroundChunkEncoder might replace their columns at any time.
+    const auto last_chunk_is_full = last_chunk->size() == _target_table->max_chunk_size();
+    if (!last_chunk->is_mutable() || (last_chunk_is_full && total_rows_to_insert > 0)) {
       _target_table->append_mutable_chunk();
       total_chunks_inserted++;
     }
@@ -157,7 +166,8 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       }
     }
   }
-  // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
+  // The rows allocated above keep their begin CIDs at MAX_COMMIT_ID until this Insert commits or is rolled back. Until
+  // then, their chunks are not completed (see ChunkCompressionTask) and are thus not encoded concurrently.
 
   // Then, actually insert the data.
   auto input_offset = 0u;
@@ -174,8 +184,9 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     auto target_start_index = start_index;
     auto still_to_insert = current_num_rows_to_insert;
 
-    // while target chunk is not full
-    while (target_start_index != target_chunk->size()) {
+    // While our rows in the target chunk are not filled. The chunk itself might have grown further in the meantime,
+    // as concurrent Inserts append their rows as well.
+    while (still_to_insert > 0) {
       const auto source_chunk = input_table_left()->get_chunk(source_chunk_id);
       auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
       for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
@@ -201,7 +212,7 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       // the transaction IDs are set here and not during the resize, because
       // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
       // deleted.
-      target_chunk->get_scoped_mvcc_columns_lock()->tids[i] = context->transaction_id();
+      target_chunk->get_scoped_mvcc_columns_lock()->set_tid(i, context->transaction_id());
       _inserted_rows.emplace_back(RowID{target_chunk_id, i});
     }
 
@@ -217,21 +228,45 @@ void Insert::_on_commit_records(const CommitID cid) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
 
     auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
-    mvcc_columns->begin_cids[row_id.chunk_offset] = cid;
-    mvcc_columns->tids[row_id.chunk_offset] = 0u;
+    mvcc_columns->set_begin_cid(row_id.chunk_offset, cid);
+    mvcc_columns->set_tid(row_id.chunk_offset, 0u);
+    mvcc_columns->on_insert_committed(cid);
   }
 }
 
+void Insert::_finish_commit() {
+  update_table_statistics(_target_table, static_cast<float>(_inserted_rows.size()), 0.0f);
+  _mark_completed_chunks_immutable();
+}
+
 void Insert::_on_rollback_records() {
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
     // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
     // does not think that this row is still incomplete. We need to make sure that the end is written before the begin.
-    chunk->get_scoped_mvcc_columns_lock()->end_cids[row_id.chunk_offset] = 0u;
+    chunk->get_scoped_mvcc_columns_lock()->set_end_cid(row_id.chunk_offset, 0u);
     std::atomic_thread_fence(std::memory_order_release);
-    chunk->get_scoped_mvcc_columns_lock()->begin_cids[row_id.chunk_offset] = 0u;
+    chunk->get_scoped_mvcc_columns_lock()->set_begin_cid(row_id.chunk_offset, 0u);
 
-    chunk->get_scoped_mvcc_columns_lock()->tids[row_id.chunk_offset] = 0u;
+    chunk->get_scoped_mvcc_columns_lock()->set_tid(row_id.chunk_offset, 0u);
+    chunk->get_scoped_mvcc_columns_lock()->on_insert_rolled_back();
+  }
+
+  _mark_completed_chunks_immutable();
+}
+
+void Insert::_mark_completed_chunks_immutable() const {
+  // A full chunk without pending inserts does not grow anymore. Its ValueColumns are made contiguous right away
+  // instead of waiting for the BackgroundChunkEncoder (if there is one) to get to it.
+  auto previous_chunk_id = INVALID_CHUNK_ID;
+  for (const auto& row_id : _inserted_rows) {
+    if (row_id.chunk_id == previous_chunk_id) continue;
+    previous_chunk_id = row_id.chunk_id;
+
+    const auto chunk = _target_table->get_chunk(row_id.chunk_id);
+    if (chunk->is_mutable() && ChunkCompressionTask::chunk_is_completed(chunk, _target_table->max_chunk_size())) {
+      chunk->mark_immutable();
+    }
   }
 }
 
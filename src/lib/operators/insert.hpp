@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
+#include "storage/pos_list.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -32,9 +33,13 @@ class Insert : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
+  void _finish_commit() override;
   void _on_rollback_records() override;
 
  private:
+  // Marks the chunks this operator inserted into as immutable once they are full and no insert into them is pending
+  void _mark_completed_chunks_immutable() const;
+
   const std::string _target_table_name;
   std::shared_ptr<Table> _target_table;
 
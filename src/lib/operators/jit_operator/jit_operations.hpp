@@ -4,6 +4,7 @@
 #include <boost/preprocessor/tuple/elem.hpp>
 
 #include <cmath>
+#include <regex>
 
 #include "jit_types.hpp"
 #include "operators/table_scan/like_table_scan_impl.hpp"
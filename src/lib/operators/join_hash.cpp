@@ -16,6 +16,7 @@
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_granularity.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/abstract_column_visitor.hpp"
 #include "storage/create_iterable_from_column.hpp"
@@ -38,6 +39,10 @@ JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
 
 const std::string JoinHash::name() const { return "JoinHash"; }
 
+bool JoinHash::supports(const JoinMode mode, const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::Equals && mode != JoinMode::Outer && mode != JoinMode::Cross;
+}
+
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -231,55 +236,47 @@ std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Tabl
   histograms = std::vector<std::shared_ptr<std::vector<size_t>>>();
   histograms.resize(chunk_offsets.size());
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(in_table->chunk_count());
+  JobGranularity::for_each_chunk(JobGranularity::chunks_of(*in_table), [&](const ChunkID chunk_id) {
+    // Get information from work queue
+    auto output_offset = chunk_offsets[chunk_id];
+    auto output_iterator = elements->begin() + output_offset;
+    auto column = in_table->get_chunk(chunk_id)->get_column(column_id);
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
-      // Get information from work queue
-      auto output_offset = chunk_offsets[chunk_id];
-      auto output_iterator = elements->begin() + output_offset;
-      auto column = in_table->get_chunk(chunk_id)->get_column(column_id);
-
-      // prepare histogram
-      histograms[chunk_id] = std::make_shared<std::vector<size_t>>(num_partitions);
-      auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
-
-      resolve_column_type<T>(*column, [&, chunk_id, keep_nulls](auto& typed_column) {
-        auto reference_column_offset = ChunkID{0};
-        auto iterable = create_iterable_from_column<T>(typed_column);
-
-        iterable.for_each([&, chunk_id, keep_nulls](const auto& value) {
-          if (!value.is_null() || keep_nulls) {
-            const Hash hashed_value = hash_value<T, HashedType>(value.value(), partitioning_seed);
-
-            /*
-            For ReferenceColumns we do not use the RowIDs from the referenced tables.
-            Instead, we use the index in the ReferenceColumn itself. This way we can later correctly dereference
-            values from different inputs (important for Multi Joins).
-            */
-            if constexpr (std::is_same<std::decay<decltype(typed_column)>, ReferenceColumn>::value) {
-              *(output_iterator++) =
-                  PartitionedElement<T>{RowID{chunk_id, reference_column_offset}, hashed_value, value.value()};
-            } else {
-              *(output_iterator++) =
-                  PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, hashed_value, value.value()};
-            }
+    // prepare histogram
+    histograms[chunk_id] = std::make_shared<std::vector<size_t>>(num_partitions);
+    auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
 
-            const Hash radix = hashed_value & mask;
-            histogram[radix]++;
-          }
-          // reference_column_offset is only used for ReferenceColumns
+    resolve_column_type<T>(*column, [&, chunk_id, keep_nulls](auto& typed_column) {
+      auto reference_column_offset = ChunkID{0};
+      auto iterable = create_iterable_from_column<T>(typed_column);
+
+      iterable.for_each([&, chunk_id, keep_nulls](const auto& value) {
+        if (!value.is_null() || keep_nulls) {
+          const Hash hashed_value = hash_value<T, HashedType>(value.value(), partitioning_seed);
+
+          /*
+          For ReferenceColumns we do not use the RowIDs from the referenced tables.
+          Instead, we use the index in the ReferenceColumn itself. This way we can later correctly dereference
+          values from different inputs (important for Multi Joins).
+          */
           if constexpr (std::is_same<std::decay<decltype(typed_column)>, ReferenceColumn>::value) {
-            reference_column_offset++;
+            *(output_iterator++) =
+                PartitionedElement<T>{RowID{chunk_id, reference_column_offset}, hashed_value, value.value()};
+          } else {
+            *(output_iterator++) =
+                PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, hashed_value, value.value()};
           }
-        });
-      });
-    }));
-    jobs.back()->schedule();
-  }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+          const Hash radix = hashed_value & mask;
+          histogram[radix]++;
+        }
+        // reference_column_offset is only used for ReferenceColumns
+        if constexpr (std::is_same<std::decay<decltype(typed_column)>, ReferenceColumn>::value) {
+          reference_column_offset++;
+        }
+      });
+    });
+  });
 
   return elements;
 }
@@ -318,38 +315,39 @@ RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>&
   }
   radix_output.partition_offsets[num_partitions] = offset;
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(offsets.size());
-
+  // The materialized chunks are consecutive in materialized, starting at their offsets
+  auto materialized_chunks = std::vector<Morsel>{};
+  materialized_chunks.reserve(offsets.size());
   for (ChunkID chunk_id{0}; chunk_id < offsets.size(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
-      size_t input_offset = offsets[chunk_id];
-      auto& output_offsets = output_offsets_by_chunk[chunk_id];
-
-      size_t input_size = 0;
-      if (chunk_id < offsets.size() - 1) {
-        input_size = offsets[chunk_id + 1] - input_offset;
-      } else {
-        input_size = materialized->size() - input_offset;
-      }
+    const auto chunk_end = chunk_id < offsets.size() - 1 ? offsets[chunk_id + 1] : materialized->size();
+    materialized_chunks.emplace_back(
+        Morsel{chunk_id, ChunkOffset{0}, static_cast<ChunkOffset>(chunk_end - offsets[chunk_id])});
+  }
 
-      auto& out = static_cast<Partition<T>&>(*output);
-      for (size_t column_offset = input_offset; column_offset < input_offset + input_size; ++column_offset) {
-        auto& element = (*materialized)[column_offset];
+  JobGranularity::for_each_chunk(materialized_chunks, [&](const ChunkID chunk_id) {
+    size_t input_offset = offsets[chunk_id];
+    auto& output_offsets = output_offsets_by_chunk[chunk_id];
 
-        if (!keep_nulls && element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-          continue;
-        }
+    size_t input_size = 0;
+    if (chunk_id < offsets.size() - 1) {
+      input_size = offsets[chunk_id + 1] - input_offset;
+    } else {
+      input_size = materialized->size() - input_offset;
+    }
 
-        const size_t radix = element.partition_hash & mask;
+    auto& out = static_cast<Partition<T>&>(*output);
+    for (size_t column_offset = input_offset; column_offset < input_offset + input_size; ++column_offset) {
+      auto& element = (*materialized)[column_offset];
 
-        out[output_offsets[radix]++] = element;
+      if (!keep_nulls && element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+        continue;
       }
-    }));
-    jobs.back()->schedule();
-  }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+      const size_t radix = element.partition_hash & mask;
+
+      out[output_offsets[radix]++] = element;
+    }
+  });
 
   return radix_output;
 }
@@ -455,6 +453,9 @@ void probe(const RadixContainer<RightType>& radix_container,
       }
 
       if (!pos_list_left_local.empty()) {
+        // Radix partitioning keeps the rows of a partition in the order of their chunks
+        pos_list_right_local.guarantee_grouped_by_chunk();
+
         pos_lists_left[current_partition_id] = std::move(pos_list_left_local);
         pos_lists_right[current_partition_id] = std::move(pos_list_right_local);
       }
@@ -517,6 +518,9 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
       }
 
       if (!pos_list_local.empty()) {
+        // Radix partitioning keeps the rows of a partition in the order of their chunks
+        pos_list_local.guarantee_grouped_by_chunk();
+
         pos_lists[current_partition_id] = std::move(pos_list_local);
       }
     }));
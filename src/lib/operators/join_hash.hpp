@@ -29,6 +29,12 @@ class JoinHash : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  /**
+   * @return whether the JoinHash can execute a join with the given mode and predicate condition. Used by the
+   *         LQPTranslator to select the join implementation.
+   */
+  static bool supports(const JoinMode mode, const PredicateCondition predicate_condition);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -1,5 +1,6 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -35,6 +36,24 @@ JoinIndex::JoinIndex(const std::shared_ptr<const AbstractOperator>& left,
 
 const std::string JoinIndex::name() const { return "JoinIndex"; }
 
+bool JoinIndex::supports(const JoinMode mode, const PredicateCondition predicate_condition) {
+  if (mode != JoinMode::Inner && mode != JoinMode::Left && mode != JoinMode::Right && mode != JoinMode::Outer) {
+    return false;
+  }
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return true;
+    default:
+      return false;
+  }
+}
+
 std::shared_ptr<AbstractOperator> JoinIndex::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -94,10 +113,13 @@ void JoinIndex::_perform_join() {
   _pos_list_left = std::make_shared<PosList>();
   _pos_list_right = std::make_shared<PosList>();
 
-  size_t worst_case = _left_in_table->row_count() * _right_in_table->row_count();
+  // Reserving the worst case (the product of both input sizes) would be prohibitive for the large indexed inputs this
+  // operator is meant for. Expect roughly one match per probing row instead and let the PosLists grow if necessary.
+  auto expected_output_size = _left_in_table->row_count();
+  if (track_right_matches) expected_output_size = std::max(expected_output_size, _right_in_table->row_count());
 
-  _pos_list_left->reserve(worst_case);
-  _pos_list_right->reserve(worst_case);
+  _pos_list_left->reserve(expected_output_size);
+  _pos_list_right->reserve(expected_output_size);
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
@@ -27,6 +27,9 @@ class JoinIndex : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  // Whether the JoinIndex can execute this join. Note that it additionally requires an index on the right input.
+  static bool supports(const JoinMode mode, const PredicateCondition predicate_condition);
+
   struct PerformanceData : public OperatorPerformanceData {
     size_t chunks_scanned_with_index{0};
     size_t chunks_scanned_without_index{0};
@@ -73,6 +73,11 @@ void JoinMPSM::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeV
 
 const std::string JoinMPSM::name() const { return "Join MPSM"; }
 
+bool JoinMPSM::supports(const JoinMode mode, const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::Equals &&
+         (mode == JoinMode::Inner || mode == JoinMode::Left || mode == JoinMode::Right || mode == JoinMode::Outer);
+}
+
 template <typename T>
 class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
  public:
@@ -28,6 +28,8 @@ class JoinMPSM : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  static bool supports(const JoinMode mode, const PredicateCondition predicate_condition);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
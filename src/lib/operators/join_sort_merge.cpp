@@ -74,6 +74,25 @@ void JoinSortMerge::_on_cleanup() { _impl.reset(); }
 
 const std::string JoinSortMerge::name() const { return "JoinSortMerge"; }
 
+bool JoinSortMerge::supports(const JoinMode mode, const PredicateCondition predicate_condition) {
+  if (mode != JoinMode::Inner && mode != JoinMode::Left && mode != JoinMode::Right && mode != JoinMode::Outer) {
+    return false;
+  }
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return true;
+    case PredicateCondition::NotEquals:
+      return mode == JoinMode::Inner;
+    default:
+      return false;
+  }
+}
+
 /**
 ** Start of implementation.
 **/
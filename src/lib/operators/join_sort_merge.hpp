@@ -29,6 +29,8 @@ class JoinSortMerge : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  static bool supports(const JoinMode mode, const PredicateCondition predicate_condition);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
@@ -55,9 +55,12 @@ std::shared_ptr<const Table> Limit::_on_execute() {
 
     size_t output_chunk_row_count = std::min<size_t>(input_chunk->size(), num_rows - i);
 
+    // The rows of data chunks are referenced by a chunk range, which is shared by all columns
+    auto chunk_range_pos_list = std::shared_ptr<PosList>{};
+
     for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
       const auto input_base_column = input_chunk->get_column(column_id);
-      auto output_pos_list = std::make_shared<PosList>(output_chunk_row_count);
+      auto output_pos_list = std::shared_ptr<PosList>{};
       std::shared_ptr<const Table> referenced_table;
       ColumnID output_column_id = column_id;
 
@@ -65,13 +68,17 @@ std::shared_ptr<const Table> Limit::_on_execute() {
         output_column_id = input_ref_column->referenced_column_id();
         referenced_table = input_ref_column->referenced_table();
         // TODO(all): optimize using whole chunk whenever possible
-        auto begin = input_ref_column->pos_list()->begin();
-        std::copy(begin, begin + output_chunk_row_count, output_pos_list->begin());
+        const auto& input_pos_list = *input_ref_column->pos_list();
+        output_pos_list = std::make_shared<PosList>(input_pos_list.begin(),
+                                                    input_pos_list.begin() + output_chunk_row_count);
+        output_pos_list->inherit_guarantees(input_pos_list);
       } else {
         referenced_table = input_table;
-        for (ChunkOffset chunk_offset = 0; chunk_offset < output_chunk_row_count; chunk_offset++) {
-          (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+        if (!chunk_range_pos_list) {
+          chunk_range_pos_list = std::make_shared<PosList>(
+              PosList::chunk_range(chunk_id, ChunkOffset{0}, static_cast<ChunkOffset>(output_chunk_row_count)));
         }
+        output_pos_list = chunk_range_pos_list;
       }
 
       output_columns.push_back(std::make_shared<ReferenceColumn>(referenced_table, output_column_id, output_pos_list));
@@ -12,6 +12,7 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "scheduler/job_granularity.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -60,13 +61,16 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       std::make_shared<Table>(column_definitions, output_table_type, input_table_left()->max_chunk_size());
 
   /**
-   * Perform the projection
+   * Perform the projection. The chunks are evaluated in parallel and appended in their original order afterwards.
    */
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    ChunkColumns output_columns;
+  const auto& input_table = *input_table_left();
+  auto output_columns_by_chunk = std::vector<ChunkColumns>(input_table.chunk_count());
+
+  JobGranularity::for_each_chunk(JobGranularity::chunks_of(input_table), [&](const ChunkID chunk_id) {
+    auto& output_columns = output_columns_by_chunk[chunk_id];
     output_columns.reserve(expressions.size());
 
-    const auto input_chunk = input_table_left()->get_chunk(chunk_id);
+    const auto input_chunk = input_table.get_chunk(chunk_id);
 
     ExpressionEvaluator evaluator(input_table_left(), chunk_id);
     for (const auto& expression : expressions) {
@@ -78,9 +82,11 @@ std::shared_ptr<const Table> Projection::_on_execute() {
         output_columns.emplace_back(evaluator.evaluate_expression_to_column(*expression));
       }
     }
+  });
 
-    output_table->append_chunk(output_columns);
-    output_table->get_chunk(chunk_id)->set_mvcc_columns(input_chunk->mvcc_columns());
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table.chunk_count(); ++chunk_id) {
+    output_table->append_chunk(output_columns_by_chunk[chunk_id]);
+    output_table->get_chunk(chunk_id)->set_mvcc_columns(input_table.get_chunk(chunk_id)->mvcc_columns());
   }
 
   return output_table;
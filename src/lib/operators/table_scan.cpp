@@ -1,5 +1,6 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -11,9 +12,7 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/job_granularity.hpp"
 #include "storage/base_column.hpp"
 #include "storage/chunk.hpp"
 #include "storage/proxy_chunk.hpp"
@@ -40,6 +39,8 @@ TableScan::~TableScan() = default;
 
 void TableScan::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
 
+const std::vector<ChunkID>& TableScan::excluded_chunk_ids() const { return _excluded_chunk_ids; }
+
 ColumnID TableScan::left_column_id() const { return _left_column_id; }
 
 PredicateCondition TableScan::predicate_condition() const { return _predicate_condition; }
@@ -86,79 +87,107 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(_in_table->chunk_count() - excluded_chunk_set.size());
-
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(_in_table->chunk_count() - excluded_chunk_set.size());
   for (ChunkID chunk_id{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
-    if (excluded_chunk_set.count(chunk_id)) continue;
-
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-      const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
-      // towards the original chunk.
-      ChunkColumns out_columns;
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference columns of the output. If it is a reference column,
-       * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between columns as much as possible. Position lists can be shared between two columns iff
-       * (a) they point to the same table and
-       * (b) the reference columns of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (_in_table->type() == TableType::References) {
-        const auto chunk_in = _in_table->get_chunk(chunk_id);
-
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
-
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto column_in = chunk_in->get_column(column_id);
-
-          auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
-          DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
-
-          const auto pos_list_in = ref_column_in->pos_list();
-
-          const auto table_out = ref_column_in->referenced_table();
-          const auto column_id_out = ref_column_in->referenced_column_id();
-
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>();
-            filtered_pos_list->reserve(matches_out->size());
-
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              filtered_pos_list->push_back(row_id);
-            }
+    if (!excluded_chunk_set.count(chunk_id)) chunk_ids.emplace_back(chunk_id);
+  }
+
+  // Large chunks are split into several jobs if the impl can scan parts of chunks. Each part results in an output
+  // chunk of its own.
+  const auto split_chunks = _impl->can_scan_chunk_ranges() ? SplitChunks::Yes : SplitChunks::No;
+  const auto batches = JobGranularity::plan_jobs(JobGranularity::chunks_of(*_in_table, chunk_ids), split_chunks);
+
+  const auto scan_morsel = [&](const Morsel& morsel) {
+    const auto chunk_id = morsel.chunk_id;
+    const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
+    const auto chunk_size = chunk_guard->size();
+
+    // The actual scan happens in the sub classes of BaseTableScanImpl
+    const auto matches_out = morsel.size() == chunk_size
+                                 ? _impl->scan_chunk(chunk_id)
+                                 : _impl->scan_chunk_range(chunk_id, morsel.begin_offset, morsel.end_offset);
+    if (matches_out->empty()) return;
+
+    // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
+    // towards the original chunk.
+    ChunkColumns out_columns;
+
+    /**
+     * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+     * directly use the matches to construct the reference columns of the output. If it is a reference column,
+     * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
+     * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+     * between columns as much as possible. Position lists can be shared between two columns iff
+     * (a) they point to the same table and
+     * (b) the reference columns of the input table point to the same positions in the same order
+     *     (i.e. they share their position list).
+     */
+    if (_in_table->type() == TableType::References) {
+      const auto chunk_in = _in_table->get_chunk(chunk_id);
+
+      auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+      // Scans on ReferenceColumns do not necessarily output their matches in the order of the input positions
+      const auto matches_are_ordered =
+          std::is_sorted(matches_out->cbegin(), matches_out->cend(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.chunk_offset < rhs.chunk_offset; });
+
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        auto column_in = chunk_in->get_column(column_id);
+
+        auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
+        DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
+
+        const auto pos_list_in = ref_column_in->pos_list();
+
+        const auto table_out = ref_column_in->referenced_table();
+        const auto column_id_out = ref_column_in->referenced_column_id();
+
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+        if (!filtered_pos_list) {
+          filtered_pos_list = std::make_shared<PosList>();
+          filtered_pos_list->reserve(matches_out->size());
+
+          for (const auto& match : *matches_out) {
+            const auto row_id = (*pos_list_in)[match.chunk_offset];
+            filtered_pos_list->push_back(row_id);
           }
 
-          auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
-          out_columns.push_back(ref_column_out);
-        }
-      } else {
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
-          out_columns.push_back(ref_column_out);
+          if (matches_are_ordered) {
+            filtered_pos_list->inherit_guarantees(*pos_list_in);
+          } else if (pos_list_in->references_single_chunk()) {
+            filtered_pos_list->guarantee_single_chunk();
+          }
         }
-      }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      _output_table->append_chunk(out_columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
-    });
+        auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
+        out_columns.push_back(ref_column_out);
+      }
+    } else {
+      // If all rows of the morsel match, the matches are replaced by a chunk range that does not store them
+      const auto pos_list_out =
+          matches_out->size() == morsel.size()
+              ? std::make_shared<PosList>(PosList::chunk_range(chunk_id, morsel.begin_offset, morsel.end_offset))
+              : matches_out;
+      pos_list_out->guarantee_single_chunk();
+
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, pos_list_out);
+        out_columns.push_back(ref_column_out);
+      }
+    }
 
-    jobs.push_back(job_task);
-    job_task->schedule();
-  }
+    std::lock_guard<std::mutex> lock(output_mutex);
+    _output_table->append_chunk(out_columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
+  };
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  JobGranularity::execute_jobs(batches.size(), [&](const size_t batch_idx) {
+    for (const auto& morsel : batches[batch_idx]) {
+      scan_morsel(morsel);
+    }
+  });
 
   return _output_table;
 }
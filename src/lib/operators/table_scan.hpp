@@ -39,6 +39,7 @@ class TableScan : public AbstractReadOnlyOperator {
    * excluded chunks and all others a list of included chunks.
    */
   void set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids);
+  const std::vector<ChunkID>& excluded_chunk_ids() const;
 
   ColumnID left_column_id() const;
   PredicateCondition predicate_condition() const;
@@ -20,19 +20,64 @@ BaseSingleColumnTableScanImpl::BaseSingleColumnTableScanImpl(const std::shared_p
     : BaseTableScanImpl{in_table, column_id, predicate_condition} {}
 
 std::shared_ptr<PosList> BaseSingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
+  return scan_chunk_range(chunk_id, ChunkOffset{0u}, _in_table->get_chunk(chunk_id)->size());
+}
+
+std::shared_ptr<PosList> BaseSingleColumnTableScanImpl::scan_chunk_range(ChunkID chunk_id, ChunkOffset begin_offset,
+                                                                         ChunkOffset end_offset) {
   const auto chunk = _in_table->get_chunk(chunk_id);
-  const auto column = chunk->get_column(_left_column_id);
+  auto column = chunk->get_column(_left_column_id);
+
+  DebugAssert(begin_offset <= end_offset && end_offset <= column->size(), "Invalid chunk range");
+  const auto is_part_of_chunk = begin_offset != 0u || end_offset != column->size();
 
   auto matches_out = std::make_shared<PosList>();
   auto context = std::make_shared<Context>(chunk_id, *matches_out);
 
+  if (is_part_of_chunk) {
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      // The part of the position list is scanned as a ReferenceColumn of its own, its matches are shifted below
+      const auto& pos_list = *reference_column->pos_list();
+
+      auto part_pos_list = std::shared_ptr<PosList>{};
+      if (pos_list.is_chunk_range()) {
+        const auto range_begin_offset = pos_list.front().chunk_offset;
+        part_pos_list = std::make_shared<PosList>(
+            PosList::chunk_range(pos_list.common_chunk_id(), static_cast<ChunkOffset>(range_begin_offset + begin_offset),
+                                 static_cast<ChunkOffset>(range_begin_offset + end_offset)));
+      } else {
+        part_pos_list = std::make_shared<PosList>(pos_list.cbegin() + begin_offset, pos_list.cbegin() + end_offset);
+        part_pos_list->inherit_guarantees(pos_list);
+      }
+
+      column = std::make_shared<ReferenceColumn>(reference_column->referenced_table(),
+                                                 reference_column->referenced_column_id(), part_pos_list);
+    } else {
+      auto mapped_chunk_offsets = std::make_unique<ChunkOffsetsList>();
+      mapped_chunk_offsets->reserve(end_offset - begin_offset);
+      for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+        mapped_chunk_offsets->push_back({chunk_offset, chunk_offset});
+      }
+
+      context = std::make_shared<Context>(chunk_id, *matches_out, std::move(mapped_chunk_offsets));
+    }
+  }
+
   resolve_data_and_column_type(*column, [&](const auto data_type_t, const auto& resolved_column) {
     static_cast<AbstractColumnVisitor*>(this)->handle_column(resolved_column, context);
   });
 
+  if (is_part_of_chunk && _in_table->type() == TableType::References) {
+    for (auto& match : *matches_out) {
+      match.chunk_offset += begin_offset;
+    }
+  }
+
   return matches_out;
 }
 
+bool BaseSingleColumnTableScanImpl::can_scan_chunk_ranges() const { return true; }
+
 void BaseSingleColumnTableScanImpl::handle_column(const ReferenceColumn& column,
                                                   std::shared_ptr<ColumnVisitorContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
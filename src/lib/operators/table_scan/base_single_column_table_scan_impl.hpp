@@ -22,6 +22,10 @@ class AttributeVectorIterable;
  *
  * Resolves reference columns. The position list of reference columns
  * is split by the referenced columns and then each is visited separately.
+ *
+ * Parts of chunks are scanned via the point-access iterators of data columns,
+ * with mapped chunk offsets that cover the part. For reference columns, only
+ * the part of the position list is visited.
  */
 class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public AbstractColumnVisitor {
  public:
@@ -30,6 +34,11 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public AbstractC
 
   std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) override;
 
+  std::shared_ptr<PosList> scan_chunk_range(ChunkID chunk_id, ChunkOffset begin_offset,
+                                            ChunkOffset end_offset) override;
+
+  bool can_scan_chunk_ranges() const override;
+
   void handle_column(const ReferenceColumn& column, std::shared_ptr<ColumnVisitorContext> base_context) override;
 
  protected:
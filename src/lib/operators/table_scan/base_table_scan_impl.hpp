@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "storage/column_iterables.hpp"
+#include "storage/pos_list.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -24,6 +25,17 @@ class BaseTableScanImpl {
 
   virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) = 0;
 
+  /**
+   * Scans only the rows [begin_offset, end_offset) of the chunk, so that the TableScan can split large chunks into
+   * several jobs. Only called if can_scan_chunk_ranges() returns true, other impls are always given entire chunks.
+   */
+  virtual std::shared_ptr<PosList> scan_chunk_range(ChunkID chunk_id, ChunkOffset begin_offset,
+                                                    ChunkOffset end_offset) {
+    Fail("This table scan impl cannot scan parts of chunks");
+  }
+
+  virtual bool can_scan_chunk_ranges() const { return false; }
+
  protected:
   /**
    * @defgroup The hot loops of the table scan
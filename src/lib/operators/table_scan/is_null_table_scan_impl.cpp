@@ -1,5 +1,6 @@
 #include "is_null_table_scan_impl.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "storage/base_value_column.hpp"
@@ -52,6 +53,11 @@ void IsNullTableScanImpl::handle_column(const BaseValueColumn& base_column,
   DebugAssert(base_column.is_nullable(),
               "Columns that are not nullable should have been caught by edge case handling.");
 
+  if (!mapped_chunk_offsets) {
+    _scan_null_words(base_column.null_values(), *context);
+    return;
+  }
+
   auto base_column_iterable = NullValueVectorIterable{base_column.null_values()};
 
   base_column_iterable.with_iterators(mapped_chunk_offsets.get(),
@@ -94,7 +100,7 @@ bool IsNullTableScanImpl::_matches_all(const BaseValueColumn& column) {
       return false;
 
     case PredicateCondition::IsNotNull:
-      return !column.is_nullable();
+      return !column.contains_nulls();
 
     default:
       Fail("Unsupported comparison type encountered");
@@ -104,7 +110,7 @@ bool IsNullTableScanImpl::_matches_all(const BaseValueColumn& column) {
 bool IsNullTableScanImpl::_matches_none(const BaseValueColumn& column) {
   switch (_predicate_condition) {
     case PredicateCondition::IsNull:
-      return !column.is_nullable();
+      return !column.contains_nulls();
 
     case PredicateCondition::IsNotNull:
       return false;
@@ -130,4 +136,25 @@ void IsNullTableScanImpl::_add_all(Context& context, size_t column_size) {
   }
 }
 
+void IsNullTableScanImpl::_scan_null_words(const NullValueVector& null_values, Context& context) {
+  auto& matches_out = context._matches_out;
+  const auto chunk_id = context._chunk_id;
+  const auto size = null_values.size();
+  const auto match_nulls = _predicate_condition == PredicateCondition::IsNull;
+
+  for (auto word_index = size_t{0}; word_index < NullValueVector::word_count_for(size); ++word_index) {
+    // For IS NOT NULL, the word is inverted so that set bits are matches
+    const auto word = match_nulls ? null_values.word(word_index) : ~null_values.word(word_index);
+    if (word == 0u) continue;
+
+    const auto word_begin = word_index * NullValueVector::BITS_PER_WORD;
+    const auto word_end = std::min(word_begin + NullValueVector::BITS_PER_WORD, size);
+    for (auto chunk_offset = word_begin; chunk_offset < word_end; ++chunk_offset) {
+      if ((word >> (chunk_offset - word_begin)) & 1u) {
+        matches_out.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+      }
+    }
+  }
+}
+
 }  // namespace opossum
@@ -12,6 +12,7 @@ namespace opossum {
 
 class Table;
 class BaseValueColumn;
+class NullValueVector;
 
 class IsNullTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
@@ -41,6 +42,9 @@ class IsNullTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   void _add_all(Context& context, size_t column_size);
 
+  // Checks the null values word by word, skipping words without any match
+  void _scan_null_words(const NullValueVector& null_values, Context& context);
+
   /**@}*/
 
  private:
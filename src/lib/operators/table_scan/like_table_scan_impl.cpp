@@ -61,6 +61,9 @@ void LikeTableScanImpl::handle_column(const BaseDictionaryColumn& base_column,
   if (base_column.encoding_type() == EncodingType::Dictionary) {
     const auto& left_column = static_cast<const DictionaryColumn<std::string>&>(base_column);
     result = _find_matches_in_dictionary(*left_column.dictionary());
+  } else if (base_column.encoding_type() == EncodingType::FrontCodedDictionary) {
+    const auto& left_column = static_cast<const FrontCodedDictionaryColumn<std::string>&>(base_column);
+    result = _find_matches_in_dictionary(*left_column.front_coded_dictionary());
   } else {
     const auto& left_column = static_cast<const FixedStringDictionaryColumn<std::string>&>(base_column);
     result = _find_matches_in_dictionary(*left_column.dictionary());
@@ -110,15 +113,39 @@ std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_diction
   auto& count = result.first;
   auto& dictionary_matches = result.second;
 
+  dictionary_matches.resize(dictionary.size());
+  count = _matcher.match_all(dictionary, _invert_results, dictionary_matches);
+
+  return result;
+}
+
+std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_dictionary(
+    const FrontCodedStringVector& dictionary) {
+  auto result = std::pair<size_t, std::vector<bool>>{};
+
+  auto& count = result.first;
+  auto& dictionary_matches = result.second;
+
+  const auto prefix = _matcher.starts_with_prefix();
+  if (prefix) {
+    const auto [first, last] = dictionary.prefix_range(*prefix);
+
+    dictionary_matches.resize(dictionary.size(), _invert_results);
+    std::fill(dictionary_matches.begin() + first, dictionary_matches.begin() + last, !_invert_results);
+    count = _invert_results ? dictionary.size() - (last - first) : last - first;
+
+    return result;
+  }
+
   count = 0u;
   dictionary_matches.reserve(dictionary.size());
 
   _matcher.resolve(_invert_results, [&](const auto& matcher) {
-    for (const auto& value : dictionary) {
+    dictionary.for_each([&](const std::string& value) {
       const auto result = matcher(value);
       count += static_cast<size_t>(result);
       dictionary_matches.push_back(result);
-    }
+    });
   });
 
   return result;
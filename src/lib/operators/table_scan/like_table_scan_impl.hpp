@@ -15,6 +15,7 @@
 
 namespace opossum {
 
+class FrontCodedStringVector;
 class Table;
 
 /**
@@ -25,6 +26,8 @@ class Table;
  * - For dictionary columns, we check the values in the dictionary and store the results in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the column satisfy the expression.
+ * - Front-coded dictionaries are decoded block by block. For patterns of the form 'hello%', the matching values form
+ *   a contiguous range of the dictionary, which is found using binary search without decoding the dictionary.
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -57,6 +60,7 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
    * @returns number of matches and the result of each dictionary entry
    */
   std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const pmr_vector<std::string>& dictionary);
+  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const FrontCodedStringVector& dictionary);
 
   const LikeMatcher _matcher;
 
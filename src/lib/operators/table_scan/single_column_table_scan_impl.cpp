@@ -1,6 +1,8 @@
 #include "single_column_table_scan_impl.hpp"
 
+#include <array>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -8,19 +10,44 @@
 #include "storage/column_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/resolve_encoded_column_type.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Returns false if no value between minimum and maximum satisfies the predicate
+template <typename T>
+bool block_may_match(const PredicateCondition predicate_condition, const T minimum, const T maximum, const T value) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return minimum <= value && value <= maximum;
+    case PredicateCondition::LessThan:
+      return minimum < value;
+    case PredicateCondition::LessThanEquals:
+      return minimum <= value;
+    case PredicateCondition::GreaterThan:
+      return maximum > value;
+    case PredicateCondition::GreaterThanEquals:
+      return maximum >= value;
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
 SingleColumnTableScanImpl::SingleColumnTableScanImpl(const std::shared_ptr<const Table>& in_table,
                                                      const ColumnID left_column_id,
                                                      const PredicateCondition& predicate_condition,
                                                      const AllTypeVariant& right_value)
     : BaseSingleColumnTableScanImpl{in_table, left_column_id, predicate_condition}, _right_value{right_value} {}
 
-std::shared_ptr<PosList> SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
+std::shared_ptr<PosList> SingleColumnTableScanImpl::scan_chunk_range(ChunkID chunk_id, ChunkOffset begin_offset,
+                                                                     ChunkOffset end_offset) {
   // early outs for specific NULL semantics
   if (variant_is_null(_right_value)) {
     /**
@@ -32,7 +59,7 @@ std::shared_ptr<PosList> SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id)
     return std::make_shared<PosList>();
   }
 
-  return BaseSingleColumnTableScanImpl::scan_chunk(chunk_id);
+  return BaseSingleColumnTableScanImpl::scan_chunk_range(chunk_id, begin_offset, end_offset);
 }
 
 void SingleColumnTableScanImpl::handle_column(const BaseValueColumn& base_column,
@@ -73,6 +100,17 @@ void SingleColumnTableScanImpl::handle_column(const BaseEncodedColumn& base_colu
     using Type = typename decltype(type)::type;
 
     resolve_encoded_column_type<Type>(base_column, [&](const auto& typed_column) {
+      using ColumnType = std::decay_t<decltype(typed_column)>;
+
+      if constexpr (std::is_floating_point_v<Type>) {
+        if constexpr (std::is_same_v<ColumnType, AlpColumn<Type>>) {
+          if (!mapped_chunk_offsets) {
+            _scan_alp_column(typed_column, type_cast<Type>(_right_value), chunk_id, matches_out);
+            return;
+          }
+        }
+      }
+
       auto left_column_iterable = create_iterable_from_column(typed_column);
 
       left_column_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
@@ -142,6 +180,37 @@ void SingleColumnTableScanImpl::handle_column(const BaseDictionaryColumn& base_c
   });
 }
 
+template <typename T>
+void SingleColumnTableScanImpl::_scan_alp_column(const AlpColumn<T>& column, const T right_value,
+                                                 const ChunkID chunk_id, PosList& matches_out) const {
+  static constexpr auto block_size = AlpColumn<T>::block_size;
+
+  const auto& blocks = column.blocks();
+  const auto& null_values = column.null_values();
+
+  resolve_compressed_vector_type(column.offset_values(), [&](const auto& offset_values) {
+    auto decoder = offset_values.create_decoder();
+    auto values = std::array<T, block_size>{};
+
+    with_comparator(_predicate_condition, [&](auto comparator) {
+      for (auto block_index = size_t{0u}; block_index < blocks.size(); ++block_index) {
+        const auto& block = blocks[block_index];
+        if (!block_may_match(_predicate_condition, block.minimum, block.maximum, right_value)) continue;
+
+        const auto block_begin = static_cast<ChunkOffset>(block_index * block_size);
+        const auto block_row_count = column.decode_block(block_index, *decoder, values);
+
+        for (auto index = size_t{0u}; index < block_row_count; ++index) {
+          const auto chunk_offset = static_cast<ChunkOffset>(block_begin + index);
+          if (!null_values[chunk_offset] && comparator(values[index], right_value)) {
+            matches_out.push_back(RowID{chunk_id, chunk_offset});
+          }
+        }
+      }
+    });
+  });
+}
+
 ValueID SingleColumnTableScanImpl::_get_search_value_id(const BaseDictionaryColumn& column) const {
   switch (_predicate_condition) {
     case PredicateCondition::Equals:
@@ -8,6 +8,7 @@
 #include "base_single_column_table_scan_impl.hpp"
 
 #include "all_type_variant.hpp"
+#include "storage/alp_column.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -20,13 +21,15 @@ namespace opossum {
  * - For dictionary columns, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the column satisfy the expression.
+ * - ALP columns are scanned block by block. Blocks whose minimum and maximum rule out any match are skipped.
  */
 class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
   SingleColumnTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID left_column_id,
                             const PredicateCondition& predicate_condition, const AllTypeVariant& right_value);
 
-  std::shared_ptr<PosList> scan_chunk(ChunkID) override;
+  std::shared_ptr<PosList> scan_chunk_range(ChunkID chunk_id, ChunkOffset begin_offset,
+                                            ChunkOffset end_offset) override;
 
   void handle_column(const BaseValueColumn& base_column, std::shared_ptr<ColumnVisitorContext> base_context) override;
 
@@ -76,6 +79,10 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
   }
   /**@}*/
 
+  template <typename T>
+  void _scan_alp_column(const AlpColumn<T>& column, const T right_value, const ChunkID chunk_id,
+                        PosList& matches_out) const;
+
  private:
   const AllTypeVariant _right_value;
 };
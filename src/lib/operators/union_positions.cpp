@@ -127,6 +127,9 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
   const auto emit_chunk = [&]() {
     ChunkColumns output_columns;
 
+    // The rows are emitted in the order of the ReferenceMatrices, which are sorted by their first column segment
+    pos_lists.front()->guarantee_grouped_by_chunk();
+
     for (size_t pos_lists_idx = 0; pos_lists_idx < pos_lists.size(); ++pos_lists_idx) {
       const auto segment_column_id_begin = _column_segment_offsets[pos_lists_idx];
       const auto segment_column_id_end = pos_lists_idx >= _column_segment_offsets.size() - 1
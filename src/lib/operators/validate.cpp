@@ -1,11 +1,13 @@
 #include "validate.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/job_granularity.hpp"
 #include "storage/reference_column.hpp"
 #include "utils/assert.hpp"
 
@@ -15,9 +17,11 @@ namespace {
 
 bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
                     const MvccColumns& columns) {
-  const auto row_tid = columns.tids[chunk_offset].load();
-  const auto begin_cid = columns.begin_cids[chunk_offset];
-  const auto end_cid = columns.end_cids[chunk_offset];
+  // The vectors of the dense representation are accessed directly, as this is Validate's inner loop
+  const auto compact = columns.is_compact();
+  const auto row_tid = compact ? columns.tid(chunk_offset) : columns.tids[chunk_offset].load();
+  const auto begin_cid = compact ? columns.begin_cid(chunk_offset) : columns.begin_cids[chunk_offset];
+  const auto end_cid = compact ? columns.end_cid(chunk_offset) : columns.end_cids[chunk_offset];
 
   // Taken from: https://github.com/hyrise/hyrise/blob/master/docs/documentation/queryexecution/tx.rst
   // auto own_insert = (our_tid == row_tid) && !(snapshot_commit_id >= begin_cid) && !(snapshot_commit_id >= end_cid);
@@ -28,6 +32,16 @@ bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset c
   return snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
 }
 
+// The MVCC columns of a chunk referenced by the input, locked while Validate processes the positions referencing it
+struct ReferencedChunk {
+  ReferencedChunk(SharedScopedLockingPtr<const MvccColumns>&& mvcc_columns, CommitID snapshot_commit_id)
+      : mvcc_columns(std::move(mvcc_columns)),
+        all_rows_visible(this->mvcc_columns->all_rows_visible(snapshot_commit_id)) {}
+
+  SharedScopedLockingPtr<const MvccColumns> mvcc_columns;
+  bool all_rows_visible;
+};
+
 }  // namespace
 
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
@@ -56,66 +70,118 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    const auto chunk_in = in_table->get_chunk(chunk_id);
-
-    ChunkColumns output_columns;
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in->get_column(ColumnID{0}));
-
-    // If the columns in this chunk reference a column, build a poslist for a reference column.
-    if (ref_col_in) {
-      DebugAssert(chunk_in->references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
-
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_col_in->referenced_table();
-      DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC columns");
-
-      for (auto row_id : *ref_col_in->pos_list()) {
-        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+  // Large chunks are split, so that even tables with few chunks can be validated by all workers. Each morsel results in
+  // an output chunk of its own. These are appended in the order of the morsels afterwards.
+  const auto batches = JobGranularity::plan_jobs(JobGranularity::chunks_of(*in_table), SplitChunks::Yes);
+  auto output_chunks_by_batch = std::vector<std::vector<ChunkColumns>>(batches.size());
+
+  JobGranularity::execute_jobs(batches.size(), [&](const size_t batch_idx) {
+    for (const auto& morsel : batches[batch_idx]) {
+      const auto chunk_id = morsel.chunk_id;
+      const auto chunk_in = in_table->get_chunk(chunk_id);
+
+      ChunkColumns output_columns;
+      auto pos_list_out = std::make_shared<PosList>();
+      auto referenced_table = std::shared_ptr<const Table>();
+      const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in->get_column(ColumnID{0}));
+
+      // If the columns in this chunk reference a column, build a poslist for a reference column.
+      if (ref_col_in) {
+        DebugAssert(chunk_in->references_exactly_one_table(),
+                    "Input to Validate contains a Chunk referencing more than one table.");
+
+        // Check all rows in the old poslist and put them in pos_list_out if they are visible.
+        referenced_table = ref_col_in->referenced_table();
+        DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC columns");
+
+        // Only the chunk referenced by the current position is locked and checked for the fast path. This happens
+        // whenever the referenced chunk changes, i.e., once per morsel for PosLists that reference a single chunk and
+        // once per chunk for PosLists that are grouped by chunk.
+        auto referenced_chunk = std::optional<ReferencedChunk>{};
+        auto referenced_chunk_id = INVALID_CHUNK_ID;
+
+        // pos_list_out is only materialized once the first invisible row is found. Until then, all rows of the morsel
+        // that were checked are visible, and they are pos_list_in[morsel.begin_offset, chunk_offset).
+        const auto& pos_list_in = *ref_col_in->pos_list();
+        auto all_rows_visible = true;
+
+        for (auto chunk_offset = morsel.begin_offset; chunk_offset < morsel.end_offset; ++chunk_offset) {
+          const auto row_id = pos_list_in[chunk_offset];
+
+          if (row_id.chunk_id != referenced_chunk_id) {
+            // Releases the lock on the previously referenced chunk
+            referenced_chunk.reset();
+            const auto& chunk = *referenced_table->get_chunk(row_id.chunk_id);
+            referenced_chunk.emplace(chunk.get_scoped_mvcc_columns_lock(), snapshot_commit_id);
+            referenced_chunk_id = row_id.chunk_id;
+          }
+
+          if (referenced_chunk->all_rows_visible ||
+              is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *referenced_chunk->mvcc_columns)) {
+            if (!all_rows_visible) pos_list_out->emplace_back(row_id);
+          } else if (all_rows_visible) {
+            all_rows_visible = false;
+            pos_list_out->assign(pos_list_in.begin() + morsel.begin_offset, pos_list_in.begin() + chunk_offset);
+          }
+        }
 
-        auto mvcc_columns = referenced_chunk->get_scoped_mvcc_columns_lock();
+        if (all_rows_visible) {
+          // If the entire input chunk is visible, it is passed on unmodified, without creating a new PosList
+          if (morsel.size() == chunk_in->size()) {
+            if (morsel.size() > 0) output_chunks_by_batch[batch_idx].emplace_back(chunk_in->columns());
+            continue;
+          }
 
-        if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_columns)) {
-          pos_list_out->emplace_back(row_id);
+          pos_list_out->assign(pos_list_in.begin() + morsel.begin_offset, pos_list_in.begin() + morsel.end_offset);
+        }
+        pos_list_out->inherit_guarantees(pos_list_in);
+
+        // Construct the actual ReferenceColumn objects and add them to the chunk.
+        for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+          const auto column = std::static_pointer_cast<const ReferenceColumn>(chunk_in->get_column(column_id));
+          const auto referenced_column_id = column->referenced_column_id();
+          auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, pos_list_out);
+          output_columns.push_back(ref_col_out);
         }
-      }
 
-      // Construct the actual ReferenceColumn objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto column = std::static_pointer_cast<const ReferenceColumn>(chunk_in->get_column(column_id));
-        const auto referenced_column_id = column->referenced_column_id();
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, pos_list_out);
-        output_columns.push_back(ref_col_out);
-      }
+        // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
+      } else {
+        referenced_table = in_table;
+        DebugAssert(chunk_in->has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
+        const auto mvcc_columns = chunk_in->get_scoped_mvcc_columns_lock();
+
+        // Generate pos_list_out.
+        const auto end_offset = morsel.end_offset;  // The compiler fails to optimize this in the for clause :(
+        if (mvcc_columns->all_rows_visible(snapshot_commit_id)) {
+          *pos_list_out = PosList::chunk_range(chunk_id, morsel.begin_offset, end_offset);
+        } else {
+          for (auto i = morsel.begin_offset; i < end_offset; i++) {
+            if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_columns)) {
+              pos_list_out->emplace_back(RowID{chunk_id, i});
+            }
+          }
+          pos_list_out->guarantee_single_chunk();
+        }
 
-      // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
-    } else {
-      referenced_table = in_table;
-      DebugAssert(chunk_in->has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
-      const auto mvcc_columns = chunk_in->get_scoped_mvcc_columns_lock();
-
-      // Generate pos_list_out.
-      auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-      for (auto i = 0u; i < chunk_size; i++) {
-        if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_columns)) {
-          pos_list_out->emplace_back(RowID{chunk_id, i});
+        // Create actual ReferenceColumn objects.
+        for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+          auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list_out);
+          output_columns.push_back(ref_col_out);
         }
       }
 
-      // Create actual ReferenceColumn objects.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list_out);
-        output_columns.push_back(ref_col_out);
+      if (!pos_list_out->empty()) {
+        output_chunks_by_batch[batch_idx].emplace_back(std::move(output_columns));
       }
     }
+  });
 
-    if (!pos_list_out->empty() > 0) {
+  for (const auto& output_chunks : output_chunks_by_batch) {
+    for (const auto& output_columns : output_chunks) {
       output->append_chunk(output_columns);
     }
   }
+
   return output;
 }
 
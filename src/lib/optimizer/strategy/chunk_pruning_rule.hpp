@@ -19,6 +19,9 @@ class PredicateNode;
  * This rule determines which chunks can be excluded from table scans based on
  * the predicates present in the LQP and stores that information in the stored
  * table nodes.
+ *
+ * The filters of the ChunkStatistics that are consulted are built when a chunk is encoded. Besides min/max values
+ * and ranges, they include bloom filters (for Equals) and, for string columns, prefix filters (for LIKE 'abc%').
  */
 class ChunkPruningRule : public AbstractRule {
  public:
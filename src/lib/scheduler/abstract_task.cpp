@@ -7,11 +7,35 @@
 
 #include "abstract_scheduler.hpp"
 #include "current_scheduler.hpp"
+#include "task_group.hpp"
 #include "task_queue.hpp"
 #include "worker.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+// The TaskGroup of the Task that is currently executed by this thread, inherited by the Tasks it schedules
+thread_local std::shared_ptr<opossum::TaskGroup> this_thread_task_group;
+
+// Installs the TaskGroup of a Task for as long as it is executed and restores the previous one afterwards, even if the
+// Task throws. Otherwise, Tasks scheduled later on this thread would inherit a foreign group.
+class ScopedThisThreadTaskGroup final {
+ public:
+  explicit ScopedThisThreadTaskGroup(const std::shared_ptr<opossum::TaskGroup>& task_group)
+      : _previous_task_group(std::exchange(this_thread_task_group, task_group)) {}
+
+  ~ScopedThisThreadTaskGroup() { this_thread_task_group = std::move(_previous_task_group); }
+
+  ScopedThisThreadTaskGroup(const ScopedThisThreadTaskGroup&) = delete;
+  ScopedThisThreadTaskGroup& operator=(const ScopedThisThreadTaskGroup&) = delete;
+
+ private:
+  std::shared_ptr<opossum::TaskGroup> _previous_task_group;
+};
+
+}  // namespace
+
 namespace opossum {
 
 AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
@@ -50,6 +74,14 @@ void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
 bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
 
+void AbstractTask::set_task_group(const std::shared_ptr<TaskGroup>& task_group) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the TaskGroup after the Task was scheduled");
+
+  _task_group = task_group;
+}
+
+const std::shared_ptr<TaskGroup>& AbstractTask::task_group() const { return _task_group; }
+
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
   DebugAssert((!_is_scheduled), "Possible race: Don't set callback after the Task was scheduled");
 
@@ -57,6 +89,8 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
 }
 
 void AbstractTask::schedule(NodeID preferred_node_id) {
+  if (!_task_group) _task_group = this_thread_task_group;
+
   _mark_as_scheduled();
 
   if (CurrentScheduler::is_set()) {
@@ -90,11 +124,21 @@ void AbstractTask::_join_without_replacement_worker() {
   _done_condition_variable.wait(lock, [&]() { return static_cast<bool>(_done); });
 }
 
+bool AbstractTask::_join_for(std::chrono::microseconds timeout) {
+  std::unique_lock<std::mutex> lock(_done_mutex);
+  return _done_condition_variable.wait_for(lock, timeout, [&]() { return static_cast<bool>(_done); });
+}
+
 void AbstractTask::execute() {
-  DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
+  [[gnu::unused]] auto already_started = _started.exchange(true);
+  DebugAssert(!already_started, "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  // Tasks might be executed while another Task waits on the same thread, see Worker::_wait_for_tasks()
+  {
+    const auto scoped_task_group = ScopedThisThreadTaskGroup{_task_group};
+    _on_execute();
+  }
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
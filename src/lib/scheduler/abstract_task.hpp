@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -12,6 +13,7 @@
 
 namespace opossum {
 
+class TaskGroup;
 class Worker;
 
 /**
@@ -79,6 +81,13 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The TaskGroup determines how the Task is prioritized against the Tasks of other queries. If no group is set when
+   * the Task is scheduled, it inherits the group of the Task that is being executed by the current thread (if any).
+   */
+  void set_task_group(const std::shared_ptr<TaskGroup>& task_group);
+  const std::shared_ptr<TaskGroup>& task_group() const;
+
   /**
    * Callback to be executed right after the Task finished.
    * Notice the execution of the callback might happen on ANY thread
@@ -92,8 +101,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   /**
    * Waits for the Task to finish
-   * If the Task is being executed on a Worker, allow another Worker to run on the CPU while waiting for this task to
-   * finish
+   * If the Task is being executed on a Worker, that Worker executes other Tasks while waiting for this task to finish
    */
   void join();
 
@@ -128,6 +136,12 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void _join_without_replacement_worker();
 
+  /**
+   * Blocks the calling thread until the Task finished executing or the timeout expired
+   * @return The Task finished executing
+   */
+  bool _join_for(std::chrono::microseconds timeout);
+
   /**
    * Called by a dependency when it finished execution
    */
@@ -137,6 +151,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   NodeID _node_id = INVALID_NODE_ID;
   SchedulePriority _priority;
   bool _stealable;
+  std::shared_ptr<TaskGroup> _task_group;
   std::atomic_bool _done{false};
   std::function<void()> _done_callback;
 
@@ -158,7 +173,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   // Purely for debugging purposes, in order to be able to identify tasks after they have been scheduled
   std::string _description;
 
-  // To make sure a task is never executed twice
+  // To make sure a task is never executed twice. Also tells a waiting Worker whether the task is executed elsewhere.
   std::atomic_bool _started{false};
 };
 
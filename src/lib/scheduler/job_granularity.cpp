@@ -0,0 +1,113 @@
+#include "job_granularity.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "current_scheduler.hpp"
+#include "job_task.hpp"
+#include "storage/table.hpp"
+#include "topology.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+size_t Morsel::size() const { return end_offset - begin_offset; }
+
+size_t JobGranularity::target_rows_per_job(size_t row_count) {
+  if (!CurrentScheduler::is_set()) return std::max(row_count, size_t{1});
+
+  const auto job_count = std::max(Topology::get().num_cpus(), size_t{1}) * JOBS_PER_WORKER;
+  return std::clamp(row_count / job_count, MIN_ROWS_PER_JOB, MAX_ROWS_PER_JOB);
+}
+
+std::vector<Morsel> JobGranularity::chunks_of(const Table& table) {
+  auto morsels = std::vector<Morsel>{};
+  morsels.reserve(table.chunk_count());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    morsels.emplace_back(Morsel{chunk_id, ChunkOffset{0}, table.get_chunk(chunk_id)->size()});
+  }
+
+  return morsels;
+}
+
+std::vector<Morsel> JobGranularity::chunks_of(const Table& table, const std::vector<ChunkID>& chunk_ids) {
+  auto morsels = std::vector<Morsel>{};
+  morsels.reserve(chunk_ids.size());
+
+  for (const auto chunk_id : chunk_ids) {
+    morsels.emplace_back(Morsel{chunk_id, ChunkOffset{0}, table.get_chunk(chunk_id)->size()});
+  }
+
+  return morsels;
+}
+
+std::vector<MorselBatch> JobGranularity::plan_jobs(const std::vector<Morsel>& morsels, SplitChunks split_chunks,
+                                                   size_t target_rows_per_job) {
+  DebugAssert(target_rows_per_job > 0, "Jobs need to process at least one row");
+
+  auto batches = std::vector<MorselBatch>{};
+  auto batch = MorselBatch{};
+  auto batch_row_count = size_t{0};
+
+  const auto finish_batch = [&]() {
+    if (batch.empty()) return;
+    batches.emplace_back(std::move(batch));
+    batch = MorselBatch{};
+    batch_row_count = 0;
+  };
+
+  for (const auto& morsel : morsels) {
+    const auto row_count = morsel.size();
+
+    if (split_chunks == SplitChunks::Yes && row_count > target_rows_per_job) {
+      finish_batch();
+
+      const auto part_count = (row_count + target_rows_per_job - 1) / target_rows_per_job;
+      for (auto part_idx = size_t{0}; part_idx < part_count; ++part_idx) {
+        const auto begin_offset = static_cast<ChunkOffset>(morsel.begin_offset + row_count * part_idx / part_count);
+        const auto end_offset = static_cast<ChunkOffset>(morsel.begin_offset + row_count * (part_idx + 1) / part_count);
+        batches.emplace_back(MorselBatch{Morsel{morsel.chunk_id, begin_offset, end_offset}});
+      }
+      continue;
+    }
+
+    batch.emplace_back(morsel);
+    batch_row_count += row_count;
+    if (batch_row_count >= target_rows_per_job) finish_batch();
+  }
+  finish_batch();
+
+  return batches;
+}
+
+std::vector<MorselBatch> JobGranularity::plan_jobs(const std::vector<Morsel>& morsels, SplitChunks split_chunks) {
+  auto row_count = size_t{0};
+  for (const auto& morsel : morsels) {
+    row_count += morsel.size();
+  }
+
+  return plan_jobs(morsels, split_chunks, target_rows_per_job(row_count));
+}
+
+void JobGranularity::execute_jobs(size_t job_count, const std::function<void(size_t)>& job) {
+  if (job_count == 1 || !CurrentScheduler::is_set()) {
+    for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+      job(job_idx);
+    }
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+
+  for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&job, job_idx]() { job(job_idx); }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * A range of rows of a chunk. Either covers the entire chunk or a part of a chunk that was split.
+ */
+struct Morsel final {
+  size_t size() const;
+
+  ChunkID chunk_id;
+  ChunkOffset begin_offset;
+  ChunkOffset end_offset;
+};
+
+// The morsels that are processed by a single job
+using MorselBatch = std::vector<Morsel>;
+
+enum class SplitChunks : bool { No = false, Yes = true };
+
+/**
+ * Decides how operators split their work into JobTasks. One JobTask per chunk results in many tiny tasks for tables
+ * with small chunks, whose scheduling overhead dominates, and in too few tasks to use all cores for tables with few
+ * large chunks. Instead, consecutive chunks are batched until a job covers target_rows_per_job() rows. Operators
+ * that can process parts of a chunk (SplitChunks::Yes) additionally get large chunks split by offset range.
+ *
+ * Usage example:
+ *
+ *   const auto batches = JobGranularity::plan_jobs(JobGranularity::chunks_of(*table), SplitChunks::No);
+ *   JobGranularity::execute_jobs(batches.size(), [&](const size_t batch_idx) {
+ *     for (const auto& morsel : batches[batch_idx]) { ... }
+ *   });
+ *
+ * or, if the chunks are processed independently of each other:
+ *
+ *   JobGranularity::for_each_chunk(JobGranularity::chunks_of(*table), [&](const ChunkID chunk_id) { ... });
+ *
+ * The constants were determined with the JobGranularity benchmarks (see job_granularity_benchmark.cpp).
+ */
+class JobGranularity final {
+ public:
+  // Below this, scheduling a JobTask costs more than the work it does
+  static constexpr size_t MIN_ROWS_PER_JOB = 16'384;
+
+  // Above this, a job blocks its worker for so long that short queries have to wait for it
+  static constexpr size_t MAX_ROWS_PER_JOB = 1'048'576;
+
+  // More jobs than workers, so that workers that finish early can steal the remaining jobs
+  static constexpr size_t JOBS_PER_WORKER = 4;
+
+  /**
+   * @return The number of rows a job should process when row_count rows are distributed over the workers. Without a
+   *         scheduler, all rows are processed by a single job.
+   */
+  static size_t target_rows_per_job(size_t row_count);
+
+  /**
+   * @return One Morsel per chunk, covering the entire chunk
+   */
+  static std::vector<Morsel> chunks_of(const Table& table);
+  static std::vector<Morsel> chunks_of(const Table& table, const std::vector<ChunkID>& chunk_ids);
+
+  /**
+   * Batches consecutive morsels until a batch holds at least target_rows_per_job rows. With SplitChunks::Yes, morsels
+   * of more than target_rows_per_job rows are split into evenly sized parts, each of which forms a batch of its own.
+   * The order of the morsels is retained, i.e., concatenating the batches yields the (split) input morsels.
+   */
+  static std::vector<MorselBatch> plan_jobs(const std::vector<Morsel>& morsels, SplitChunks split_chunks,
+                                            size_t target_rows_per_job);
+
+  /**
+   * Same as above, with target_rows_per_job() for the total number of rows of the morsels
+   */
+  static std::vector<MorselBatch> plan_jobs(const std::vector<Morsel>& morsels, SplitChunks split_chunks);
+
+  /**
+   * Calls job(job_idx) for every job_idx in [0, job_count) and returns once all of them are done. Jobs are executed
+   * in JobTasks if there is more than one of them and a scheduler is set. Otherwise, they are executed right away on
+   * the calling thread.
+   */
+  static void execute_jobs(size_t job_count, const std::function<void(size_t)>& job);
+
+  /**
+   * Calls functor(chunk_id) for every chunk in chunks, in jobs of batched chunks
+   */
+  template <typename Functor>
+  static void for_each_chunk(const std::vector<Morsel>& chunks, const Functor& functor) {
+    const auto batches = plan_jobs(chunks, SplitChunks::No);
+    execute_jobs(batches.size(), [&](const size_t batch_idx) {
+      for (const auto& morsel : batches[batch_idx]) {
+        functor(morsel.chunk_id);
+      }
+    });
+  }
+};
+
+}  // namespace opossum
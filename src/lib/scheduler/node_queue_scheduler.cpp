@@ -11,6 +11,7 @@
 #include "processing_unit.hpp"
 #include "task_queue.hpp"
 #include "topology.hpp"
+#include "worker.hpp"
 
 #include "uid_allocator.hpp"
 #include "utils/assert.hpp"
@@ -76,6 +77,10 @@ void NodeQueueScheduler::finish() {
     processing_unit->shutdown();
   }
 
+  for (auto& queue : _queues) {
+    queue->notify_all_idle_workers();
+  }
+
   for (auto& processing_unit : _processing_units) {
     processing_unit->join();
   }
@@ -89,6 +94,10 @@ void NodeQueueScheduler::finish() {
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<ProcessingUnit>>& NodeQueueScheduler::processing_units() const {
+  return _processing_units;
+}
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -102,9 +111,18 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
-  // Lookup node id for current worker.
+  const auto worker = Worker::get_this_thread_worker();
+
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
+    // JobTasks spawned by a task go into the local deque of the worker executing it, where they are likely to find the
+    // data of the spawning task in the caches. Idle workers steal them from there.
+    if (worker && priority == SchedulePriority::JobTask && task->is_stealable()) {
+      worker->_push_local_task(task);
+      if (!worker->queue()->notify_idle_worker()) _notify_idle_worker_of_other_node(worker->queue());
+      return;
+    }
+
+    // Lookup node id for current worker.
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -118,5 +136,16 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   auto queue = _queues[preferred_node_id];
   queue->push(task, static_cast<uint32_t>(priority));
+
+  // push() wakes up a parked worker of the preferred node. If there is none, all of them are busy. In that case, wake
+  // up a parked worker of another node so that it can steal the task right away.
+  if (task->is_stealable() && !queue->has_idle_workers()) _notify_idle_worker_of_other_node(queue);
+}
+
+void NodeQueueScheduler::_notify_idle_worker_of_other_node(const std::shared_ptr<TaskQueue>& queue) const {
+  for (const auto& other_queue : _queues) {
+    if (other_queue != queue && other_queue->notify_idle_worker()) break;
+  }
 }
+
 }  // namespace opossum
@@ -56,18 +56,17 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Work stealing is useful to avoid idle workers (and therefore idle CPUs) while there are still tasks in the system
+ * that need to be processed. Besides the TaskQueue of its node, every worker owns a lock-free deque
+ * (WorkStealingDeque) that holds the JobTasks spawned by the tasks it executes. A worker first takes the task it
+ * spawned most recently from its deque (LIFO), as its data is likely still cached. Every TASK_QUEUE_POLL_INTERVAL
+ * tasks, or when the deque is empty, it pulls from the TaskQueue, which decides between the queries (TaskGroups).
+ * If it does not find a task this way, the worker becomes a thief and takes the oldest task (FIFO) from a victim:
+ *  1) the deques of the other workers of the same node
+ *  2) the TaskQueues (only stealable tasks) and the worker deques of the other nodes
+ * The victims within a node as well as the other nodes are visited in a random order, so that idle workers do not all
+ * contend for the same victim. Other nodes are only visited afterwards, because accessing a remote node is ~1.6 times
+ * slower than accessing a local node. [1]
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -94,6 +93,8 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<ProcessingUnit>>& processing_units() const;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
@@ -103,6 +104,9 @@ class NodeQueueScheduler : public AbstractScheduler {
                 SchedulePriority priority = SchedulePriority::Default) override;
 
  private:
+  // Wakes up a parked worker of any node but the one of the given queue
+  void _notify_idle_worker_of_other_node(const std::shared_ptr<TaskQueue>& queue) const;
+
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
@@ -1,17 +1,72 @@
 #include "operator_task.hpp"
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "concurrency/transaction_manager.hpp"
 
+#include "expression/expression_utils.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 
+#include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/processing_unit.hpp"
 #include "scheduler/worker.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Operators that produce their output chunk by chunk, independently of the other chunks of their input
+bool is_pipelineable(const AbstractOperator& op) {
+  switch (op.type()) {
+    case OperatorType::Validate:
+    case OperatorType::TableScan:
+      return true;
+
+    case OperatorType::Projection: {
+      // Subselects would be executed once per morsel
+      auto contains_subselect = false;
+      for (auto expression : static_cast<const Projection&>(op).expressions) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          if (sub_expression->type == ExpressionType::PQPSelect) contains_subselect = true;
+          return ExpressionVisitation::VisitArguments;
+        });
+      }
+      return !contains_subselect;
+    }
+
+    default:
+      return false;
+  }
+}
+
+// Counts how many operators use each operator as their input. Operators with more than one consumer (i.e., diamonds
+// in the PQP) need to be materialized.
+void count_consumers(const std::shared_ptr<AbstractOperator>& op,
+                     std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts,
+                     std::unordered_set<std::shared_ptr<AbstractOperator>>& visited_ops) {
+  if (!visited_ops.emplace(op).second) return;
+
+  for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+    if (!input) continue;
+    ++consumer_counts[input];
+    count_consumers(input, consumer_counts, visited_ops);
+  }
+}
+
+}  // namespace
 
 namespace opossum {
 OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op, CleanupTemporaries cleanup_temporaries,
@@ -23,30 +78,66 @@ std::string OperatorTask::description() const {
 }
 
 const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
-    const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries) {
+    const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries,
+    ExecutionMode execution_mode) {
+  std::unordered_map<std::shared_ptr<AbstractOperator>, size_t> consumer_counts;
+  if (execution_mode == ExecutionMode::MorselDriven) {
+    std::unordered_set<std::shared_ptr<AbstractOperator>> visited_ops;
+    count_consumers(op, consumer_counts, visited_ops);
+  }
+
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries);
+  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries, execution_mode, consumer_counts);
   return tasks;
 }
 
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
     std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-    CleanupTemporaries cleanup_temporaries) {
+    CleanupTemporaries cleanup_temporaries, ExecutionMode execution_mode,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
 
   const auto task = std::make_shared<OperatorTask>(op, cleanup_temporaries);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries);
+  // Collect the chain of pipelineable operators below op, top-down. An operator is only added if op's chain is its
+  // sole consumer. Excluded chunks of a TableScan refer to the chunks of its input, so it has to be the chain's first
+  // operator.
+  auto pipeline = std::vector<std::shared_ptr<AbstractOperator>>{};
+  if (execution_mode == ExecutionMode::MorselDriven && is_pipelineable(*op)) {
+    pipeline.emplace_back(op);
+
+    while (true) {
+      const auto& last_op = pipeline.back();
+      const auto table_scan = std::dynamic_pointer_cast<const TableScan>(last_op);
+      if (table_scan && !table_scan->excluded_chunk_ids().empty()) break;
+
+      const auto input = last_op->mutable_input_left();
+      if (!input || !is_pipelineable(*input) || consumer_counts.at(input) > 1) break;
+
+      pipeline.emplace_back(input);
+    }
+  }
+
+  // A single operator gains nothing from being executed as a pipeline
+  auto left = op->mutable_input_left();
+  if (pipeline.size() > 1) {
+    left = pipeline.back()->mutable_input_left();
+    task->_pipeline.assign(pipeline.rbegin(), pipeline.rend());
+  }
+
+  if (left) {
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries,
+                                                               execution_mode, consumer_counts);
     subtree_root->set_as_predecessor_of(task);
   }
 
   if (auto right = op->mutable_input_right()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries);
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries,
+                                                               execution_mode, consumer_counts);
     subtree_root->set_as_predecessor_of(task);
   }
 
@@ -58,6 +149,8 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
 
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
+const std::vector<std::shared_ptr<AbstractOperator>>& OperatorTask::pipeline() const { return _pipeline; }
+
 void OperatorTask::_on_execute() {
   auto context = _op->transaction_context();
   if (context) {
@@ -82,7 +175,11 @@ void OperatorTask::_on_execute() {
     }
   }
 
-  _op->execute();
+  if (_pipeline.empty()) {
+    _op->execute();
+  } else {
+    _execute_pipeline();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
@@ -115,4 +212,141 @@ void OperatorTask::_on_execute() {
     }
   }
 }
+
+void OperatorTask::_execute_pipeline() {
+  Timer performance_timer;
+
+  const auto input_table = _pipeline.front()->input_table_left();
+  const auto transaction_context = _op->transaction_context();
+
+  auto excluded_chunk_ids = std::unordered_set<ChunkID>{};
+  if (const auto table_scan = std::dynamic_pointer_cast<const TableScan>(_pipeline.front())) {
+    excluded_chunk_ids.insert(table_scan->excluded_chunk_ids().begin(), table_scan->excluded_chunk_ids().end());
+  }
+
+  auto morsel_outputs = std::vector<std::shared_ptr<const Table>>(input_table->chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(input_table->chunk_count() - excluded_chunk_ids.size());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    if (excluded_chunk_ids.count(chunk_id)) continue;
+
+    auto job_task = std::make_shared<JobTask>([&, chunk_id]() {
+      morsel_outputs[chunk_id] = _execute_pipeline_on_morsel(input_table, chunk_id, transaction_context);
+    });
+    jobs.emplace_back(job_task);
+    job_task->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // Just like AbstractOperator::execute(), do not produce an output if the transaction was aborted
+  if (transaction_context && transaction_context->aborted()) return;
+
+  // The layout of the output is taken from any of the morsels' outputs
+  auto layout_iter = std::find_if(morsel_outputs.begin(), morsel_outputs.end(),
+                                  [](const auto& morsel_output) { return morsel_output != nullptr; });
+  const auto layout_table = layout_iter != morsel_outputs.end()
+                                ? *layout_iter
+                                : _execute_pipeline_on_morsel(input_table, std::nullopt, transaction_context);
+  if (!layout_table) return;
+
+  const auto output_table = std::make_shared<Table>(layout_table->column_definitions(), layout_table->type(),
+                                                    layout_table->max_chunk_size());
+
+  // Morsels were processed in parallel, but are appended in the order of the input chunks
+  for (const auto& morsel_output : morsel_outputs) {
+    if (!morsel_output) continue;
+
+    for (const auto& chunk : morsel_output->chunks()) {
+      output_table->append_chunk(chunk->columns());
+      output_table->get_chunk(static_cast<ChunkID>(output_table->chunk_count() - 1))
+          ->set_mvcc_columns(chunk->mvcc_columns());
+    }
+  }
+
+  _op->_output = output_table;
+  _op->_performance_data->walltime = performance_timer.lap();
+}
+
+std::shared_ptr<const Table> OperatorTask::_execute_pipeline_on_morsel(
+    const std::shared_ptr<const Table>& input_table, const std::optional<ChunkID>& chunk_id,
+    const std::shared_ptr<TransactionContext>& transaction_context) const {
+  /**
+   * The morsel is a table that contains only a single chunk of the input table. As the chunk is shared, the operators
+   * do not modify it. If the input table contains data, the ReferenceColumns created by the operators point to the
+   * morsel and its first chunk, which is fixed below.
+   */
+  auto morsel = std::shared_ptr<Table>{};
+  if (chunk_id) {
+    const auto chunk = std::const_pointer_cast<Chunk>(input_table->get_chunk(*chunk_id));
+    const auto use_mvcc = chunk->has_mvcc_columns() ? UseMvcc::Yes : UseMvcc::No;
+    morsel = std::make_shared<Table>(input_table->column_definitions(), input_table->type(),
+                                     input_table->max_chunk_size(), use_mvcc);
+    morsel->append_chunk(chunk);
+  } else {
+    morsel = std::make_shared<Table>(input_table->column_definitions(), input_table->type(),
+                                     input_table->max_chunk_size());
+  }
+
+  auto input = std::shared_ptr<AbstractOperator>{std::make_shared<TableWrapper>(morsel)};
+  input->execute();
+
+  for (const auto& op : _pipeline) {
+    const auto copied_op = op->_on_deep_copy(input, nullptr);
+    if (transaction_context) copied_op->set_transaction_context(transaction_context);
+
+    copied_op->execute();
+    if (!copied_op->get_output()) return nullptr;
+
+    input = copied_op;
+  }
+
+  const auto morsel_output = input->get_output();
+  if (!chunk_id || input_table->type() != TableType::Data) return morsel_output;
+
+  // Let the ReferenceColumns point to the input table instead of the morsel. Position lists that are shared between
+  // columns remain shared.
+  const auto output = std::make_shared<Table>(morsel_output->column_definitions(), morsel_output->type(),
+                                              morsel_output->max_chunk_size());
+  for (const auto& chunk : morsel_output->chunks()) {
+    auto remapped_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>>{};
+
+    ChunkColumns output_columns;
+    for (const auto& column : chunk->columns()) {
+      const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+      if (!reference_column || reference_column->referenced_table() != morsel) {
+        output_columns.emplace_back(column);
+        continue;
+      }
+
+      auto& remapped_pos_list = remapped_pos_lists[reference_column->pos_list()];
+      if (!remapped_pos_list) {
+        const auto& morsel_pos_list = *reference_column->pos_list();
+        if (morsel_pos_list.is_chunk_range()) {
+          // A chunk range stays one, e.g., when a TableScan or Validate found all rows of the morsel to match
+          const auto begin_offset = morsel_pos_list.empty() ? ChunkOffset{0} : morsel_pos_list.front().chunk_offset;
+          remapped_pos_list = std::make_shared<PosList>(PosList::chunk_range(
+              *chunk_id, begin_offset, static_cast<ChunkOffset>(begin_offset + morsel_pos_list.size())));
+        } else {
+          auto pos_list = std::make_shared<PosList>(morsel_pos_list);
+          for (auto& row_id : *pos_list) {
+            if (!row_id.is_null()) row_id.chunk_id = *chunk_id;
+          }
+          remapped_pos_list = pos_list;
+        }
+      }
+
+      output_columns.emplace_back(std::make_shared<ReferenceColumn>(
+          input_table, reference_column->referenced_column_id(), remapped_pos_list));
+    }
+
+    output->append_chunk(output_columns);
+    output->get_chunk(static_cast<ChunkID>(output->chunk_count() - 1))->set_mvcc_columns(chunk->mvcc_columns());
+  }
+
+  return output;
+}
+
 }  // namespace opossum
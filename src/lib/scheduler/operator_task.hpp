@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -9,6 +10,8 @@
 namespace opossum {
 
 class AbstractOperator;
+class Table;
+class TransactionContext;
 
 /**
  * Makes an AbstractOperator scheduleable
@@ -21,12 +24,25 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively from result operator and set task dependencies automatically.
+   *
+   * With ExecutionMode::MorselDriven, chains of operators that process their input chunk by chunk (Validate,
+   * TableScan, Projection) are fused into a single task. That task pushes every chunk (morsel) of the chain's input
+   * through all operators of the chain in a separate job, so intermediate results stay in cache and the whole chain
+   * is parallelized across chunks. Other operators (joins, aggregates, sorts, ...) are pipeline breakers. Only the
+   * last operator of a pipeline has an output, the other ones are never executed.
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
-      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries);
+      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries,
+      ExecutionMode execution_mode = ExecutionMode::OperatorAtATime);
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
+  /**
+   * @return The operators executed as a pipeline by this task, starting with the one closest to the input and ending
+   *         with get_operator(). Empty if the task executes only its operator.
+   */
+  const std::vector<std::shared_ptr<AbstractOperator>>& pipeline() const;
+
   std::string description() const override;
 
  protected:
@@ -39,10 +55,26 @@ class OperatorTask : public AbstractTask {
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-      CleanupTemporaries cleanup_temporaries);
+      CleanupTemporaries cleanup_temporaries, ExecutionMode execution_mode,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts);
+
+  /**
+   * Executes the operators of _pipeline for every chunk of the pipeline's input and sets the output of _op
+   */
+  void _execute_pipeline();
+
+  /**
+   * Pushes a single chunk of @param input_table through copies of the operators of _pipeline. If no @param chunk_id
+   * is given, an empty table is pushed through, which is used to determine the layout of the pipeline's output.
+   * @return The output of the last operator, or nullptr if the transaction was aborted
+   */
+  std::shared_ptr<const Table> _execute_pipeline_on_morsel(
+      const std::shared_ptr<const Table>& input_table, const std::optional<ChunkID>& chunk_id,
+      const std::shared_ptr<TransactionContext>& transaction_context) const;
 
  private:
   std::shared_ptr<AbstractOperator> _op;
   CleanupTemporaries _cleanup_temporaries;
+  std::vector<std::shared_ptr<AbstractOperator>> _pipeline;
 };
 }  // namespace opossum
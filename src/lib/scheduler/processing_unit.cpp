@@ -3,6 +3,8 @@
 #include <functional>
 #include <memory>
 
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
 #include "uid_allocator.hpp"
 #include "worker.hpp"
 
@@ -17,6 +19,8 @@ namespace opossum {
 ProcessingUnit::ProcessingUnit(const std::shared_ptr<TaskQueue>& queue,
                                const std::shared_ptr<UidAllocator>& worker_id_allocator, CpuID cpu_id)
     : _queue(queue), _worker_id_allocator(worker_id_allocator), _cpu_id(cpu_id) {
+  _workers.reserve(MAX_WORKERS_PER_CORE + MAX_WORKERS_PER_CORE_JOBTASKS);
+
   // Do not start worker yet, the object is still under construction and no shared_ptr of it is held right now -
   // shared_from_this will fail!
 }
@@ -61,6 +65,7 @@ void ProcessingUnit::wake_or_create_worker() {
       auto worker = std::make_shared<Worker>(shared_from_this(), _queue, _worker_id_allocator->allocate(), _cpu_id,
                                              SchedulePriority::Lowest);
       _workers.emplace_back(worker);
+      _num_published_workers = _workers.size();
 
       auto fn = std::bind(&Worker::operator(), worker.get());
       _threads.emplace_back(fn);
@@ -68,6 +73,7 @@ void ProcessingUnit::wake_or_create_worker() {
       auto worker = std::make_shared<Worker>(shared_from_this(), _queue, _worker_id_allocator->allocate(), _cpu_id,
                                              SchedulePriority::JobTask);
       _workers.emplace_back(worker);
+      _num_published_workers = _workers.size();
 
       auto fn = std::bind(&Worker::operator(), worker.get());
       _threads.emplace_back(fn);
@@ -94,8 +100,29 @@ void ProcessingUnit::shutdown() {
 
 bool ProcessingUnit::shutdown_flag() const { return _shutdown_flag; }
 
+NodeID ProcessingUnit::node_id() const { return _queue->node_id(); }
+
 void ProcessingUnit::on_worker_finished_task() { _num_finished_tasks++; }
 
 uint64_t ProcessingUnit::num_finished_tasks() const { return _num_finished_tasks; }
 
+size_t ProcessingUnit::num_workers() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _workers.size();
+}
+
+std::shared_ptr<AbstractTask> ProcessingUnit::steal_task_from_workers(WorkerID thief_id) {
+  // As _workers never reallocates, the published elements can be read while another thread appends a Worker
+  const auto num_workers = _num_published_workers.load();
+  for (auto worker_idx = size_t{0}; worker_idx < num_workers; ++worker_idx) {
+    const auto& worker = _workers[worker_idx];
+    if (worker->id() == thief_id) continue;
+
+    auto task = worker->steal_local_task();
+    if (task) return task;
+  }
+
+  return nullptr;
+}
+
 }  // namespace opossum
@@ -11,6 +11,7 @@
 
 namespace opossum {
 
+class AbstractTask;
 class UidAllocator;
 class TaskQueue;
 class Worker;
@@ -26,6 +27,11 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
 
   bool shutdown_flag() const;
 
+  /**
+   * The node of the TaskQueue the Workers pull from
+   */
+  NodeID node_id() const;
+
   /**
    * In order to be allowed to pull new Tasks, a Worker must be the active worker, i.e. call this method with its id
    * and receive true from it.
@@ -63,13 +69,25 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
   void shutdown();
   uint64_t num_finished_tasks() const;
 
+  /**
+   * Number of Workers created so far, both active and hibernated ones
+   */
+  size_t num_workers();
+
+  /**
+   * Steals a task from the local deque of one of the Workers (see Worker::steal_local_task()), except for the thief.
+   * Called by Workers that have nothing to do. Does not block, even if Workers are being created concurrently.
+   */
+  std::shared_ptr<AbstractTask> steal_task_from_workers(WorkerID thief_id);
+
  private:
   std::shared_ptr<TaskQueue> _queue;
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   CpuID _cpu_id;
   std::mutex _mutex;  // Synchronizes access to _threads, _workers
   std::vector<std::thread> _threads;
-  std::vector<std::shared_ptr<Worker>> _workers;
+  std::vector<std::shared_ptr<Worker>> _workers;  // Reserved upfront, so that it is never reallocated
+  std::atomic<size_t> _num_published_workers{0};  // Workers that can be read by thieves without holding _mutex
   std::atomic_bool _shutdown_flag{false};
   std::atomic<WorkerID> _active_worker_token{INVALID_WORKER_ID};
   std::mutex _hibernation_mutex;
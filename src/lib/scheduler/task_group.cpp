@@ -0,0 +1,53 @@
+#include "task_group.hpp"
+
+#include <chrono>
+#include <memory>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::atomic<uint64_t> TaskGroup::_global_pass{0};
+
+TaskGroup::TaskGroup(const bool latency_critical, const uint32_t weight)
+    : _latency_critical(latency_critical),
+      _weight(weight),
+      _pass(_global_pass.load()),
+      _last_served(std::chrono::steady_clock::now().time_since_epoch().count()) {
+  Assert(weight > 0, "The weight of a TaskGroup needs to be positive");
+}
+
+const std::shared_ptr<TaskGroup>& TaskGroup::default_group() {
+  static const auto default_group = std::make_shared<TaskGroup>();
+  return default_group;
+}
+
+bool TaskGroup::is_latency_critical() const { return _latency_critical; }
+
+uint32_t TaskGroup::weight() const { return _weight; }
+
+uint64_t TaskGroup::pass() const { return _pass; }
+
+std::chrono::steady_clock::time_point TaskGroup::last_served() const {
+  return std::chrono::steady_clock::time_point{std::chrono::steady_clock::duration{_last_served.load()}};
+}
+
+void TaskGroup::_on_served() {
+  _last_served = std::chrono::steady_clock::now().time_since_epoch().count();
+
+  const auto previous_pass = _pass.fetch_add(STRIDE / _weight);
+
+  auto global_pass = _global_pass.load();
+  while (global_pass < previous_pass && !_global_pass.compare_exchange_weak(global_pass, previous_pass)) {
+  }
+}
+
+void TaskGroup::_catch_up() {
+  const auto global_pass = _global_pass.load();
+
+  auto pass = _pass.load();
+  while (pass < global_pass && !_pass.compare_exchange_weak(pass, global_pass)) {
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A TaskGroup bundles the tasks of a query (or of a session) so that the TaskQueues can share the workers fairly
+ * between concurrently running queries, instead of serving all tasks in the order of their priorities. Otherwise, a
+ * single analytical query that spawns thousands of JobTasks starves all queries arriving after it.
+ *
+ * Groups are served in proportion to their weights (stride scheduling): Every time a task of a group is pulled, the
+ * group's pass is advanced by STRIDE / weight, and the group with the lowest pass is served next. This includes the
+ * JobTasks that Workers take from their local deques without going through a TaskQueue. Latency-critical groups are
+ * served before all other groups.
+ *
+ * Tasks without a group that are scheduled by another task inherit the group of that task. All other tasks without a
+ * group belong to default_group().
+ */
+class TaskGroup final : private Noncopyable {
+  friend class TaskQueue;
+  friend class Worker;
+
+ public:
+  static constexpr uint32_t DEFAULT_WEIGHT = 1;
+
+  explicit TaskGroup(const bool latency_critical = false, const uint32_t weight = DEFAULT_WEIGHT);
+
+  static const std::shared_ptr<TaskGroup>& default_group();
+
+  bool is_latency_critical() const;
+  uint32_t weight() const;
+
+  /**
+   * Virtual time consumed by the group. Lower passes are served first.
+   */
+  uint64_t pass() const;
+
+  /**
+   * When a task of the group was last taken for execution (or when the group was created)
+   */
+  std::chrono::steady_clock::time_point last_served() const;
+
+ private:
+  static constexpr uint64_t STRIDE = 1u << 20u;
+
+  // Called by the TaskQueue or a Worker when one of the group's tasks is taken for execution
+  void _on_served();
+
+  // Called by the TaskQueue when the group becomes active again, so that it cannot claim the time it was idle for
+  void _catch_up();
+
+  // Pass of the most recently served group
+  static std::atomic<uint64_t> _global_pass;
+
+  const bool _latency_critical;
+  const uint32_t _weight;
+  std::atomic<uint64_t> _pass;
+  std::atomic<std::chrono::steady_clock::rep> _last_served;
+};
+
+}  // namespace opossum
@@ -1,11 +1,21 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "abstract_task.hpp"
+#include "task_group.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+// In which order the TaskQueue serves groups, see TaskQueue
+enum class GroupUrgency { Regular, Starving, LatencyCritical };
+
+}  // namespace
+
 namespace opossum {
 
 TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
@@ -21,44 +31,128 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
 
-  _num_tasks++;
-}
+  const auto& group = task->task_group() ? task->task_group() : TaskGroup::default_group();
 
-std::shared_ptr<AbstractTask> TaskQueue::pull(SchedulePriority min_priority) {
-  std::shared_ptr<AbstractTask> task;
-  for (auto priority :
-       {SchedulePriority::JobTask, SchedulePriority::Highest, SchedulePriority::Default, SchedulePriority::Lowest}) {
-    if (priority > min_priority) {
-      break;
-    }
-    auto& queue = _queues[static_cast<uint32_t>(priority)];
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
 
-    if (queue.try_pop(task)) {
-      _num_tasks--;
-      return task;
+    auto group_queue_iter = std::find_if(_group_queues.begin(), _group_queues.end(),
+                                         [&](const auto& group_queue) { return group_queue.group == group; });
+    if (group_queue_iter == _group_queues.end()) {
+      group->_catch_up();
+      group_queue_iter = _group_queues.emplace(_group_queues.end());
+      group_queue_iter->group = group;
     }
+
+    group_queue_iter->queues[priority].push_back({task, std::chrono::steady_clock::now()});
+    ++group_queue_iter->task_count;
   }
-  return nullptr;
+
+  _num_tasks++;
+
+  // Wake up a parked worker of this node. As _num_tasks was incremented before _num_idle_workers is read, a worker
+  // that is about to park either sees the new task or is counted as idle here.
+  notify_idle_worker();
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::steal() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto priority :
-       {SchedulePriority::JobTask, SchedulePriority::Highest, SchedulePriority::Default, SchedulePriority::Lowest}) {
-    auto& queue = _queues[static_cast<uint32_t>(priority)];
-
-    if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
-        _num_tasks--;
-        return task;
-      } else {
-        queue.push(task);
+std::shared_ptr<AbstractTask> TaskQueue::pull(SchedulePriority min_priority) { return _pop(min_priority, false); }
+
+std::shared_ptr<AbstractTask> TaskQueue::steal() { return _pop(SchedulePriority::Lowest, true); }
+
+std::shared_ptr<AbstractTask> TaskQueue::_pop(SchedulePriority min_priority, bool stealable_only) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto now = std::chrono::steady_clock::now();
+  const auto max_priority_level = static_cast<uint32_t>(min_priority);
+
+  auto selected_group_queue = _group_queues.end();
+  auto selected_priority_level = uint32_t{0};
+  auto selected_group_urgency = GroupUrgency::Regular;
+
+  for (auto group_queue_iter = _group_queues.begin(); group_queue_iter != _group_queues.end(); ++group_queue_iter) {
+    // Find the queue with the highest aged priority in this group
+    auto priority_level = std::optional<uint32_t>{};
+    auto aged_priority_level = uint32_t{0};
+    auto is_starving = false;
+
+    for (auto level = uint32_t{0}; level <= max_priority_level; ++level) {
+      const auto& queue = group_queue_iter->queues[level];
+      if (queue.empty() || (stealable_only && !queue.front().task->is_stealable())) continue;
+
+      const auto waiting_time = now - queue.front().enqueue_time;
+      is_starving |= waiting_time >= STARVATION_THRESHOLD;
+
+      // Tasks age up to SchedulePriority::Highest, SchedulePriority::JobTask is reserved for JobTasks
+      const auto aged_levels = static_cast<uint32_t>(waiting_time / AGING_INTERVAL);
+      const auto highest_level = static_cast<uint32_t>(SchedulePriority::Highest);
+      auto aged_level = level;
+      if (level > highest_level) aged_level = level - std::min(level - highest_level, aged_levels);
+
+      if (!priority_level || aged_level < aged_priority_level) {
+        priority_level = level;
+        aged_priority_level = aged_level;
       }
     }
+
+    if (!priority_level) continue;
+
+    // Latency-critical groups first, then starving ones, then the group with the lowest pass
+    const auto& group = *group_queue_iter->group;
+    auto urgency = GroupUrgency::Regular;
+    if (group.is_latency_critical()) {
+      urgency = GroupUrgency::LatencyCritical;
+    } else if (is_starving && now - group.last_served() >= STARVATION_THRESHOLD) {
+      urgency = GroupUrgency::Starving;
+    }
+
+    if (selected_group_queue == _group_queues.end() || urgency > selected_group_urgency ||
+        (urgency == selected_group_urgency && group.pass() < selected_group_queue->group->pass())) {
+      selected_group_queue = group_queue_iter;
+      selected_priority_level = *priority_level;
+      selected_group_urgency = urgency;
+    }
+  }
+
+  if (selected_group_queue == _group_queues.end()) return nullptr;
+
+  auto& queue = selected_group_queue->queues[selected_priority_level];
+  const auto task = std::move(queue.front().task);
+  queue.pop_front();
+
+  selected_group_queue->group->_on_served();
+
+  // The order of the groups does not matter, so the group queue can simply be replaced with the last one
+  if (--selected_group_queue->task_count == 0) {
+    if (selected_group_queue != _group_queues.end() - 1) *selected_group_queue = std::move(_group_queues.back());
+    _group_queues.pop_back();
   }
-  return nullptr;
+
+  _num_tasks--;
+  return task;
+}
+
+void TaskQueue::wait_for_task(std::chrono::microseconds timeout) {
+  std::unique_lock<std::mutex> lock(_idle_mutex);
+
+  _num_idle_workers++;
+  if (empty()) _idle_condition_variable.wait_for(lock, timeout);
+  _num_idle_workers--;
+}
+
+bool TaskQueue::has_idle_workers() const { return _num_idle_workers > 0; }
+
+bool TaskQueue::notify_idle_worker() {
+  if (_num_idle_workers == 0) return false;
+
+  std::lock_guard<std::mutex> lock(_idle_mutex);
+  _idle_condition_variable.notify_one();
+  return true;
+}
+
+void TaskQueue::notify_all_idle_workers() {
+  std::lock_guard<std::mutex> lock(_idle_mutex);
+  _idle_condition_variable.notify_all();
 }
 
 }  // namespace opossum
@@ -1,23 +1,38 @@
 #pragma once
 
 #include <stdint.h>
-#include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractTask;
+class TaskGroup;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * The tasks are queued per TaskGroup and priority. Pulling a task first selects a group (see TaskGroup for how the
+ * workers are shared between groups) and then takes the oldest task with the highest priority of that group.
+ * To avoid starvation, tasks age: For every AGING_INTERVAL they wait, they are treated as if their priority was one
+ * level higher (up to SchedulePriority::Highest). A group whose oldest task waited for STARVATION_THRESHOLD and that
+ * was not served for as long is promoted by one level: It is served before the other groups, but after the
+ * latency-critical ones. The promotion ends as soon as one of its tasks is taken, so that under load, starving groups
+ * get one task each per STARVATION_THRESHOLD instead of all of them being treated as latency-critical.
  */
 class TaskQueue {
  public:
   static constexpr uint32_t NUM_PRIORITY_LEVELS = 4;
+  static constexpr auto AGING_INTERVAL = std::chrono::milliseconds(5);
+  static constexpr auto STARVATION_THRESHOLD = std::chrono::milliseconds(50);
 
   explicit TaskQueue(NodeID node_id);
 
@@ -39,10 +54,56 @@ class TaskQueue {
    */
   std::shared_ptr<AbstractTask> steal();
 
+  /**
+   * Parks the calling worker until a task is pushed into this queue, the worker is notified otherwise, or the timeout
+   * expired. Returns right away if the queue is not empty.
+   */
+  void wait_for_task(std::chrono::microseconds timeout);
+
+  /**
+   * @return Whether workers are parked in wait_for_task()
+   */
+  bool has_idle_workers() const;
+
+  /**
+   * Wakes up one worker parked in wait_for_task(), e.g., so that it can steal a task from another queue
+   * @return Whether there was a parked worker
+   */
+  bool notify_idle_worker();
+
+  /**
+   * Wakes up all workers parked in wait_for_task(), e.g., on shutdown
+   */
+  void notify_all_idle_workers();
+
  private:
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  struct QueuedTask {
+    std::shared_ptr<AbstractTask> task;
+    std::chrono::steady_clock::time_point enqueue_time;
+  };
+
+  struct GroupQueue {
+    std::shared_ptr<TaskGroup> group;
+    std::array<std::deque<QueuedTask>, NUM_PRIORITY_LEVELS> queues;
+    size_t task_count{0};
+  };
+
+  /**
+   * Removes the next task according to the TaskGroups and (aged) priorities
+   * @param stealable_only  only consider tasks that may be stolen by other nodes
+   */
+  std::shared_ptr<AbstractTask> _pop(SchedulePriority min_priority, bool stealable_only);
+
+  // Groups that currently have tasks in this queue
+  std::vector<GroupQueue> _group_queues;
+  std::mutex _mutex;  // Synchronizes access to _group_queues
   std::atomic_uint _num_tasks{0};
+
+  // For parking idle workers
+  std::mutex _idle_mutex;
+  std::condition_variable _idle_condition_variable;
+  std::atomic_uint _num_idle_workers{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,123 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Moves the task out of a slot that was taken from the deque
+std::shared_ptr<opossum::AbstractTask> take_task(std::shared_ptr<opossum::AbstractTask>* slot) {
+  auto task = std::move(*slot);
+  delete slot;
+  return task;
+}
+
+}  // namespace
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(size_t capacity)
+    : capacity(capacity), slots(std::make_unique<std::atomic<Slot>[]>(capacity)) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity needs to be a power of two");
+}
+
+WorkStealingDeque::Slot WorkStealingDeque::Buffer::load(int64_t index) const {
+  return slots[static_cast<size_t>(index) & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::store(int64_t index, Slot slot) {
+  slots[static_cast<size_t>(index) & (capacity - 1)].store(slot, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(size_t capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  const auto top = _top.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto buffer = _buffer.load(std::memory_order_relaxed);
+  for (auto index = top; index < bottom; ++index) {
+    delete buffer->load(index);
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) buffer = _grow(buffer, top, bottom);
+
+  buffer->store(bottom, new std::shared_ptr<AbstractTask>(task));
+
+  // Make the task visible to thieves before they can see the new bottom
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  const auto buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  const auto slot = buffer->load(bottom);
+  if (top < bottom) return take_task(slot);
+
+  // This is the last task, thieves might try to take it as well
+  const auto won_race =
+      _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+
+  return won_race ? take_task(slot) : nullptr;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  const auto slot = _buffer.load(std::memory_order_acquire)->load(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    return nullptr;
+  }
+
+  return take_task(slot);
+}
+
+size_t WorkStealingDeque::size() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+bool WorkStealingDeque::empty() const { return size() == 0; }
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* buffer, int64_t top, int64_t bottom) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->store(index, buffer->load(index));
+  }
+
+  _buffers.emplace_back(std::move(new_buffer));
+  const auto grown_buffer = _buffers.back().get();
+  _buffer.store(grown_buffer, std::memory_order_release);
+
+  return grown_buffer;
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free deque of tasks that is owned by a single Worker (Chase and Lev, "Dynamic Circular Work-Stealing Deque",
+ * with the memory orderings proposed by Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models").
+ *
+ * The owner pushes and pops tasks at the bottom (LIFO), so that it continues with the tasks it spawned most recently
+ * and whose data is most likely still in its caches. Other Workers steal from the top (FIFO), i.e., they take the
+ * oldest tasks. push() and pop() must only be called by the owner, steal() can be called by any thread.
+ */
+class WorkStealingDeque final : private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_CAPACITY = 64;
+
+  explicit WorkStealingDeque(size_t capacity = DEFAULT_CAPACITY);
+  ~WorkStealingDeque();
+
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * @return The most recently pushed task, or nullptr if the deque is empty or the last task was stolen concurrently
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * @return The least recently pushed task, or nullptr if the deque is empty or another thread was faster
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * Only a snapshot, as other threads might steal tasks concurrently
+   */
+  size_t size() const;
+  bool empty() const;
+
+ private:
+  // A thief reads a task before it knows whether the steal succeeds, so the slots can only hold trivially copyable
+  // values. Thus, the deque stores pointers to heap-allocated shared_ptrs, which are owned by the deque until a task
+  // is popped or stolen successfully.
+  using Slot = std::shared_ptr<AbstractTask>*;
+
+  // Circular array whose capacity is a power of two
+  struct Buffer {
+    explicit Buffer(size_t capacity);
+
+    Slot load(int64_t index) const;
+    void store(int64_t index, Slot slot);
+
+    const size_t capacity;
+    std::unique_ptr<std::atomic<Slot>[]> slots;
+  };
+
+  // Replaces the buffer by one of twice its capacity. Only called by the owner.
+  Buffer* _grow(Buffer* buffer, int64_t top, int64_t bottom);
+
+  // Thieves and the owner contend on _top, while _bottom is mostly accessed by the owner
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // All buffers that were ever used. Replaced buffers are only freed when the deque is destroyed, because thieves
+  // might still be reading from them.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -5,6 +5,7 @@
 #include <unistd.h>
 
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <thread>
@@ -13,6 +14,8 @@
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
+#include "node_queue_scheduler.hpp"
+#include "task_group.hpp"
 #include "task_queue.hpp"
 
 namespace {
@@ -22,6 +25,14 @@ namespace {
  * Uses a weak_ptr, because otherwise the ref-count of it would not reach zero within the main() scope of the program.
  */
 thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
+
+/**
+ * An idle worker first spins for a few rounds, as new tasks often arrive right after the queue ran empty (e.g., the
+ * next operator of a query). Afterwards, it parks until a task is pushed into its queue. The timeout makes sure that
+ * parked workers still steal tasks from busy nodes whose workers do not notify them.
+ */
+constexpr auto IDLE_SPIN_ROUNDS = 64u;
+constexpr auto IDLE_PARK_TIMEOUT = std::chrono::milliseconds(10);
 }  // namespace
 
 namespace opossum {
@@ -30,7 +41,12 @@ std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_
 
 Worker::Worker(const std::weak_ptr<ProcessingUnit>& processing_unit, const std::shared_ptr<TaskQueue>& queue,
                WorkerID id, CpuID cpu_id, SchedulePriority min_priority)
-    : _processing_unit(processing_unit), _queue(queue), _id(id), _cpu_id(cpu_id), _min_priority(min_priority) {}
+    : _processing_unit(processing_unit),
+      _queue(queue),
+      _id(id),
+      _cpu_id(cpu_id),
+      _min_priority(min_priority),
+      _random_engine(static_cast<uint32_t>(id)) {}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -40,6 +56,8 @@ CpuID Worker::cpu_id() const { return _cpu_id; }
 
 std::weak_ptr<ProcessingUnit> Worker::processing_unit() const { return _processing_unit; }
 
+std::shared_ptr<AbstractTask> Worker::steal_local_task() { return _local_tasks.steal(); }
+
 void Worker::operator()() {
   DebugAssert((this_thread_worker.expired()), "Thread already has a worker");
 
@@ -55,6 +73,16 @@ void Worker::operator()() {
 
   DebugAssert(static_cast<bool>(processing_unit), "No processing unit");
 
+  // All ProcessingUnits are created before the first Worker starts
+  const auto node_queue_scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(scheduler);
+  Assert(node_queue_scheduler, "Workers can only be used by the NodeQueueScheduler");
+  _processing_units_per_node.resize(scheduler->queues().size());
+  for (const auto& victim : node_queue_scheduler->processing_units()) {
+    _processing_units_per_node[victim->node_id()].emplace_back(victim);
+  }
+
+  auto idle_rounds = 0u;
+
   while (!processing_unit->shutdown_flag()) {
     // Hibernate if this is not the active worker.
     {
@@ -65,10 +93,16 @@ void Worker::operator()() {
       }
     }
 
-    auto task = _queue->pull(_min_priority);
+    auto task = _pull_task();
 
     // TODO(all): this might shutdown the worker and leave non-ready tasks in the queue.
     // Figure out how we want to deal with that later.
+    if (!task) {
+      // Work stealing without explicitly transferring data between nodes. The dedicated JobTask worker only steals
+      // from the local deques of other workers, as these only contain JobTasks.
+      task = _steal_task();
+    }
+
     if (!task) {
       // If the worker is the dedicated JobTask worker, go back into hibernation to wake up
       // (or pass priority to) one of the all-priorities workers.
@@ -78,28 +112,18 @@ void Worker::operator()() {
         continue;  // Re-try to become the active worker
       }
 
-      // Simple work stealing without explicitly transferring data between nodes.
-      auto work_stealing_successful = false;
-      for (auto& queue : scheduler->queues()) {
-        if (queue == _queue) {
-          continue;
-        }
-
-        task = queue->steal();
-        if (task) {
-          task->set_node_id(_queue->node_id());
-          work_stealing_successful = true;
-          break;
-        }
-      }
-
-      // Sleep iff there is no ready task in our queue and work stealing was not successful.
-      if (!work_stealing_successful) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        continue;
+      // Spin, then park iff there is no ready task in our queue and work stealing was not successful.
+      if (idle_rounds < IDLE_SPIN_ROUNDS) {
+        ++idle_rounds;
+        std::this_thread::yield();
+      } else {
+        _queue->wait_for_task(IDLE_PARK_TIMEOUT);
       }
+      continue;
     }
 
+    idle_rounds = 0;
+
     task->execute();
 
     // This is part of the Scheduler shutdown system. Count the number of tasks a ProcessingUnit executed to allow the
@@ -108,6 +132,103 @@ void Worker::operator()() {
   }
 
   processing_unit->yield_active_worker_token(_id);
+
+  // The ProcessingUnits own their Workers, so this reference cycle needs to be broken
+  _processing_units_per_node.clear();
+}
+
+bool Worker::_execute_task_while_waiting(ProcessingUnit& processing_unit,
+                                         const std::function<bool(const AbstractTask&)>& is_awaited) {
+  auto task = _local_tasks.pop();
+  if (!task) return false;
+
+  // The awaited tasks were pushed after all others, so if the most recent task is not awaited, none of them is left
+  if (!is_awaited(*task)) {
+    _local_tasks.push(task);
+    return false;
+  }
+  _on_local_task_taken(*task);
+
+  ++_helping_depth;
+  task->execute();
+  --_helping_depth;
+
+  processing_unit.on_worker_finished_task();
+  return true;
+}
+
+void Worker::_push_local_task(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(this_thread_worker.lock().get() == this, "Only the owning thread may push into the local deque");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _local_tasks.push(task);
+}
+
+std::shared_ptr<AbstractTask> Worker::_pull_task() {
+  if (_num_local_pulls < TASK_QUEUE_POLL_INTERVAL) {
+    auto task = _local_tasks.pop();
+    if (task) {
+      ++_num_local_pulls;
+      _on_local_task_taken(*task);
+      return task;
+    }
+  }
+
+  _num_local_pulls = 0;
+  auto task = _queue->pull(_min_priority);
+  if (task) return task;
+
+  task = _local_tasks.pop();
+  if (task) _on_local_task_taken(*task);
+  return task;
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal_task() {
+  const auto& queues = CurrentScheduler::get()->queues();
+  const auto own_node_id = _queue->node_id();
+
+  const auto steal_from_node = [&](const NodeID node_id) -> std::shared_ptr<AbstractTask> {
+    // The queue of the own node was already checked by _pull_task()
+    if (node_id != own_node_id && _min_priority == SchedulePriority::Lowest) {
+      auto task = queues[node_id]->steal();
+      if (task) return task;
+    }
+
+    const auto& processing_units = _processing_units_per_node[node_id];
+    if (processing_units.empty()) return nullptr;
+
+    const auto first_processing_unit_idx = _random_engine() % processing_units.size();
+    for (auto offset = size_t{0}; offset < processing_units.size(); ++offset) {
+      const auto& processing_unit = processing_units[(first_processing_unit_idx + offset) % processing_units.size()];
+      auto task = processing_unit->steal_task_from_workers(_id);
+      if (task) {
+        _on_local_task_taken(*task);
+        return task;
+      }
+    }
+    return nullptr;
+  };
+
+  // Crossing sockets is more expensive (see NodeQueueScheduler), so the workers of the own node are preferred
+  auto task = steal_from_node(own_node_id);
+
+  const auto num_nodes = _processing_units_per_node.size();
+  const auto first_node_idx = _random_engine() % num_nodes;
+  for (auto offset = size_t{0}; offset < num_nodes && !task; ++offset) {
+    const auto node_id = NodeID{static_cast<uint32_t>((first_node_idx + offset) % num_nodes)};
+    if (node_id != own_node_id) task = steal_from_node(node_id);
+  }
+
+  if (task) task->set_node_id(own_node_id);
+  return task;
+}
+
+void Worker::_on_local_task_taken(const AbstractTask& task) {
+  const auto& task_group = task.task_group() ? task.task_group() : TaskGroup::default_group();
+  task_group->_on_served();
 }
 
 void Worker::_set_affinity() {
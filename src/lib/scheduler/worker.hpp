@@ -1,19 +1,28 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "processing_unit.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace opossum {
 
+class AbstractTask;
 class TaskQueue;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * Besides the TaskQueue of its node, every Worker has a local deque for the JobTasks spawned by the tasks it executes.
+ * See NodeQueueScheduler for how Workers pick and steal tasks.
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractTask;
@@ -34,6 +43,11 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::weak_ptr<ProcessingUnit> processing_unit() const;
   CpuID cpu_id() const;
 
+  /**
+   * Called by other (idle) Workers to take the oldest task from this Worker's local deque
+   */
+  std::shared_ptr<AbstractTask> steal_local_task();
+
   void operator()();
 
   void operator=(const Worker&) = delete;
@@ -43,20 +57,75 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   template <typename TaskType>
   void _wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
     /**
-     * This method blocks the calling thread (worker) until all tasks have been completed.
-     * It hands off the active worker token so that another worker can execute tasks while the calling worker is blocked.
+     * Instead of blocking the calling thread (worker) until all tasks have been completed, the worker keeps its active
+     * worker token and executes the tasks it waits for (or tasks of their TaskGroup) from its local deque in the
+     * meantime. Thus, the waiting task is continued on the same thread once it is unblocked, and no additional worker
+     * threads are needed. Other tasks are not executed, as they would delay the waiting task for an unbounded time.
+     * As C++17 has no coroutines, the waiting task remains on the stack of the worker. To bound the stack depth, the
+     * worker falls back to handing off the active worker token and blocking once too many tasks are nested. The same
+     * happens if an awaited task is neither on the local deque nor executed elsewhere, e.g., because it waits in a
+     * TaskQueue that only this worker serves.
      */
     auto processing_unit = _processing_unit.lock();
     DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
 
-    processing_unit->yield_active_worker_token(_id);
-    processing_unit->wake_or_create_worker();
+    const auto block_for_tasks = [&]() {
+      processing_unit->yield_active_worker_token(_id);
+      processing_unit->wake_or_create_worker();
+
+      for (auto& task : tasks) {
+        task->_join_without_replacement_worker();
+      }
+    };
+
+    if (_helping_depth >= MAX_HELPING_DEPTH) {
+      block_for_tasks();
+      return;
+    }
+
+    const auto is_awaited = [&](const auto& task) {
+      const auto& task_group = task.task_group();
+      return std::any_of(tasks.cbegin(), tasks.cend(), [&](const auto& awaited_task) {
+        return awaited_task.get() == &task || (task_group && awaited_task->task_group() == task_group);
+      });
+    };
 
     for (auto& task : tasks) {
-      task->_join_without_replacement_worker();
+      while (!task->is_done()) {
+        if (_execute_task_while_waiting(*processing_unit, is_awaited)) continue;
+        if (task->_join_for(HELPING_POLL_INTERVAL)) break;
+
+        if (!task->_started) {
+          block_for_tasks();
+          return;
+        }
+      }
     }
   }
 
+  /**
+   * Pulls the most recent task from the local deque and executes it if it is awaited. Otherwise, the task is put back.
+   * @return A task was executed
+   */
+  bool _execute_task_while_waiting(ProcessingUnit& processing_unit,
+                                   const std::function<bool(const AbstractTask&)>& is_awaited);
+
+  /**
+   * Adds a ready task to the local deque. Only to be called from this Worker's thread.
+   */
+  void _push_local_task(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Takes the most recently spawned task from the local deque, or a task from the node's TaskQueue
+   */
+  std::shared_ptr<AbstractTask> _pull_task();
+
+  /**
+   * Tries to steal a task from the other Workers of the same node first, and from the queues and Workers of other
+   * nodes afterwards. Only stealable tasks are taken into account.
+   */
+  std::shared_ptr<AbstractTask> _steal_task();
+
  private:
   /**
    * Pin a worker to a particular core.
@@ -64,11 +133,40 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  /**
+   * Tasks taken from a local deque bypass the TaskQueue, so the service of their TaskGroup is recorded here
+   */
+  static void _on_local_task_taken(const AbstractTask& task);
+
   std::weak_ptr<ProcessingUnit> _processing_unit;
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
   SchedulePriority _min_priority;
+
+  // Number of tasks that are executed on top of a waiting task on this worker's stack
+  size_t _helping_depth{0};
+
+  WorkStealingDeque _local_tasks;
+
+  // Number of tasks taken from _local_tasks since the TaskQueue was last checked
+  size_t _num_local_pulls{0};
+
+  // The ProcessingUnits to steal from, by NodeID. Set when the Worker starts running, as they do not change afterwards.
+  std::vector<std::vector<std::shared_ptr<ProcessingUnit>>> _processing_units_per_node;
+
+  // For visiting the victims in a random order, so that idle workers do not all try to steal from the same one
+  std::minstd_rand _random_engine;
+
+  // Beyond this many nested tasks, a waiting worker blocks instead of executing further tasks
+  static constexpr size_t MAX_HELPING_DEPTH = 32;
+
+  // How long a waiting worker blocks on a task that is executed elsewhere before it looks for other tasks again
+  static constexpr auto HELPING_POLL_INTERVAL = std::chrono::milliseconds(1);
+
+  // After this many tasks from the local deque, the worker pulls from the TaskQueue, even if the deque is not empty.
+  // Otherwise, a query that spawns many JobTasks would keep the worker from serving other TaskGroups.
+  static constexpr size_t TASK_QUEUE_POLL_INTERVAL = 32;
 };
 
 }  // namespace opossum
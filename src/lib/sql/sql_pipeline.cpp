@@ -15,7 +15,8 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
                          const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                         const CleanupTemporaries cleanup_temporaries)
+                         const CleanupTemporaries cleanup_temporaries, const ExecutionMode execution_mode,
+                         const std::shared_ptr<TaskGroup>& task_group)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
@@ -74,7 +75,7 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
         statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
-        prepared_statements, cleanup_temporaries);
+        prepared_statements, cleanup_temporaries, execution_mode, task_group);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -33,6 +33,16 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_task_group(const std::shared_ptr<TaskGroup>& task_group) {
+  _task_group = task_group;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_execution_mode(const ExecutionMode execution_mode) {
+  _execution_mode = execution_mode;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
@@ -40,20 +50,28 @@ SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::mark_as_latency_critical() {
+  _latency_critical = true;
+  return *this;
+}
+
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
+  auto task_group = _task_group ? _task_group : std::make_shared<TaskGroup>(_latency_critical);
 
-  return {_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements, _cleanup_temporaries};
+  return {_sql,                 _transaction_context, _use_mvcc,       lqp_translator, optimizer,
+          _prepared_statements, _cleanup_temporaries, _execution_mode, task_group};
 }
 
 SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
     std::shared_ptr<hsql::SQLParserResult> parsed_sql) const {
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
+  auto task_group = _task_group ? _task_group : std::make_shared<TaskGroup>(_latency_critical);
 
   return {_sql,      std::move(parsed_sql), _use_mvcc,           _transaction_context, lqp_translator,
-          optimizer, _prepared_statements,  _cleanup_temporaries};
+          optimizer, _prepared_statements,  _cleanup_temporaries, _execution_mode,      task_group};
 }
 
 }  // namespace opossum
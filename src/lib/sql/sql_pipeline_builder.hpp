@@ -28,6 +28,8 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer() is used.
  *  - No JIT operators
+ *  - Every pipeline gets its own TaskGroup, i.e., workers are shared fairly between concurrently running pipelines
+ *  - Operators are executed one at a time (ExecutionMode::OperatorAtATime)
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -43,6 +45,18 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_prepared_statement_cache(const std::shared_ptr<PreparedStatementCache>& prepared_statements);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
+  /**
+   * Schedule the tasks in the given group, e.g., to share the workers fairly between sessions instead of queries.
+   * Takes precedence over mark_as_latency_critical().
+   */
+  SQLPipelineBuilder& with_task_group(const std::shared_ptr<TaskGroup>& task_group);
+
+  /**
+   * With ExecutionMode::MorselDriven, chains of Validate, TableScan and Projection are executed chunk by chunk, see
+   * OperatorTask::make_tasks_from_operator(). Only the last operator of such a chain has an output.
+   */
+  SQLPipelineBuilder& with_execution_mode(const ExecutionMode execution_mode);
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -53,6 +67,11 @@ class SQLPipelineBuilder final {
    */
   SQLPipelineBuilder& dont_cleanup_temporaries();
 
+  /**
+   * Serve the tasks of the pipeline before those of other (e.g., analytical) pipelines, see TaskGroup
+   */
+  SQLPipelineBuilder& mark_as_latency_critical();
+
   SQLPipeline create_pipeline() const;
 
   /**
@@ -70,6 +89,9 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
   CleanupTemporaries _cleanup_temporaries{true};
+  ExecutionMode _execution_mode{ExecutionMode::OperatorAtATime};
+  std::shared_ptr<TaskGroup> _task_group;
+  bool _latency_critical{false};
 };
 
 }  // namespace opossum
@@ -24,7 +24,9 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const ExecutionMode execution_mode,
+                                           const std::shared_ptr<TaskGroup>& task_group)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
@@ -34,7 +36,9 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
       _prepared_statements(prepared_statements),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _execution_mode(execution_mode),
+      _task_group(task_group) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -241,7 +245,11 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
               "Physical query plan creation returned no or more than one plan for a single statement.");
 
   const auto& root = query_plan->tree_roots().front();
-  _tasks = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries);
+  _tasks = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries, _execution_mode);
+  for (const auto& task : _tasks) {
+    task->set_task_group(_task_group);
+  }
+
   return _tasks;
 }
 
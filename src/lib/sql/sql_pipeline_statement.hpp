@@ -6,6 +6,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
+#include "scheduler/task_group.hpp"
 #include "sql/sql_query_cache.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "storage/table.hpp"
@@ -47,7 +48,8 @@ class SQLPipelineStatement : public Noncopyable {
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
                        const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                       const CleanupTemporaries cleanup_temporaries);
+                       const CleanupTemporaries cleanup_temporaries, const ExecutionMode execution_mode,
+                       const std::shared_ptr<TaskGroup>& task_group = nullptr);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -108,6 +110,12 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  // Whether chains of operators are executed chunk by chunk, see OperatorTask::make_tasks_from_operator()
+  const ExecutionMode _execution_mode;
+
+  // The group in which the tasks are scheduled, see TaskGroup
+  const std::shared_ptr<TaskGroup> _task_group;
 };
 
 }  // namespace opossum
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "abstract_filter.hpp"
+#include "all_type_variant.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/murmur_hash.hpp"
+
+namespace opossum {
+
+//! default number of bits per distinct value, which results in a false positive rate of about 1%
+static constexpr uint32_t DEFAULT_BLOOM_FILTER_BITS_PER_VALUE = 10;
+
+/**
+ * Filter that stores which values are contained in a column, with a small rate of false positives.
+ * Unlike MinMaxFilter and RangeFilter, it is able to prune point lookups on columns whose values are spread over
+ * their entire domain, e.g., ID or string columns. It can only be used for Equals predicates.
+*/
+template <typename T>
+class BloomFilter : public AbstractFilter {
+ public:
+  BloomFilter(const size_t bit_count, const uint32_t hash_function_count)
+      : _words((bit_count + 63) / 64), _hash_function_count(hash_function_count) {
+    DebugAssert(bit_count > 0, "BloomFilter needs at least one bit");
+    DebugAssert(hash_function_count > 0, "BloomFilter needs at least one hash function");
+  }
+  ~BloomFilter() override = default;
+
+  static std::unique_ptr<BloomFilter<T>> build_filter(const pmr_vector<T>& dictionary,
+                                                      uint32_t bits_per_value = DEFAULT_BLOOM_FILTER_BITS_PER_VALUE);
+
+  void insert(const T& value) {
+    _for_each_bit(value, [&](const size_t bit) { _words[bit / 64] |= uint64_t{1} << (bit % 64); });
+  }
+
+  bool may_contain(const T& value) const {
+    auto contained = true;
+    _for_each_bit(value, [&](const size_t bit) { contained &= (_words[bit / 64] >> (bit % 64)) & 1; });
+    return contained;
+  }
+
+  bool can_prune(const AllTypeVariant& value, const PredicateCondition predicate_type) const override {
+    if (predicate_type != PredicateCondition::Equals || variant_is_null(value)) return false;
+
+    return !may_contain(type_cast<T>(value));
+  }
+
+ protected:
+  // The bits of a value are derived from two hashes (see Kirsch and Mitzenmacher, "Less Hashing, Same Performance:
+  // Building a Better Bloom Filter")
+  template <typename Functor>
+  void _for_each_bit(T value, const Functor& functor) const {
+    // 0.0 and -0.0 are equal, but their bits are not
+    if constexpr (std::is_floating_point_v<T>) {
+      if (value == T{0}) value = T{0};
+    }
+
+    const auto bit_count = _words.size() * 64;
+    const auto hash1 = static_cast<size_t>(murmur2<T>(value, 0));
+    const auto hash2 = static_cast<size_t>(murmur2<T>(value, 0x9e3779b9)) | 1u;
+
+    for (auto hash_function_id = size_t{0}; hash_function_id < _hash_function_count; ++hash_function_id) {
+      functor((hash1 + hash_function_id * hash2) % bit_count);
+    }
+  }
+
+  std::vector<uint64_t> _words;
+  const uint32_t _hash_function_count;
+};
+
+template <typename T>
+std::unique_ptr<BloomFilter<T>> BloomFilter<T>::build_filter(const pmr_vector<T>& dictionary,
+                                                             uint32_t bits_per_value) {
+  DebugAssert(!dictionary.empty(), "The dictionary should not be empty.");
+
+  // The number of hash functions that minimizes the false positive rate is ln(2) * bits per value
+  const auto hash_function_count = std::max(1u, static_cast<uint32_t>(std::round(std::log(2.0) * bits_per_value)));
+
+  auto filter = std::make_unique<BloomFilter<T>>(dictionary.size() * bits_per_value, hash_function_count);
+  for (const auto& value : dictionary) {
+    filter->insert(value);
+  }
+
+  return filter;
+}
+
+}  // namespace opossum
@@ -3,26 +3,52 @@
 #include <algorithm>
 #include <iterator>
 #include <type_traits>
-#include <unordered_set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "resolve_type.hpp"
 
 #include "abstract_filter.hpp"
+#include "bloom_filter.hpp"
 #include "min_max_filter.hpp"
+#include "prefix_filter.hpp"
 #include "range_filter.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/equi_height_histogram.hpp"
+#include "statistics/hyper_log_log.hpp"
 #include "storage/base_encoded_column.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/dictionary_column.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/run_length_column.hpp"
 #include "storage/value_column.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
+/**
+ * @param dictionary            the sorted, distinct non-null values of the column
+ * @param value_counts          the number of occurrences of each value of the dictionary
+ * @param null_value_count      the number of null values in the column
+ */
 template <typename T>
-static std::shared_ptr<ChunkColumnStatistics> build_statistics_from_dictionary(const pmr_vector<T>& dictionary) {
+static std::shared_ptr<ChunkColumnStatistics> build_statistics_from_dictionary(const pmr_vector<T>& dictionary,
+                                                                              const std::vector<size_t>& value_counts,
+                                                                              const size_t null_value_count) {
+  DebugAssert(dictionary.size() == value_counts.size(), "Need a value count for every value of the dictionary");
+
   auto statistics = std::make_shared<ChunkColumnStatistics>();
+
+  // every value occurs only once in the dictionary, which makes it the cheapest input for the sketch
+  auto distinct_count_sketch = std::make_shared<HyperLogLog>();
+  for (const auto& value : dictionary) {
+    distinct_count_sketch->add(value);
+  }
+  statistics->set_distinct_count_sketch(distinct_count_sketch);
+
   // only create statistics when the compressed dictionary is not empty
   if (!dictionary.empty()) {
     // no range filter for strings
@@ -34,8 +60,30 @@ static std::shared_ptr<ChunkColumnStatistics> build_statistics_from_dictionary(c
       // we only need the min-max filter if we cannot have a range filter
       auto min_max_filter = std::make_unique<MinMaxFilter<T>>(dictionary.front(), dictionary.back());
       statistics->add_filter(std::move(min_max_filter));
+
+      auto prefix_filter = PrefixFilter::build_filter(dictionary);
+      statistics->add_filter(std::move(prefix_filter));
     }
     // clang-format on
+
+    // with a single value, the filters above already prune every equality predicate the bloom filter would
+    if (dictionary.size() > 1) {
+      auto bloom_filter = BloomFilter<T>::build_filter(dictionary);
+      statistics->add_filter(std::move(bloom_filter));
+    }
+
+    auto histogram_value_counts = std::vector<std::pair<T, size_t>>{};
+    histogram_value_counts.reserve(dictionary.size());
+    auto row_count = null_value_count;
+    for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+      histogram_value_counts.emplace_back(dictionary[value_id], value_counts[value_id]);
+      row_count += value_counts[value_id];
+    }
+
+    const auto null_value_ratio = static_cast<float>(null_value_count) / static_cast<float>(row_count);
+    statistics->set_column_statistics(std::make_shared<ColumnStatistics<T>>(
+        null_value_ratio, static_cast<float>(dictionary.size()), dictionary.front(), dictionary.back(),
+        EquiHeightHistogram<T>::from_value_counts(histogram_value_counts)));
   }
   return statistics;
 }
@@ -49,29 +97,78 @@ std::shared_ptr<ChunkColumnStatistics> ChunkColumnStatistics::build_statistics(
 
     // clang-format off
     if constexpr(std::is_same_v<ColumnType, DictionaryColumn<DataTypeT>>) {
-        // we can use the fact that dictionary columns have an accessor for the dictionary
-        const auto& dictionary = *typed_column.dictionary();
-        statistics = build_statistics_from_dictionary(dictionary);
+      // we can use the fact that dictionary columns have an accessor for the dictionary and count the value ids
+      const auto& dictionary = *typed_column.dictionary();
+      const auto null_value_id = typed_column.null_value_id();
+
+      auto value_counts = std::vector<size_t>(dictionary.size());
+      auto null_value_count = size_t{0};
+      resolve_compressed_vector_type(*typed_column.attribute_vector(), [&](const auto& attribute_vector) {
+        for (auto value_id_iter = attribute_vector.cbegin(); value_id_iter != attribute_vector.cend();
+             ++value_id_iter) {
+          const auto value_id = static_cast<ValueID>(*value_id_iter);
+          if (value_id == null_value_id) {
+            ++null_value_count;
+          } else {
+            ++value_counts[value_id];
+          }
+        }
+      });
+
+      statistics = build_statistics_from_dictionary(dictionary, value_counts, null_value_count);
     } else {
       // if we have a generic column we create the dictionary ourselves
       auto iterable = create_iterable_from_column<DataTypeT>(typed_column);
-      std::unordered_set<DataTypeT> values;
+      std::unordered_map<DataTypeT, size_t> value_count_map;
+      auto null_value_count = size_t{0};
       iterable.for_each([&](const auto& value) {
-        // we are only interested in non-null values
-        if (!value.is_null()) {
-          values.insert(value.value());
+        // nulls are only counted, they are not part of the dictionary
+        if (value.is_null()) {
+          ++null_value_count;
+        } else {
+          ++value_count_map[value.value()];
         }
       });
-      pmr_vector<DataTypeT> dictionary{values.cbegin(), values.cend()};
+
+      pmr_vector<DataTypeT> dictionary;
+      dictionary.reserve(value_count_map.size());
+      for (const auto& value_count : value_count_map) {
+        dictionary.emplace_back(value_count.first);
+      }
       std::sort(dictionary.begin(), dictionary.end());
-      statistics = build_statistics_from_dictionary(dictionary);
+
+      auto value_counts = std::vector<size_t>{};
+      value_counts.reserve(dictionary.size());
+      for (const auto& value : dictionary) {
+        value_counts.emplace_back(value_count_map[value]);
+      }
+
+      statistics = build_statistics_from_dictionary(dictionary, value_counts, null_value_count);
     }
     // clang-format on
   });
   return statistics;
 }
+
 void ChunkColumnStatistics::add_filter(std::shared_ptr<AbstractFilter> filter) { _filters.emplace_back(filter); }
 
+std::shared_ptr<const HyperLogLog> ChunkColumnStatistics::distinct_count_sketch() const {
+  return _distinct_count_sketch;
+}
+
+void ChunkColumnStatistics::set_distinct_count_sketch(const std::shared_ptr<const HyperLogLog>& distinct_count_sketch) {
+  _distinct_count_sketch = distinct_count_sketch;
+}
+
+std::shared_ptr<const BaseColumnStatistics> ChunkColumnStatistics::column_statistics() const {
+  return _column_statistics;
+}
+
+void ChunkColumnStatistics::set_column_statistics(
+    const std::shared_ptr<const BaseColumnStatistics>& column_statistics) {
+  _column_statistics = column_statistics;
+}
+
 bool ChunkColumnStatistics::can_prune(const AllTypeVariant& value, const PredicateCondition predicate_type) const {
   for (const auto& filter : _filters) {
     if (filter->can_prune(value, predicate_type)) {
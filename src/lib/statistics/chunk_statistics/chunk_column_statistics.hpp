@@ -11,6 +11,8 @@
 namespace opossum {
 
 class BaseColumn;
+class BaseColumnStatistics;
+class HyperLogLog;
 
 /**
  * Container class that holds a set of filters with statistical information about a
@@ -28,7 +30,24 @@ class ChunkColumnStatistics final {
   */
   bool can_prune(const AllTypeVariant& value, const PredicateCondition predicate_type) const;
 
+  /**
+   * Sketch of the distinct values in the column. Since chunks with statistics are immutable, it is computed once and
+   * merged with the sketches of the other chunks whenever the statistics of the table are (re-)generated.
+   */
+  std::shared_ptr<const HyperLogLog> distinct_count_sketch() const;
+  void set_distinct_count_sketch(const std::shared_ptr<const HyperLogLog>& distinct_count_sketch);
+
+  /**
+   * ColumnStatistics (including a histogram) of the values in this chunk's column, nullptr if the column contains no
+   * non-null values. Like the sketch, these are merged into the statistics of the table's column, so that the chunk
+   * does not need to be scanned again.
+   */
+  std::shared_ptr<const BaseColumnStatistics> column_statistics() const;
+  void set_column_statistics(const std::shared_ptr<const BaseColumnStatistics>& column_statistics);
+
  protected:
   std::vector<std::shared_ptr<AbstractFilter>> _filters;
+  std::shared_ptr<const HyperLogLog> _distinct_count_sketch;
+  std::shared_ptr<const BaseColumnStatistics> _column_statistics;
 };
 }  // namespace opossum
@@ -0,0 +1,73 @@
+#include "prefix_filter.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/evaluation/like_matcher.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+PrefixFilter::PrefixFilter(std::vector<std::string> prefixes, const uint32_t prefix_length)
+    : _prefixes(std::move(prefixes)), _prefix_length(prefix_length) {
+  DebugAssert(std::is_sorted(_prefixes.begin(), _prefixes.end()), "Prefixes need to be sorted");
+}
+
+std::unique_ptr<PrefixFilter> PrefixFilter::build_filter(const pmr_vector<std::string>& dictionary,
+                                                         uint32_t prefix_length, uint32_t max_prefix_count) {
+  DebugAssert(!dictionary.empty(), "The dictionary should not be empty.");
+  DebugAssert(prefix_length > 0, "Prefixes need to have at least one character");
+
+  // Since the dictionary is sorted, so are the prefixes of its values, and duplicates are next to each other
+  std::vector<std::string> prefixes;
+  while (true) {
+    prefixes.clear();
+    for (const auto& value : dictionary) {
+      auto prefix = value.substr(0, prefix_length);
+      if (prefixes.empty() || prefixes.back() != prefix) prefixes.emplace_back(std::move(prefix));
+    }
+
+    // Single characters result in no more than 256 prefixes, shorter prefixes are not possible anyway
+    if (prefixes.size() <= max_prefix_count || prefix_length == 1) break;
+    --prefix_length;
+  }
+
+  return std::make_unique<PrefixFilter>(std::move(prefixes), prefix_length);
+}
+
+bool PrefixFilter::can_prune(const AllTypeVariant& value, const PredicateCondition predicate_type) const {
+  if (variant_is_null(value)) return false;
+
+  switch (predicate_type) {
+    case PredicateCondition::Equals: {
+      const auto prefix = type_cast<std::string>(value).substr(0, _prefix_length);
+      return !std::binary_search(_prefixes.begin(), _prefixes.end(), prefix);
+    }
+    case PredicateCondition::Like: {
+      // Only patterns that start with a fixed string can be pruned, e.g., 'abc%' or 'abc_def%'
+      const auto tokens = LikeMatcher::pattern_string_to_tokens(type_cast<std::string>(value));
+      if (tokens.empty() || tokens.front().type() != typeid(std::string)) return false;
+
+      const auto& fixed_prefix = boost::get<std::string>(tokens.front());
+      return !_may_contain_prefix(fixed_prefix.substr(0, _prefix_length));
+    }
+    default:
+      return false;
+  }
+}
+
+const std::vector<std::string>& PrefixFilter::prefixes() const { return _prefixes; }
+
+uint32_t PrefixFilter::prefix_length() const { return _prefix_length; }
+
+bool PrefixFilter::_may_contain_prefix(const std::string& prefix) const {
+  // All prefixes that start with prefix follow directly after the position that prefix would be inserted at
+  const auto iter = std::lower_bound(_prefixes.begin(), _prefixes.end(), prefix);
+  return iter != _prefixes.end() && iter->compare(0, prefix.size(), prefix) == 0;
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_filter.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+//! default length of the prefixes stored by a PrefixFilter
+static constexpr uint32_t DEFAULT_PREFIX_LENGTH = 4;
+
+//! default maximum number of prefixes stored by a PrefixFilter
+static constexpr uint32_t MAX_PREFIX_COUNT = 256;
+
+/**
+ * Filter that stores the distinct prefixes of the values in a string column. It can prune LIKE predicates whose
+ * pattern starts with a fixed string (e.g., LIKE 'abc%') as well as Equals predicates.
+ * The prefixes are shortened until there are no more than max_prefix_count of them.
+ * Example: ["apple", "apricot", "banana"] might be represented as ["ap", "ba"]
+*/
+class PrefixFilter : public AbstractFilter {
+ public:
+  PrefixFilter(std::vector<std::string> prefixes, const uint32_t prefix_length);
+  ~PrefixFilter() override = default;
+
+  static std::unique_ptr<PrefixFilter> build_filter(const pmr_vector<std::string>& dictionary,
+                                                    uint32_t prefix_length = DEFAULT_PREFIX_LENGTH,
+                                                    uint32_t max_prefix_count = MAX_PREFIX_COUNT);
+
+  bool can_prune(const AllTypeVariant& value, const PredicateCondition predicate_type) const override;
+
+  const std::vector<std::string>& prefixes() const;
+  uint32_t prefix_length() const;
+
+ protected:
+  // Whether any of the values might start with prefix
+  bool _may_contain_prefix(const std::string& prefix) const;
+
+  // Sorted and distinct. Values shorter than _prefix_length are stored completely.
+  std::vector<std::string> _prefixes;
+  uint32_t _prefix_length;
+};
+
+}  // namespace opossum
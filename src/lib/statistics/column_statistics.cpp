@@ -18,11 +18,13 @@ ColumnStatistics<ColumnDataType> ColumnStatistics<ColumnDataType>::dummy() {
 }
 
 template <typename ColumnDataType>
-ColumnStatistics<ColumnDataType>::ColumnStatistics(const float null_value_ratio, const float distinct_count,
-                                                   const ColumnDataType min, const ColumnDataType max)
+ColumnStatistics<ColumnDataType>::ColumnStatistics(
+    const float null_value_ratio, const float distinct_count, const ColumnDataType min, const ColumnDataType max,
+    const std::shared_ptr<const EquiHeightHistogram<ColumnDataType>>& histogram)
     : BaseColumnStatistics(data_type_from_type<ColumnDataType>(), null_value_ratio, distinct_count),
       _min(min),
-      _max(max) {
+      _max(max),
+      _histogram(histogram) {
   Assert(null_value_ratio >= 0.0f && null_value_ratio <= 1.0f, "NullValueRatio out of range");
 }
 
@@ -36,9 +38,15 @@ ColumnDataType ColumnStatistics<ColumnDataType>::max() const {
   return _max;
 }
 
+template <typename ColumnDataType>
+std::shared_ptr<const EquiHeightHistogram<ColumnDataType>> ColumnStatistics<ColumnDataType>::histogram() const {
+  return _histogram;
+}
+
 template <typename ColumnDataType>
 std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnDataType>::clone() const {
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max,
+                                                            _histogram);
 }
 
 template <typename ColumnDataType>
@@ -60,6 +68,10 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_
       if (std::is_integral_v<ColumnDataType>) {
         return estimate_range(_min, value - 1);
       }
+      // with a histogram, the number of rows that equal value is known and can be excluded
+      if (_histogram) {
+        return _estimate_range_excluding_value(_min, value, value);
+      }
       // intentionally no break
       // if ColumnType is a floating point number, OpLessThanEquals behaviour is expected instead of OpLessThan
       [[fallthrough]];
@@ -74,6 +86,10 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_
       if (std::is_integral_v<ColumnDataType>) {
         return estimate_range(value + 1, _max);
       }
+      // with a histogram, the number of rows that equal value is known and can be excluded
+      if (_histogram) {
+        return _estimate_range_excluding_value(value, _max, value);
+      }
       // intentionally no break
       // if ColumnType is a floating point number,
       // OpGreaterThanEquals behaviour is expected instead of OpGreaterThan
@@ -113,7 +129,28 @@ FilterByValueEstimate ColumnStatistics<std::string>::estimate_predicate_with_val
     case PredicateCondition::NotEquals: {
       return estimate_not_equals_with_value(casted_value);
     }
-    // TODO(anybody) implement other table-scan operators for string.
+    default:
+      break;
+  }
+
+  // Without a histogram, there is no telling how many strings lie in a range
+  if (!_histogram) {
+    return {non_null_value_ratio(), without_null_values()};
+  }
+
+  switch (predicate_condition) {
+    case PredicateCondition::LessThan:
+      return _estimate_range_excluding_value(_min, casted_value, casted_value);
+    case PredicateCondition::LessThanEquals:
+      return estimate_range(_min, casted_value);
+    case PredicateCondition::GreaterThan:
+      return _estimate_range_excluding_value(casted_value, _max, casted_value);
+    case PredicateCondition::GreaterThanEquals:
+      return estimate_range(casted_value, _max);
+    case PredicateCondition::Between: {
+      DebugAssert(static_cast<bool>(value2), "Operator BETWEEN should get two parameters, second is missing!");
+      return estimate_range(casted_value, type_cast<std::string>(*value2));
+    }
     default: { return {non_null_value_ratio(), without_null_values()}; }
   }
 }
@@ -385,6 +422,9 @@ std::string ColumnStatistics<ColumnDataType>::description() const {
   stream << "  min      " << _min << std::endl;
   stream << "  max      " << _max << std::endl;
   stream << "  non-null " << non_null_value_ratio() << std::endl;
+  if (_histogram) {
+    stream << _histogram->description();
+  }
   return stream.str();
 }
 
@@ -396,6 +436,10 @@ float ColumnStatistics<ColumnDataType>::estimate_range_selectivity(const ColumnD
   // distinction between integers and decimals
   // for integers the number of possible integers is used within the inclusive ranges
   // for decimals the size of the range is used
+  // if there is a histogram, it knows better
+  if (_histogram && _histogram->total_count() > 0.0f) {
+    return _histogram->estimate_count_in_range(minimum, maximum) / _histogram->total_count();
+  }
   if (std::is_integral<ColumnDataType>::value) {
     return static_cast<float>(maximum - minimum + 1) / static_cast<float>(_max - _min + 1);
   } else {
@@ -413,7 +457,10 @@ float ColumnStatistics<ColumnDataType>::estimate_range_selectivity(const ColumnD
 template <>
 float ColumnStatistics<std::string>::estimate_range_selectivity(const std::string minimum,          // NOLINT
                                                                 const std::string maximum) const {  // NOLINT
-  // TODO(anyone) implement selectivity for range approximation for column type string.
+  if (_histogram && _histogram->total_count() > 0.0f) {
+    return _histogram->estimate_count_in_range(minimum, maximum) / _histogram->total_count();
+  }
+  // TODO(anyone) implement selectivity for range approximation for column type string without histogram.
   return (maximum < minimum) ? 0.f : 1.f;
 }
 
@@ -428,18 +475,33 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_range(const Col
     return {non_null_value_ratio(), without_null_values()};
   }
   auto selectivity = 0.f;
+  auto new_distinct_count = 0.f;
+  auto histogram = std::shared_ptr<const EquiHeightHistogram<ColumnDataType>>{};
   // estimate_selectivity_for_range function expects that the minimum must not be greater than the maximum
   if (common_min <= common_max) {
     selectivity = estimate_range_selectivity(common_min, common_max);
+    if (_histogram) {
+      new_distinct_count = _histogram->estimate_distinct_count_in_range(common_min, common_max);
+      histogram = _histogram->sliced(common_min, common_max);
+    } else {
+      new_distinct_count = selectivity * distinct_count();
+    }
   }
-  auto column_statistics =
-      std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, selectivity * distinct_count(), common_min, common_max);
+  auto column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, new_distinct_count, common_min,
+                                                                              common_max, histogram);
   return {non_null_value_ratio() * selectivity, column_statistics};
 }
 
 template <typename ColumnDataType>
 FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_equals_with_value(const ColumnDataType value) const {
   DebugAssert(distinct_count() > 0, "Distinct count has to be greater zero");
+  if (_histogram && _histogram->total_count() > 0.0f) {
+    const auto count = _histogram->estimate_count_equals(value);
+    auto column_statistics =
+        std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, count > 0.0f ? 1.f : 0.f, value, value);
+    return {non_null_value_ratio() * count / _histogram->total_count(), column_statistics};
+  }
+
   float new_distinct_count = 1.f;
   if (value < _min || value > _max) {
     new_distinct_count = 0.f;
@@ -460,6 +522,10 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_not_equals_with
     return {non_null_value_ratio(), without_null_values()};
   }
   auto column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, distinct_count() - 1, _min, _max);
+  if (_histogram && _histogram->total_count() > 0.0f) {
+    const auto equals_ratio = _histogram->estimate_count_equals(value) / _histogram->total_count();
+    return {non_null_value_ratio() * (1 - equals_ratio), column_statistics};
+  }
   if (distinct_count() == 0.0f) {
     return {0.0f, column_statistics};
   } else {
@@ -467,5 +533,16 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_not_equals_with
   }
 }
 
+template <typename ColumnDataType>
+FilterByValueEstimate ColumnStatistics<ColumnDataType>::_estimate_range_excluding_value(
+    const ColumnDataType minimum, const ColumnDataType maximum, const ColumnDataType excluded_value) const {
+  auto estimate = estimate_range(minimum, maximum);
+  if (estimate.selectivity > 0.0f) {
+    estimate.selectivity =
+        std::max(0.0f, estimate.selectivity - estimate_equals_with_value(excluded_value).selectivity);
+  }
+  return estimate;
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnStatistics);
 }  // namespace opossum
@@ -7,6 +7,7 @@
 
 #include "all_type_variant.hpp"
 #include "base_column_statistics.hpp"
+#include "equi_height_histogram.hpp"
 
 namespace opossum {
 
@@ -19,8 +20,13 @@ class ColumnStatistics : public BaseColumnStatistics {
   // To be used for columns for which ColumnStatistics can't be computed
   static ColumnStatistics dummy();
 
+  /**
+   * @param histogram   optional, describes the distribution of the non-null values. Without it, values are assumed to
+   *                    be uniformly distributed in [min, max].
+   */
   ColumnStatistics(const float null_value_ratio, const float distinct_count, const ColumnDataType min,
-                   const ColumnDataType max);
+                   const ColumnDataType max,
+                   const std::shared_ptr<const EquiHeightHistogram<ColumnDataType>>& histogram = nullptr);
 
   /**
    * @defgroup Member access
@@ -28,6 +34,7 @@ class ColumnStatistics : public BaseColumnStatistics {
    */
   ColumnDataType min() const;
   ColumnDataType max() const;
+  std::shared_ptr<const EquiHeightHistogram<ColumnDataType>> histogram() const;
   /** @} */
 
   /**
@@ -77,8 +84,13 @@ class ColumnStatistics : public BaseColumnStatistics {
   /** @} */
 
  private:
+  // Estimate the range, but without the rows with excluded_value, e.g., for `column < value` on floats or strings
+  FilterByValueEstimate _estimate_range_excluding_value(const ColumnDataType minimum, const ColumnDataType maximum,
+                                                        const ColumnDataType excluded_value) const;
+
   ColumnDataType _min;
   ColumnDataType _max;
+  std::shared_ptr<const EquiHeightHistogram<ColumnDataType>> _histogram;
 };
 
 }  // namespace opossum
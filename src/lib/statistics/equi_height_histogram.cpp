@@ -0,0 +1,284 @@
+#include "equi_height_histogram.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+std::shared_ptr<EquiHeightHistogram<T>> EquiHeightHistogram<T>::from_value_counts(
+    const std::vector<std::pair<T, size_t>>& value_counts, const size_t max_bin_count) {
+  DebugAssert(max_bin_count > 0, "Need at least one bin");
+  DebugAssert(std::is_sorted(value_counts.begin(), value_counts.end(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }),
+              "Value counts need to be sorted by value");
+
+  auto total_count = size_t{0};
+  for (const auto& value_count : value_counts) {
+    total_count += value_count.second;
+  }
+
+  const auto target_height = std::max(1.0f, static_cast<float>(total_count) / static_cast<float>(max_bin_count));
+
+  auto bins = std::vector<HistogramBin<T>>{};
+  bins.reserve(max_bin_count);
+
+  auto current_bin = std::optional<HistogramBin<T>>{};
+  const auto close_current_bin = [&]() {
+    if (!current_bin) return;
+    bins.emplace_back(*current_bin);
+    current_bin.reset();
+  };
+
+  for (const auto& [value, count] : value_counts) {
+    const auto height = static_cast<float>(count);
+
+    if (height >= target_height) {
+      close_current_bin();
+      bins.emplace_back(HistogramBin<T>{value, value, height, 1.0f});
+      continue;
+    }
+
+    if (!current_bin) {
+      current_bin = HistogramBin<T>{value, value, 0.0f, 0.0f};
+    }
+    current_bin->max = value;
+    current_bin->height += height;
+    current_bin->distinct_count += 1.0f;
+
+    if (current_bin->height >= target_height) close_current_bin();
+  }
+  close_current_bin();
+
+  return std::make_shared<EquiHeightHistogram<T>>(std::move(bins));
+}
+
+template <typename T>
+std::shared_ptr<EquiHeightHistogram<T>> EquiHeightHistogram<T>::merge(
+    const std::vector<std::shared_ptr<const EquiHeightHistogram<T>>>& histograms, const float total_distinct_count,
+    const size_t max_bin_count) {
+  DebugAssert(max_bin_count > 0, "Need at least one bin");
+
+  auto input_bins = std::vector<HistogramBin<T>>{};
+  auto total_count = 0.0f;
+  for (const auto& histogram : histograms) {
+    if (!histogram) continue;
+    input_bins.insert(input_bins.end(), histogram->bins().begin(), histogram->bins().end());
+    total_count += histogram->total_count();
+  }
+
+  std::sort(input_bins.begin(), input_bins.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.min < rhs.min || (!(rhs.min < lhs.min) && lhs.max < rhs.max);
+  });
+
+  const auto target_height = std::max(1.0f, total_count / static_cast<float>(max_bin_count));
+
+  auto bins = std::vector<HistogramBin<T>>{};
+  bins.reserve(max_bin_count);
+
+  for (const auto& input_bin : input_bins) {
+    // Overlapping bins have to be combined for the bins to stay disjoint. Disjoint bins are only combined as long as
+    // the current bin is not high enough yet. A heavy value always starts a bin of its own.
+    const auto is_heavy_value = input_bin.min == input_bin.max && input_bin.height >= target_height;
+    const auto overlaps_with_last_bin = !bins.empty() && !(bins.back().max < input_bin.min);
+    const auto last_bin_is_open = !bins.empty() && bins.back().height < target_height;
+
+    if (overlaps_with_last_bin || (last_bin_is_open && !is_heavy_value)) {
+      auto& bin = bins.back();
+      bin.max = std::max(bin.max, input_bin.max);
+      bin.height += input_bin.height;
+      bin.distinct_count += input_bin.distinct_count;
+    } else {
+      bins.emplace_back(input_bin);
+    }
+  }
+
+  // The distinct counts of the inputs were added up, which counts values present in multiple inputs multiple times
+  auto summed_distinct_count = 0.0f;
+  for (auto& bin : bins) {
+    if (bin.min == bin.max) {
+      bin.distinct_count = 1.0f;
+    } else if constexpr (std::is_integral_v<T>) {
+      const auto value_count = static_cast<double>(bin.max) - static_cast<double>(bin.min) + 1;
+      bin.distinct_count = static_cast<float>(std::min(static_cast<double>(bin.distinct_count), value_count));
+    }
+    summed_distinct_count += bin.distinct_count;
+  }
+
+  if (summed_distinct_count > total_distinct_count && summed_distinct_count > 0.0f) {
+    const auto scale = total_distinct_count / summed_distinct_count;
+    for (auto& bin : bins) {
+      bin.distinct_count = std::max(1.0f, bin.distinct_count * scale);
+    }
+  }
+
+  return std::make_shared<EquiHeightHistogram<T>>(std::move(bins));
+}
+
+template <typename T>
+EquiHeightHistogram<T>::EquiHeightHistogram(std::vector<HistogramBin<T>> bins) : _bins(std::move(bins)) {
+  for (auto bin_id = size_t{0}; bin_id < _bins.size(); ++bin_id) {
+    const auto& bin = _bins[bin_id];
+    Assert(bin.min <= bin.max, "Bin boundaries are inverted");
+    Assert(bin_id == 0 || _bins[bin_id - 1].max < bin.min, "Bins need to be sorted and must not overlap");
+
+    _total_count += bin.height;
+    _total_distinct_count += bin.distinct_count;
+  }
+}
+
+template <typename T>
+const std::vector<HistogramBin<T>>& EquiHeightHistogram<T>::bins() const {
+  return _bins;
+}
+
+template <typename T>
+float EquiHeightHistogram<T>::total_count() const {
+  return _total_count;
+}
+
+template <typename T>
+float EquiHeightHistogram<T>::total_distinct_count() const {
+  return _total_distinct_count;
+}
+
+template <typename T>
+float EquiHeightHistogram<T>::estimate_count_equals(const T& value) const {
+  // Find the first bin that does not end before value
+  const auto bin_iter = std::lower_bound(_bins.begin(), _bins.end(), value,
+                                         [](const auto& bin, const auto& other) { return bin.max < other; });
+  if (bin_iter == _bins.end() || value < bin_iter->min || bin_iter->distinct_count == 0.0f) return 0.0f;
+
+  return bin_iter->height / bin_iter->distinct_count;
+}
+
+template <typename T>
+float EquiHeightHistogram<T>::estimate_count_in_range(const T& minimum, const T& maximum) const {
+  auto count = 0.0f;
+  for (const auto& bin : _bins) {
+    if (bin.min > maximum) break;
+    count += bin.height * _bin_overlap_ratio(bin, minimum, maximum);
+  }
+  return count;
+}
+
+template <typename T>
+float EquiHeightHistogram<T>::estimate_distinct_count_in_range(const T& minimum, const T& maximum) const {
+  auto distinct_count = 0.0f;
+  for (const auto& bin : _bins) {
+    if (bin.min > maximum) break;
+    distinct_count += bin.distinct_count * _bin_overlap_ratio(bin, minimum, maximum);
+  }
+  return distinct_count;
+}
+
+template <typename T>
+std::shared_ptr<EquiHeightHistogram<T>> EquiHeightHistogram<T>::sliced(const T& minimum, const T& maximum) const {
+  auto bins = std::vector<HistogramBin<T>>{};
+
+  for (const auto& bin : _bins) {
+    if (bin.min > maximum) break;
+
+    const auto overlap_ratio = _bin_overlap_ratio(bin, minimum, maximum);
+    if (overlap_ratio == 0.0f) continue;
+
+    bins.emplace_back(HistogramBin<T>{std::max(bin.min, minimum), std::min(bin.max, maximum),
+                                      bin.height * overlap_ratio,
+                                      std::max(1.0f, bin.distinct_count * overlap_ratio)});
+  }
+
+  if (bins.empty()) return nullptr;
+  return std::make_shared<EquiHeightHistogram<T>>(std::move(bins));
+}
+
+template <typename T>
+bool EquiHeightHistogram<T>::is_approximately_uniform() const {
+  if (_bins.empty()) return true;
+
+  const auto average_frequency = _total_count / _total_distinct_count;
+
+  for (const auto& bin : _bins) {
+    const auto bin_frequency = bin.height / bin.distinct_count;
+    if (bin_frequency > average_frequency * MAX_FREQUENCY_DEVIATION ||
+        bin_frequency * MAX_FREQUENCY_DEVIATION < average_frequency) {
+      return false;
+    }
+  }
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    // Compare the cumulative distribution of the values with the one a uniform distribution in [min, max] would have.
+    // Since the values are discrete, the uniform distribution may lie anywhere between the ratio of rows before and the
+    // ratio of rows up to (including) a bin.
+    const auto min = static_cast<double>(_bins.front().min);
+    const auto max = static_cast<double>(_bins.back().max);
+
+    auto count_before_bin = 0.0f;
+    for (const auto& bin : _bins) {
+      auto uniform_ratio = 1.0f;
+      if constexpr (std::is_integral_v<T>) {
+        uniform_ratio = static_cast<float>((static_cast<double>(bin.max) - min + 1) / (max - min + 1));
+      } else if (max > min) {
+        uniform_ratio = static_cast<float>((static_cast<double>(bin.max) - min) / (max - min));
+      }
+
+      const auto ratio_before_bin = count_before_bin / _total_count;
+      const auto ratio_up_to_bin = (count_before_bin + bin.height) / _total_count;
+
+      if (uniform_ratio < ratio_before_bin - MAX_CUMULATIVE_DEVIATION ||
+          uniform_ratio > ratio_up_to_bin + MAX_CUMULATIVE_DEVIATION) {
+        return false;
+      }
+
+      count_before_bin += bin.height;
+    }
+  }
+
+  return true;
+}
+
+template <typename T>
+std::string EquiHeightHistogram<T>::description() const {
+  std::stringstream stream;
+  stream << "Histogram (" << _bins.size() << " bins): " << std::endl;
+  for (const auto& bin : _bins) {
+    stream << "  [" << bin.min << ", " << bin.max << "] height: " << bin.height << " distinct: " << bin.distinct_count
+           << std::endl;
+  }
+  return stream.str();
+}
+
+template <typename T>
+float EquiHeightHistogram<T>::_bin_overlap_ratio(const HistogramBin<T>& bin, const T& minimum, const T& maximum) {
+  if (maximum < bin.min || minimum > bin.max || maximum < minimum) return 0.0f;
+  if (minimum <= bin.min && maximum >= bin.max) return 1.0f;
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    // Use doubles so that the widths of bins of int64_t values do not overflow
+    const auto overlap_min = static_cast<double>(std::max(minimum, bin.min));
+    const auto overlap_max = static_cast<double>(std::min(maximum, bin.max));
+    const auto bin_min = static_cast<double>(bin.min);
+    const auto bin_max = static_cast<double>(bin.max);
+
+    if constexpr (std::is_integral_v<T>) {
+      return static_cast<float>((overlap_max - overlap_min + 1) / (bin_max - bin_min + 1));
+    } else {
+      // The bin is wider than a single value, otherwise it would have been fully covered
+      return static_cast<float>((overlap_max - overlap_min) / (bin_max - bin_min));
+    }
+  } else {
+    // Strings cannot be interpolated, so assume that half of the bin is covered
+    return 0.5f;
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(EquiHeightHistogram);
+
+}  // namespace opossum
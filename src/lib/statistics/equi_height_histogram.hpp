@@ -0,0 +1,110 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+struct HistogramBin {
+  T min;
+  T max;
+
+  // Number of non-null rows with a value in [min, max]
+  float height;
+  float distinct_count;
+};
+
+/**
+ * Equi-height histogram over the non-null values of a column. Used by ColumnStatistics to estimate predicates on
+ * columns whose values are not uniformly distributed.
+ *
+ * The bins are disjoint, sorted and each of them holds about the same number of rows. Values that alone are more
+ * frequent than a bin is high get a bin of their own, so that predicates on the most frequent values (which are the
+ * ones the uniformity assumption gets wrong the worst) are estimated exactly. Within a bin, values are assumed to be
+ * uniformly distributed. For strings, a bin that only partially overlaps with a range is assumed to be half-covered.
+ */
+template <typename T>
+class EquiHeightHistogram {
+ public:
+  static constexpr auto DEFAULT_BIN_COUNT = size_t{100};
+
+  /**
+   * If the frequency of the values in any bin deviates from the average frequency by more than this factor, the
+   * column is considered skewed.
+   */
+  static constexpr auto MAX_FREQUENCY_DEVIATION = 2.0f;
+
+  /**
+   * If the ratio of rows that the uniformity assumption puts below any bin's upper bound deviates from the actual
+   * ratio by more than this, the column is considered skewed.
+   */
+  static constexpr auto MAX_CUMULATIVE_DEVIATION = 0.1f;
+
+  /**
+   * @param value_counts    distinct values and their number of occurrences, sorted by value
+   * @param max_bin_count   the number of bins the rows are spread over. Values that are heavier than a bin get their
+   *                        own bin, so the actual number of bins can be larger.
+   */
+  static std::shared_ptr<EquiHeightHistogram<T>> from_value_counts(
+      const std::vector<std::pair<T, size_t>>& value_counts, const size_t max_bin_count = DEFAULT_BIN_COUNT);
+
+  /**
+   * Combine histograms of different parts of a column (e.g., chunks) into one. Since the value counts of the parts are
+   * no longer known, the result is an approximation: bins that overlap are combined and the distinct counts of the bins
+   * are scaled so that they add up to total_distinct_count (which, e.g., a HyperLogLog sketch can provide).
+   */
+  static std::shared_ptr<EquiHeightHistogram<T>> merge(
+      const std::vector<std::shared_ptr<const EquiHeightHistogram<T>>>& histograms, const float total_distinct_count,
+      const size_t max_bin_count = DEFAULT_BIN_COUNT);
+
+  explicit EquiHeightHistogram(std::vector<HistogramBin<T>> bins);
+
+  const std::vector<HistogramBin<T>>& bins() const;
+  float total_count() const;
+  float total_distinct_count() const;
+
+  /**
+   * @return the estimated number of rows with `value`
+   */
+  float estimate_count_equals(const T& value) const;
+
+  /**
+   * @return the estimated number of rows with a value in [minimum, maximum]
+   */
+  float estimate_count_in_range(const T& minimum, const T& maximum) const;
+
+  /**
+   * @return the estimated number of distinct values in [minimum, maximum]
+   */
+  float estimate_distinct_count_in_range(const T& minimum, const T& maximum) const;
+
+  /**
+   * @return a histogram of the rows within [minimum, maximum], nullptr if there are none
+   */
+  std::shared_ptr<EquiHeightHistogram<T>> sliced(const T& minimum, const T& maximum) const;
+
+  /**
+   * @return whether min, max and distinct count alone are a good enough description of the column, i.e., the
+   *         frequencies of the values are about equal and, for arithmetic types, the values are spread evenly over
+   *         [min, max]. For such columns, the histogram does not improve estimations and is not worth keeping.
+   */
+  bool is_approximately_uniform() const;
+
+  std::string description() const;
+
+ private:
+  // Ratio of the bin's values that lie in [minimum, maximum]
+  static float _bin_overlap_ratio(const HistogramBin<T>& bin, const T& minimum, const T& maximum);
+
+  std::vector<HistogramBin<T>> _bins;
+  float _total_count{0.0f};
+  float _total_distinct_count{0.0f};
+};
+
+}  // namespace opossum
@@ -1,58 +1,247 @@
 #pragma once
 
-#include <unordered_set>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "base_column_statistics.hpp"
+#include "chunk_statistics/chunk_column_statistics.hpp"
+#include "chunk_statistics/chunk_statistics.hpp"
 #include "column_statistics.hpp"
+#include "equi_height_histogram.hpp"
+#include "hyper_log_log.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
+/**
+ * Distinct values of a part of a column and their number of occurrences, sorted by value
+ */
+template <typename ColumnDataType>
+using ValueCounts = std::vector<std::pair<ColumnDataType, size_t>>;
+
+/**
+ * Merge two ValueCounts into one, adding up the counts of values contained in both.
+ */
+template <typename ColumnDataType>
+ValueCounts<ColumnDataType> merge_value_counts(const ValueCounts<ColumnDataType>& left,
+                                               const ValueCounts<ColumnDataType>& right) {
+  auto merged = ValueCounts<ColumnDataType>{};
+  merged.reserve(std::max(left.size(), right.size()));
+
+  auto left_iter = left.begin();
+  auto right_iter = right.begin();
+
+  while (left_iter != left.end() && right_iter != right.end()) {
+    if (left_iter->first < right_iter->first) {
+      merged.emplace_back(*left_iter++);
+    } else if (right_iter->first < left_iter->first) {
+      merged.emplace_back(*right_iter++);
+    } else {
+      merged.emplace_back(left_iter->first, left_iter->second + right_iter->second);
+      ++left_iter;
+      ++right_iter;
+    }
+  }
+
+  merged.insert(merged.end(), left_iter, left.end());
+  merged.insert(merged.end(), right_iter, right.end());
+
+  return merged;
+}
+
+/**
+ * Up to this number of distinct values (summed up over the chunks), the values of a column are counted exactly. Above
+ * it, the distinct count is estimated from HyperLogLog sketches and the histogram is merged from the chunks'
+ * histograms, so that the memory consumption does not grow with the size of the column.
+ */
+constexpr auto DEFAULT_EXACT_DISTINCT_COUNT_THRESHOLD = size_t{100'000};
+
 /**
  * Generate the statistics of a single column. Used by generate_table_statistics()
+ *
+ * Each chunk is processed in a separate task, which counts its values and builds a histogram and a HyperLogLog sketch
+ * of them. These are then merged. Chunks that were encoded by the ChunkEncoder already come with both (see
+ * ChunkColumnStatistics). If their distinct counts alone exceed the exact_distinct_count_threshold, they are not
+ * scanned again, so that regenerating the statistics of a large table only has to scan its mutable chunks.
+ *
+ * The histogram is only kept if the column is not uniformly distributed - otherwise, min, max and distinct count
+ * describe it just as well.
  */
 template <typename ColumnDataType>
-std::shared_ptr<BaseColumnStatistics> generate_column_statistics(const Table& table, const ColumnID column_id) {
-  std::unordered_set<ColumnDataType> distinct_set;
+std::shared_ptr<BaseColumnStatistics> generate_column_statistics(
+    const Table& table, const ColumnID column_id,
+    const size_t exact_distinct_count_threshold = DEFAULT_EXACT_DISTINCT_COUNT_THRESHOLD) {
+  const auto chunk_count = table.chunk_count();
 
-  auto null_value_count = size_t{0};
+  auto chunk_value_counts = std::vector<ValueCounts<ColumnDataType>>(chunk_count);
+  auto chunk_histograms = std::vector<std::shared_ptr<const EquiHeightHistogram<ColumnDataType>>>(chunk_count);
+  auto chunk_sketches = std::vector<std::shared_ptr<const HyperLogLog>>(chunk_count);
+  auto chunk_null_value_counts = std::vector<size_t>(chunk_count);
+
+  auto precomputed_statistics = std::vector<std::shared_ptr<const ChunkColumnStatistics>>(chunk_count);
+  auto precomputed_distinct_count = 0.0f;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_statistics = table.get_chunk(chunk_id)->statistics();
+    if (!chunk_statistics || static_cast<size_t>(column_id) >= chunk_statistics->statistics().size()) continue;
+
+    const auto& chunk_column_statistics = chunk_statistics->statistics()[column_id];
+    if (!chunk_column_statistics->column_statistics() || !chunk_column_statistics->distinct_count_sketch()) continue;
+
+    precomputed_statistics[chunk_id] = chunk_column_statistics;
+    precomputed_distinct_count += chunk_column_statistics->column_statistics()->distinct_count();
+  }
+
+  // If this is true, the values cannot be counted exactly anyway
+  const auto use_precomputed_statistics =
+      precomputed_distinct_count > static_cast<float>(exact_distinct_count_threshold);
+
+  // The value counts of the chunks are only kept while their summed up size stays below the threshold
+  auto kept_value_count = std::atomic<size_t>{0};
+  auto value_counts_are_complete = std::atomic_bool{!use_precomputed_statistics};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = table.get_chunk(chunk_id);
 
-  auto min = std::numeric_limits<ColumnDataType>::max();
-  auto max = std::numeric_limits<ColumnDataType>::lowest();
+      if (use_precomputed_statistics && precomputed_statistics[chunk_id]) {
+        const auto chunk_column_statistics = std::dynamic_pointer_cast<const ColumnStatistics<ColumnDataType>>(
+            precomputed_statistics[chunk_id]->column_statistics());
+        DebugAssert(chunk_column_statistics, "Chunk statistics have the wrong data type");
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
-    const auto base_column = table.get_chunk(chunk_id)->get_column(column_id);
+        chunk_histograms[chunk_id] = chunk_column_statistics->histogram();
+        chunk_sketches[chunk_id] = precomputed_statistics[chunk_id]->distinct_count_sketch();
+        chunk_null_value_counts[chunk_id] =
+            static_cast<size_t>(std::round(chunk_column_statistics->null_value_ratio() * chunk->size()));
+        return;
+      }
 
-    resolve_column_type<ColumnDataType>(*base_column, [&](auto& column) {
-      auto iterable = create_iterable_from_column<ColumnDataType>(column);
-      iterable.for_each([&](const auto& column_value) {
-        if (column_value.is_null()) {
-          ++null_value_count;
+      const auto base_column = chunk->get_column(column_id);
+
+      // It would be nice to use string_view for strings here, but the iterables hold copies of the values, not
+      // references themselves.
+      auto values = std::vector<ColumnDataType>{};
+      values.reserve(base_column->size());
+
+      resolve_column_type<ColumnDataType>(*base_column, [&](auto& column) {
+        auto iterable = create_iterable_from_column<ColumnDataType>(column);
+        iterable.for_each([&](const auto& column_value) {
+          if (column_value.is_null()) {
+            ++chunk_null_value_counts[chunk_id];
+          } else {
+            values.emplace_back(column_value.value());
+          }
+        });
+      });
+
+      std::sort(values.begin(), values.end());
+
+      auto value_counts = ValueCounts<ColumnDataType>{};
+      for (auto& value : values) {
+        if (!value_counts.empty() && value_counts.back().first == value) {
+          ++value_counts.back().second;
         } else {
-          distinct_set.insert(column_value.value());
-          min = std::min(min, column_value.value());
-          max = std::max(max, column_value.value());
+          value_counts.emplace_back(std::move(value), size_t{1});
         }
-      });
-    });
+      }
+
+      if (!value_counts.empty()) {
+        chunk_histograms[chunk_id] = EquiHeightHistogram<ColumnDataType>::from_value_counts(value_counts);
+      }
+
+      if (precomputed_statistics[chunk_id]) {
+        chunk_sketches[chunk_id] = precomputed_statistics[chunk_id]->distinct_count_sketch();
+      } else {
+        auto sketch = std::make_shared<HyperLogLog>();
+        for (const auto& value_count : value_counts) {
+          sketch->add(value_count.first);
+        }
+        chunk_sketches[chunk_id] = sketch;
+      }
+
+      if (!value_counts_are_complete) return;
+
+      const auto distinct_count = value_counts.size();
+      if (kept_value_count.fetch_add(distinct_count) + distinct_count <= exact_distinct_count_threshold) {
+        chunk_value_counts[chunk_id] = std::move(value_counts);
+      } else {
+        value_counts_are_complete = false;
+      }
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto null_value_count = size_t{0};
+  for (const auto chunk_null_value_count : chunk_null_value_counts) {
+    null_value_count += chunk_null_value_count;
   }
 
   const auto null_value_ratio =
       table.row_count() > 0 ? static_cast<float>(null_value_count) / static_cast<float>(table.row_count()) : 0.0f;
-  const auto distinct_count = static_cast<float>(distinct_set.size());
 
-  if (distinct_count == 0.0f) {
-    min = std::numeric_limits<ColumnDataType>::min();
-    max = std::numeric_limits<ColumnDataType>::max();
+  auto distinct_count = 0.0f;
+  auto histogram = std::shared_ptr<const EquiHeightHistogram<ColumnDataType>>{};
+
+  if (value_counts_are_complete) {
+    // Merge pairwise, so that every value is copied log(chunk_count) times at most
+    while (chunk_value_counts.size() > 1) {
+      auto merged_value_counts = std::vector<ValueCounts<ColumnDataType>>{};
+      merged_value_counts.reserve(chunk_value_counts.size() / 2 + 1);
+
+      for (auto index = size_t{0}; index + 1 < chunk_value_counts.size(); index += 2) {
+        merged_value_counts.emplace_back(merge_value_counts(chunk_value_counts[index], chunk_value_counts[index + 1]));
+      }
+      if (chunk_value_counts.size() % 2 == 1) {
+        merged_value_counts.emplace_back(std::move(chunk_value_counts.back()));
+      }
+
+      chunk_value_counts = std::move(merged_value_counts);
+    }
+
+    if (!chunk_value_counts.empty() && !chunk_value_counts.front().empty()) {
+      distinct_count = static_cast<float>(chunk_value_counts.front().size());
+      histogram = EquiHeightHistogram<ColumnDataType>::from_value_counts(chunk_value_counts.front());
+    }
+  } else {
+    auto sketch = HyperLogLog{};
+    for (const auto& chunk_sketch : chunk_sketches) {
+      sketch.merge(*chunk_sketch);
+    }
+
+    distinct_count = std::round(sketch.estimate());
+    histogram = EquiHeightHistogram<ColumnDataType>::merge(chunk_histograms, distinct_count);
   }
 
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max);
-}
+  if (!histogram || histogram->bins().empty()) {
+    if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+      return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, 0.0f, std::string{}, std::string{});
+    } else {
+      return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, 0.0f,
+                                                                std::numeric_limits<ColumnDataType>::min(),
+                                                                std::numeric_limits<ColumnDataType>::max());
+    }
+  }
+
+  const auto min = histogram->bins().front().min;
+  const auto max = histogram->bins().back().max;
 
-template <>
-std::shared_ptr<BaseColumnStatistics> generate_column_statistics<std::string>(const Table& table,
-                                                                              const ColumnID column_id);
+  if (histogram->is_approximately_uniform()) {
+    histogram = nullptr;
+  }
+
+  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max, histogram);
+}
 
 }  // namespace opossum
@@ -0,0 +1,73 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Finalizer of MurmurHash3, spreads similar inputs (e.g., consecutive integers) over the entire range of uint64_t
+uint64_t mix_hash(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace
+
+HyperLogLog::HyperLogLog(const uint8_t precision) : _precision(precision), _registers(size_t{1} << precision, 0) {
+  Assert(precision >= 4 && precision <= 18, "HyperLogLog precision out of range");
+}
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  const auto mixed_hash = mix_hash(hash);
+
+  // The first _precision bits select the register, the rank of the first set bit in the others is stored in it. The
+  // guard bit makes sure that __builtin_clzll() is not called with 0.
+  const auto register_index = mixed_hash >> (64 - _precision);
+  const auto remaining_bits = (mixed_hash << _precision) | (uint64_t{1} << (_precision - 1));
+  const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+
+  _registers[register_index] = std::max(_registers[register_index], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  Assert(_precision == other._precision, "Cannot merge HyperLogLog sketches of different precision");
+
+  for (auto register_index = size_t{0}; register_index < _registers.size(); ++register_index) {
+    _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+  }
+}
+
+float HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(_registers.size());
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  for (const auto value : _registers) {
+    inverse_sum += std::ldexp(1.0, -value);
+    if (value == 0) ++zero_register_count;
+  }
+
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // The raw estimate is biased for small cardinalities, use linear counting instead
+  if (raw_estimate <= 2.5 * register_count && zero_register_count > 0) {
+    return static_cast<float>(register_count * std::log(register_count / static_cast<double>(zero_register_count)));
+  }
+
+  return static_cast<float>(raw_estimate);
+}
+
+uint8_t HyperLogLog::precision() const { return _precision; }
+
+const std::vector<uint8_t>& HyperLogLog::registers() const { return _registers; }
+
+}  // namespace opossum
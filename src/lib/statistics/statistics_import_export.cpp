@@ -1,9 +1,13 @@
 #include "statistics_import_export.hpp"
 
 #include <fstream>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "column_statistics.hpp"
 #include "constant_mappings.hpp"
+#include "equi_height_histogram.hpp"
 #include "resolve_type.hpp"
 #include "utils/assert.hpp"
 
@@ -66,8 +70,25 @@ std::shared_ptr<BaseColumnStatistics> import_column_statistics(const nlohmann::j
     const auto min = json["min"].get<ColumnDataType>();
     const auto max = json["max"].get<ColumnDataType>();
 
+    // Histograms are optional, most columns are uniformly distributed enough to not need one
+    auto histogram = std::shared_ptr<const EquiHeightHistogram<ColumnDataType>>{};
+    if (json.count("histogram")) {
+      const auto& histogram_json = json["histogram"];
+      Assert(histogram_json.is_array(), "Histogram bins should be stored in an array");
+
+      auto bins = std::vector<HistogramBin<ColumnDataType>>{};
+      bins.reserve(histogram_json.size());
+      for (const auto& bin_json : histogram_json) {
+        bins.emplace_back(HistogramBin<ColumnDataType>{bin_json["min"].get<ColumnDataType>(),
+                                                       bin_json["max"].get<ColumnDataType>(),
+                                                       bin_json["height"].get<float>(),
+                                                       bin_json["distinct_count"].get<float>()});
+      }
+      histogram = std::make_shared<EquiHeightHistogram<ColumnDataType>>(std::move(bins));
+    }
+
     result_column_statistics =
-        std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max);
+        std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max, histogram);
   });
 
   Assert(result_column_statistics, "resolve_data_type() apparently failed.");
@@ -98,6 +119,18 @@ nlohmann::json export_column_statistics(const BaseColumnStatistics& base_column_
     const auto& column_statistics = static_cast<const ColumnStatistics<ColumnDataType>&>(base_column_statistics);
     column_statistics_json["min"] = column_statistics.min();
     column_statistics_json["max"] = column_statistics.max();
+
+    if (const auto histogram = column_statistics.histogram()) {
+      column_statistics_json["histogram"] = nlohmann::json::array();
+      for (const auto& bin : histogram->bins()) {
+        nlohmann::json bin_json;
+        bin_json["min"] = bin.min;
+        bin_json["max"] = bin.max;
+        bin_json["height"] = bin.height;
+        bin_json["distinct_count"] = bin.distinct_count;
+        column_statistics_json["histogram"].push_back(bin_json);
+      }
+    }
   });
 
   return column_statistics_json;
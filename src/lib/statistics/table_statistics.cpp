@@ -1,5 +1,6 @@
 #include "table_statistics.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 #include "all_parameter_variant.hpp"
@@ -9,8 +10,12 @@
 namespace opossum {
 
 TableStatistics::TableStatistics(const TableType table_type, const float row_count,
-                                 const std::vector<std::shared_ptr<const BaseColumnStatistics>>& column_statistics)
-    : _table_type(table_type), _row_count(row_count), _column_statistics(column_statistics) {}
+                                 const std::vector<std::shared_ptr<const BaseColumnStatistics>>& column_statistics,
+                                 const float modified_row_count)
+    : _table_type(table_type),
+      _row_count(row_count),
+      _column_statistics(column_statistics),
+      _modified_row_count(modified_row_count) {}
 
 TableType TableStatistics::table_type() const { return _table_type; }
 
@@ -20,6 +25,16 @@ const std::vector<std::shared_ptr<const BaseColumnStatistics>>& TableStatistics:
   return _column_statistics;
 }
 
+float TableStatistics::modified_row_count() const { return _modified_row_count; }
+
+float TableStatistics::drift() const { return _modified_row_count / std::max(1.0f, _row_count); }
+
+TableStatistics TableStatistics::with_modified_rows(const float inserted_row_count,
+                                                    const float deleted_row_count) const {
+  return {_table_type, std::max(0.0f, _row_count + inserted_row_count - deleted_row_count), _column_statistics,
+          _modified_row_count + inserted_row_count + deleted_row_count};
+}
+
 TableStatistics TableStatistics::estimate_predicate(const ColumnID column_id,
                                                     const PredicateCondition predicate_condition,
                                                     const AllParameterVariant& value,
@@ -24,7 +24,8 @@ class TableStatistics final {
   static constexpr auto DEFAULT_DISJUNCTION_SELECTIVITY = 0.2f;
 
   TableStatistics(const TableType table_type, const float row_count,
-                  const std::vector<std::shared_ptr<const BaseColumnStatistics>>& column_statistics);
+                  const std::vector<std::shared_ptr<const BaseColumnStatistics>>& column_statistics,
+                  const float modified_row_count = 0.0f);
   TableStatistics(const TableStatistics& table_statistics) = default;
 
   /**
@@ -36,6 +37,22 @@ class TableStatistics final {
   const std::vector<std::shared_ptr<const BaseColumnStatistics>>& column_statistics() const;
   /** @} */
 
+  /**
+   * @defgroup Incremental maintenance
+   * Insert and Delete only update the row count (see update_table_statistics()). The column statistics keep describing
+   * the data at the time they were generated, so they become less accurate the more rows are modified.
+   * @{
+   */
+  // Number of rows inserted or deleted since the column statistics were generated
+  float modified_row_count() const;
+
+  // Ratio of modified rows to the row count
+  float drift() const;
+
+  // Statistics with the row count adjusted by the inserted and deleted rows
+  TableStatistics with_modified_rows(const float inserted_row_count, const float deleted_row_count) const;
+  /** @} */
+
   /**
    * @defgroup Cardinality Estimations
    * @{
@@ -58,6 +75,7 @@ class TableStatistics final {
   TableType _table_type;
   float _row_count;
   std::vector<std::shared_ptr<const BaseColumnStatistics>> _column_statistics;
+  float _modified_row_count;
 };
 
 }  // namespace opossum
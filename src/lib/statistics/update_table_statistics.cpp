@@ -0,0 +1,100 @@
+#include "update_table_statistics.hpp"
+
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+#include "generate_table_statistics.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/table.hpp"
+#include "table_statistics.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Guards the read-modify-write of the tables' statistics and the set of tables whose statistics are being refreshed
+std::mutex statistics_mutex;
+std::unordered_set<const Table*> tables_with_pending_refresh;
+
+// Rows that were deleted are still stored in the table, but should not be part of the row count
+size_t count_deleted_rows(const Table& table) {
+  auto deleted_row_count = size_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk->has_mvcc_columns()) continue;
+
+    const auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < mvcc_columns->size(); ++chunk_offset) {
+      if (mvcc_columns->end_cid(chunk_offset) != MvccColumns::MAX_COMMIT_ID) ++deleted_row_count;
+    }
+  }
+  return deleted_row_count;
+}
+
+// Removes a table from tables_with_pending_refresh once its refresh is done, also if generating the statistics throws.
+// Otherwise, the statistics of the table would never be refreshed again.
+class PendingRefreshGuard final {
+ public:
+  explicit PendingRefreshGuard(const Table& table) : _table(table) {}
+
+  ~PendingRefreshGuard() {
+    std::lock_guard<std::mutex> lock(statistics_mutex);
+    tables_with_pending_refresh.erase(&_table);
+  }
+
+  PendingRefreshGuard(const PendingRefreshGuard&) = delete;
+  PendingRefreshGuard& operator=(const PendingRefreshGuard&) = delete;
+
+ private:
+  const Table& _table;
+};
+
+}  // namespace
+
+void update_table_statistics(const std::shared_ptr<Table>& table, const float inserted_row_count,
+                             const float deleted_row_count, const float max_drift) {
+  auto exceeds_max_drift = false;
+  {
+    std::lock_guard<std::mutex> lock(statistics_mutex);
+
+    const auto table_statistics = table->table_statistics();
+    if (!table_statistics) return;
+
+    const auto updated_statistics = std::make_shared<TableStatistics>(
+        table_statistics->with_modified_rows(inserted_row_count, deleted_row_count));
+    table->set_table_statistics(updated_statistics);
+
+    exceeds_max_drift = updated_statistics->drift() > max_drift;
+  }
+
+  // Without a scheduler, the task is executed right away and needs to acquire the mutex itself
+  if (exceeds_max_drift) refresh_table_statistics(table);
+}
+
+std::shared_ptr<AbstractTask> refresh_table_statistics(const std::shared_ptr<Table>& table) {
+  {
+    std::lock_guard<std::mutex> lock(statistics_mutex);
+    const auto inserted = tables_with_pending_refresh.emplace(table.get()).second;
+    if (!inserted) return nullptr;
+  }
+
+  auto task = std::make_shared<JobTask>([table]() {
+    const auto pending_refresh_guard = PendingRefreshGuard{*table};
+
+    const auto table_statistics = generate_table_statistics(*table);
+    const auto row_count = static_cast<float>(table->row_count() - count_deleted_rows(*table));
+
+    // The deltas that update_table_statistics() applied since the refresh started are overwritten on purpose: Rows
+    // committed before the rows were counted are part of row_count already. Only those committed between counting and
+    // installing the statistics are lost, which is a small error compared to max_drift and undone by the next refresh.
+    std::lock_guard<std::mutex> lock(statistics_mutex);
+    table->set_table_statistics(std::make_shared<TableStatistics>(table_statistics.table_type(), row_count,
+                                                                  table_statistics.column_statistics()));
+  });
+  task->schedule();
+
+  return task;
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+
+namespace opossum {
+
+class AbstractTask;
+class Table;
+
+/**
+ * If the drift of a table's statistics (see TableStatistics::drift()) exceeds this, they are regenerated
+ */
+constexpr auto DEFAULT_MAX_STATISTICS_DRIFT = 0.1f;
+
+/**
+ * Called by Insert and Delete after they committed. Adjusts the row count of the table's statistics, if it has any.
+ * If this makes them drift from the data by more than max_drift, they are regenerated in the background (see
+ * refresh_table_statistics()).
+ */
+void update_table_statistics(const std::shared_ptr<Table>& table, const float inserted_row_count,
+                             const float deleted_row_count, const float max_drift = DEFAULT_MAX_STATISTICS_DRIFT);
+
+/**
+ * Regenerate the statistics of a table in a background task. Only rows that are visible to new transactions are
+ * counted for the row count. Since the chunks encoded by the ChunkEncoder already come with sketches and histograms,
+ * this does not need to scan them again for large tables (see generate_column_statistics()).
+ * The adjustments made by update_table_statistics() while the refresh is running are replaced by the regenerated
+ * statistics, as the rows they account for are mostly counted by the refresh already.
+ *
+ * @return the scheduled task, or nullptr if a refresh of the table's statistics is pending already
+ */
+std::shared_ptr<AbstractTask> refresh_table_statistics(const std::shared_ptr<Table>& table);
+
+}  // namespace opossum
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/base_column_encoder.hpp"
+
+#include "storage/alp_column.hpp"
+#include "storage/value_column.hpp"
+#include "storage/value_column/value_column_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class AlpEncoder : public ColumnEncoder<AlpEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::Alp>;
+  static constexpr auto _uses_vector_compression = true;  // see base_column_encoder.hpp for details
+
+  // The number of values per block used to choose the exponent and the factor
+  static constexpr auto sample_size = size_t{32u};
+
+  struct Parameters {
+    uint8_t exponent;
+    uint8_t factor;
+
+    // The number of bits needed for the offsets and the number of exceptions among the sampled values
+    size_t bit_width;
+    size_t exception_count;
+
+    // The estimated size of the sampled values when encoded with exponent and factor, including exceptions
+    size_t size_in_bits;
+  };
+
+  /**
+   * Chooses the exponent and the factor that minimize the estimated size of the sampled values. Each value whose
+   * digits cannot be decoded exactly is counted as an exception.
+   */
+  template <typename T>
+  static Parameters choose_parameters(const std::vector<T>& sampled_values) {
+    static constexpr auto exception_size_in_bits = (sizeof(ChunkOffset) + sizeof(T)) * 8u;
+
+    // Without any encodable value, everything is an exception
+    auto best_parameters =
+        Parameters{0u, 0u, 0u, sampled_values.size(), sampled_values.size() * exception_size_in_bits};
+
+    for (auto exponent = uint8_t{0u}; exponent <= AlpColumn<T>::max_exponent; ++exponent) {
+      for (auto factor = uint8_t{0u}; factor <= exponent; ++factor) {
+        auto min_digits = std::numeric_limits<int64_t>::max();
+        auto max_digits = std::numeric_limits<int64_t>::min();
+        auto exception_count = size_t{0u};
+
+        for (const auto value : sampled_values) {
+          const auto digits = AlpColumn<T>::encode_digits(value, exponent, factor);
+          if (!digits) {
+            ++exception_count;
+            continue;
+          }
+
+          min_digits = std::min(min_digits, *digits);
+          max_digits = std::max(max_digits, *digits);
+        }
+
+        auto bit_width = size_t{0u};
+        if (exception_count < sampled_values.size()) {
+          const auto range = static_cast<uint64_t>(max_digits) - static_cast<uint64_t>(min_digits);
+          if (range > std::numeric_limits<uint32_t>::max()) continue;
+
+          while (bit_width < 32u && (range >> bit_width) != 0u) ++bit_width;
+        }
+
+        const auto size_in_bits =
+            (sampled_values.size() - exception_count) * bit_width + exception_count * exception_size_in_bits;
+        if (size_in_bits < best_parameters.size_in_bits) {
+          best_parameters = Parameters{exponent, factor, bit_width, exception_count, size_in_bits};
+        }
+      }
+    }
+
+    return best_parameters;
+  }
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedColumn> _on_encode(const std::shared_ptr<const ValueColumn<T>>& value_column) {
+    using Block = typename AlpColumn<T>::Block;
+
+    const auto alloc = value_column->with_values([](const auto& values) { return values.get_allocator(); });
+
+    static constexpr auto block_size = AlpColumn<T>::block_size;
+
+    const auto size = value_column->size();
+
+    // holds the reference, the parameters and the minimum and maximum of each block
+    auto blocks = pmr_vector<Block>{alloc};
+    blocks.reserve((size + block_size - 1u) / block_size);
+
+    // holds the uncompressed offset values
+    auto offset_values = pmr_vector<uint32_t>{alloc};
+    offset_values.reserve(size);
+
+    // holds whether a column value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    auto exception_offsets = pmr_vector<ChunkOffset>{alloc};
+    auto exception_values = pmr_vector<T>{alloc};
+
+    // used as optional input for the compression of the offset values
+    auto max_offset = uint32_t{0u};
+
+    auto iterable = ValueColumnIterable<T>{*value_column};
+    iterable.with_iterators([&](auto column_it, auto column_end) {
+      // a temporary storage to hold the values of one block
+      auto current_value_block = std::array<T, block_size>{};
+      auto current_null_block = std::array<bool, block_size>{};
+      auto current_digits_block = std::array<std::optional<int64_t>, block_size>{};
+      auto non_null_values = std::vector<T>{};
+      auto sampled_values = std::vector<T>{};
+      non_null_values.reserve(block_size);
+      sampled_values.reserve(sample_size);
+
+      auto block_begin = ChunkOffset{0u};
+      while (column_it != column_end) {
+        non_null_values.clear();
+
+        auto block_row_count = size_t{0u};
+        for (; block_row_count < block_size && column_it != column_end; ++block_row_count, ++column_it) {
+          const auto column_value = *column_it;
+
+          current_value_block[block_row_count] = column_value.is_null() ? T{0} : column_value.value();
+          current_null_block[block_row_count] = column_value.is_null();
+          null_values.push_back(column_value.is_null());
+
+          if (!column_value.is_null()) non_null_values.push_back(column_value.value());
+        }
+
+        // Choose the parameters based on evenly spread non-NULL values
+        sampled_values.clear();
+        const auto sample_stride = std::max(size_t{1u}, non_null_values.size() / sample_size);
+        for (auto index = size_t{0u}; index < non_null_values.size(); index += sample_stride) {
+          sampled_values.push_back(non_null_values[index]);
+        }
+        const auto parameters = choose_parameters(sampled_values);
+
+        auto block = Block{0, std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                           parameters.exponent, parameters.factor};
+
+        auto min_digits = std::optional<int64_t>{};
+        for (auto index = size_t{0u}; index < block_row_count; ++index) {
+          current_digits_block[index] = std::nullopt;
+          if (current_null_block[index]) continue;
+
+          const auto value = current_value_block[index];
+          if (!std::isnan(value)) {
+            block.minimum = std::min(block.minimum, value);
+            block.maximum = std::max(block.maximum, value);
+          }
+
+          current_digits_block[index] = AlpColumn<T>::encode_digits(value, block.exponent, block.factor);
+          if (current_digits_block[index] && (!min_digits || *current_digits_block[index] < *min_digits)) {
+            min_digits = current_digits_block[index];
+          }
+        }
+
+        block.reference = min_digits.value_or(0);
+        blocks.push_back(block);
+
+        for (auto index = size_t{0u}; index < block_row_count; ++index) {
+          const auto& digits = current_digits_block[index];
+          const auto offset =
+              digits ? static_cast<uint64_t>(*digits) - static_cast<uint64_t>(block.reference) : uint64_t{0u};
+
+          // NULLs are stored as offset 0, as are values that cannot be encoded or whose offset is too large
+          if (current_null_block[index]) {
+            offset_values.push_back(0u);
+          } else if (digits && offset <= std::numeric_limits<uint32_t>::max()) {
+            offset_values.push_back(static_cast<uint32_t>(offset));
+            max_offset = std::max(max_offset, offset_values.back());
+          } else {
+            offset_values.push_back(0u);
+            exception_offsets.push_back(static_cast<ChunkOffset>(block_begin + index));
+            exception_values.push_back(current_value_block[index]);
+          }
+        }
+
+        block_begin += block_row_count;
+      }
+    });
+
+    auto encoded_offset_values = compress_vector(offset_values, vector_compression_type(), alloc, {max_offset});
+
+    return std::allocate_shared<AlpColumn<T>>(alloc, std::move(blocks), std::move(null_values),
+                                              std::move(encoded_offset_values), std::move(exception_offsets),
+                                              std::move(exception_values));
+  }
+};
+
+}  // namespace opossum
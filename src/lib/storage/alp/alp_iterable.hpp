@@ -0,0 +1,158 @@
+#pragma once
+
+#include <type_traits>
+
+#include "storage/column_iterables.hpp"
+
+#include "storage/alp_column.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class AlpIterable : public PointAccessibleColumnIterable<AlpIterable<T>> {
+ public:
+  explicit AlpIterable(const AlpColumn<T>& column) : _column{column} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    resolve_compressed_vector_type(_column.offset_values(), [&](const auto& offset_values) {
+      using OffsetValueIteratorT = decltype(offset_values.cbegin());
+
+      auto begin = Iterator<OffsetValueIteratorT>{_column.blocks().cbegin(), offset_values.cbegin(),
+                                                  _column.null_values().cbegin(), _column.exception_offsets().cbegin(),
+                                                  _column.exception_offsets().cend(),
+                                                  _column.exception_values().cbegin()};
+
+      auto end = Iterator<OffsetValueIteratorT>{offset_values.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
+    resolve_compressed_vector_type(_column.offset_values(), [&](const auto& vector) {
+      auto decoder = vector.create_decoder();
+      using OffsetValueDecompressorT = std::decay_t<decltype(*decoder)>;
+
+      auto begin =
+          PointAccessIterator<OffsetValueDecompressorT>{&_column, decoder.get(), mapped_chunk_offsets.cbegin()};
+
+      auto end = PointAccessIterator<OffsetValueDecompressorT>{mapped_chunk_offsets.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _column.size(); }
+
+ private:
+  const AlpColumn<T>& _column;
+
+ private:
+  template <typename OffsetValueIteratorT>
+  class Iterator : public BaseColumnIterator<Iterator<OffsetValueIteratorT>, ColumnIteratorValue<T>> {
+   public:
+    using BlockIterator = typename pmr_vector<typename AlpColumn<T>::Block>::const_iterator;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+    using ExceptionOffsetIterator = typename pmr_vector<ChunkOffset>::const_iterator;
+    using ExceptionValueIterator = typename pmr_vector<T>::const_iterator;
+
+   public:
+    // Begin Iterator
+    explicit Iterator(BlockIterator block_it, OffsetValueIteratorT offset_value_it, NullValueIterator null_value_it,
+                      ExceptionOffsetIterator exception_offset_it, ExceptionOffsetIterator exception_offset_end,
+                      ExceptionValueIterator exception_value_it)
+        : _block_it{block_it},
+          _offset_value_it{offset_value_it},
+          _null_value_it{null_value_it},
+          _exception_offset_it{exception_offset_it},
+          _exception_offset_end{exception_offset_end},
+          _exception_value_it{exception_value_it},
+          _index_within_block{0u},
+          _chunk_offset{0u} {}
+
+    // End iterator
+    explicit Iterator(OffsetValueIteratorT offset_value_it) : Iterator{{}, offset_value_it, {}, {}, {}, {}} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      if (_is_exception()) {
+        ++_exception_offset_it;
+        ++_exception_value_it;
+      }
+
+      ++_offset_value_it;
+      ++_null_value_it;
+      ++_index_within_block;
+      ++_chunk_offset;
+
+      if (_index_within_block >= AlpColumn<T>::block_size) {
+        _index_within_block = 0u;
+        ++_block_it;
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _offset_value_it == other._offset_value_it; }
+
+    ColumnIteratorValue<T> dereference() const {
+      const auto value =
+          _is_exception() ? *_exception_value_it : AlpColumn<T>::decode_offset(*_block_it, *_offset_value_it);
+      return ColumnIteratorValue<T>{value, *_null_value_it, _chunk_offset};
+    }
+
+    bool _is_exception() const {
+      return _exception_offset_it != _exception_offset_end && *_exception_offset_it == _chunk_offset;
+    }
+
+   private:
+    BlockIterator _block_it;
+    OffsetValueIteratorT _offset_value_it;
+    NullValueIterator _null_value_it;
+    ExceptionOffsetIterator _exception_offset_it;
+    ExceptionOffsetIterator _exception_offset_end;
+    ExceptionValueIterator _exception_value_it;
+    size_t _index_within_block;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename OffsetValueDecompressorT>
+  class PointAccessIterator
+      : public BasePointAccessColumnIterator<PointAccessIterator<OffsetValueDecompressorT>, ColumnIteratorValue<T>> {
+   public:
+    // Begin Iterator
+    PointAccessIterator(const AlpColumn<T>* column, OffsetValueDecompressorT* offset_value_decoder,
+                        ChunkOffsetsIterator chunk_offsets_it)
+        : BasePointAccessColumnIterator<PointAccessIterator<OffsetValueDecompressorT>,
+                                        ColumnIteratorValue<T>>{chunk_offsets_it},
+          _column{column},
+          _offset_value_decoder{offset_value_decoder} {}
+
+    // End Iterator
+    explicit PointAccessIterator(ChunkOffsetsIterator chunk_offsets_it)
+        : PointAccessIterator{nullptr, nullptr, chunk_offsets_it} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    ColumnIteratorValue<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      const auto is_null = _column->null_values()[chunk_offsets.into_referenced];
+      const auto value =
+          AlpColumn<T>::decode_value(_column->blocks(), *_offset_value_decoder, _column->exception_offsets(),
+                                     _column->exception_values(), chunk_offsets.into_referenced);
+
+      return ColumnIteratorValue<T>{value, is_null, chunk_offsets.into_referencing};
+    }
+
+   private:
+    const AlpColumn<T>* _column;
+    OffsetValueDecompressorT* _offset_value_decoder;
+  };
+};
+
+}  // namespace opossum
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "base_encoded_column.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Column implementing adaptive lossless floating-point (ALP) encoding
+ *
+ * Many floating-point columns hold values that were decimals originally,
+ * e.g., prices or sensor readings with a fixed number of digits. ALP
+ * (Afroozeh et al., SIGMOD 2024) multiplies such a value by a power of ten
+ * (10^exponent / 10^factor) and stores the resulting integer (its digits).
+ * Decoding reverts the multiplication: digits * 10^factor / 10^exponent.
+ * Unlike the original ALP, which multiplies by 10^-exponent, we divide by
+ * the exactly representable 10^exponent. The result is the closest value
+ * to the decimal number, so values parsed from decimals are encodable.
+ *
+ * The exponent and the factor are chosen per block. A value is only
+ * encoded as digits if decoding yields exactly the same bits. All other
+ * values (e.g., NaN, -0.0 or values with too many decimal places) are
+ * stored as exceptions with their chunk offset, just like in
+ * PatchedFrameOfReferenceColumn.
+ *
+ * The digits are frame-of-reference encoded per block and the offsets are
+ * compressed using vector compression. In addition, each block stores the
+ * minimum and maximum of its values, which lets scans skip blocks.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::Alp>,
+                                                                               hana::type_c<T>)>>
+class AlpColumn : public BaseEncodedColumn {
+ public:
+  static constexpr auto block_size = 1024u;
+
+  // 10^exponent must be exactly representable and the digits must fit into int64_t
+  static constexpr auto max_exponent = std::is_same_v<T, float> ? uint8_t{10u} : uint8_t{18u};
+
+  struct Block {
+    // The minimum digits of the block, the offsets are relative to it
+    int64_t reference;
+
+    // The minimum and maximum of the block's values, ignoring NULLs and NaNs. For blocks without such values,
+    // minimum is +infinity and maximum is -infinity, so that no comparison with them is true.
+    T minimum;
+    T maximum;
+
+    uint8_t exponent;
+    uint8_t factor;
+  };
+
+  explicit AlpColumn(pmr_vector<Block> blocks, pmr_vector<bool> null_values,
+                     std::unique_ptr<const BaseCompressedVector> offset_values,
+                     pmr_vector<ChunkOffset> exception_offsets, pmr_vector<T> exception_values);
+
+  const pmr_vector<Block>& blocks() const;
+  const pmr_vector<bool>& null_values() const;
+  const BaseCompressedVector& offset_values() const;
+
+  // The chunk offsets of the exceptions in ascending order and their values
+  const pmr_vector<ChunkOffset>& exception_offsets() const;
+  const pmr_vector<T>& exception_values() const;
+
+  // Returns the value at a certain position or std::nullopt if it is NULL. Unlike operator[], this is typed and
+  // does not go through an AllTypeVariant.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns the digits of value or std::nullopt if decoding them would not yield value again
+  static std::optional<int64_t> encode_digits(const T value, const uint8_t exponent, const uint8_t factor) {
+    // Larger values might not fit into int64_t after rounding
+    static constexpr auto max_digits = static_cast<T>(int64_t{1} << 62);
+
+    const auto scaled = value * _power_of_ten(exponent) / _power_of_ten(factor);
+    if (!(std::abs(scaled) < max_digits)) return std::nullopt;  // also catches NaN
+
+    const auto digits = static_cast<int64_t>(std::llround(scaled));
+    const auto decoded = decode_digits(digits, exponent, factor);
+
+    // Compare the sign separately to tell -0.0 and 0.0 apart
+    if (decoded != value || std::signbit(decoded) != std::signbit(value)) return std::nullopt;
+    return digits;
+  }
+
+  static T decode_digits(const int64_t digits, const uint8_t exponent, const uint8_t factor) {
+    return static_cast<T>(digits) * _power_of_ten(factor) / _power_of_ten(exponent);
+  }
+
+  // Adds the offset to the reference of the block and decodes the resulting digits
+  static T decode_offset(const Block& block, const uint32_t offset) {
+    return decode_digits(block.reference + static_cast<int64_t>(offset), block.exponent, block.factor);
+  }
+
+  // Decodes the value at chunk_offset using the passed decompressor, regardless of whether it is NULL
+  template <typename OffsetValueDecompressorT>
+  static T decode_value(const pmr_vector<Block>& blocks, OffsetValueDecompressorT& decompressor,
+                        const pmr_vector<ChunkOffset>& exception_offsets, const pmr_vector<T>& exception_values,
+                        const ChunkOffset chunk_offset) {
+    const auto exception_it = std::lower_bound(exception_offsets.cbegin(), exception_offsets.cend(), chunk_offset);
+    if (exception_it != exception_offsets.cend() && *exception_it == chunk_offset) {
+      return exception_values[std::distance(exception_offsets.cbegin(), exception_it)];
+    }
+
+    return decode_offset(blocks[chunk_offset / block_size], decompressor.get(chunk_offset));
+  }
+
+  /**
+   * Decodes all values of a block at once, regardless of whether they are NULL
+   *
+   * @param values needs to hold at least block_size values
+   * @return the number of rows in the block
+   */
+  template <typename OffsetValueDecompressorT>
+  size_t decode_block(const size_t block_index, OffsetValueDecompressorT& decompressor,
+                      std::array<T, block_size>& values) const {
+    const auto block_begin = static_cast<ChunkOffset>(block_index * block_size);
+    const auto block_row_count = std::min(size_t{block_size}, size() - block_begin);
+    const auto& block = _blocks[block_index];
+
+    for (auto index = size_t{0u}; index < block_row_count; ++index) {
+      values[index] = decode_offset(block, decompressor.get(block_begin + index));
+    }
+
+    auto exception_index = static_cast<size_t>(
+        std::lower_bound(_exception_offsets.cbegin(), _exception_offsets.cend(), block_begin) -
+        _exception_offsets.cbegin());
+    for (; exception_index < _exception_offsets.size() &&
+           _exception_offsets[exception_index] < block_begin + block_row_count;
+         ++exception_index) {
+      values[_exception_offsets[exception_index] - block_begin] = _exception_values[exception_index];
+    }
+
+    return block_row_count;
+  }
+
+  /**
+   * @defgroup BaseColumn interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedColumn interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  CompressedVectorType compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  static T _power_of_ten(const uint8_t exponent) {
+    static constexpr auto powers = std::array<double, 19>{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                                          1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+    return static_cast<T>(powers[exponent]);
+  }
+
+ private:
+  const pmr_vector<Block> _blocks;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  const pmr_vector<ChunkOffset> _exception_offsets;
+  const pmr_vector<T> _exception_values;
+  std::unique_ptr<BaseVectorDecompressor> _decoder;
+};
+
+}  // namespace opossum
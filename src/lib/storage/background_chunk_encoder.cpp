@@ -0,0 +1,147 @@
+#include "background_chunk_encoder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "storage/base_value_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+namespace {
+
+float core_count() { return static_cast<float>(std::max(std::thread::hardware_concurrency(), 1u)); }
+
+// Chunks can only be encoded while they consist of ValueColumns. Completed chunks are already made immutable by
+// Insert, so mutability says nothing about the encoding. ChunkEncoder sets the statistics of the chunks it processed.
+bool is_unencoded(const Chunk& chunk) {
+  if (chunk.statistics()) return false;
+
+  const auto& columns = chunk.columns();
+  return std::all_of(columns.cbegin(), columns.cend(), [](const auto& column) {
+    return std::dynamic_pointer_cast<const BaseValueColumn>(std::atomic_load(&column)) != nullptr;
+  });
+}
+
+// Exceptions must not escape the background threads, as that would terminate the process
+template <typename Functor>
+void log_exceptions(const Functor& functor) {
+  try {
+    functor();
+  } catch (const std::exception& exception) {
+    std::cerr << "BackgroundChunkEncoder: " << exception.what() << std::endl;
+  }
+}
+
+}  // namespace
+
+BackgroundChunkEncoder::BackgroundChunkEncoder(const Options& options)
+    : _options{options}, _core_budget{options.core_share * core_count()} {
+  Assert(_options.core_share > 0.0f && _options.core_share <= 1.0f, "Core share must be in (0, 1].");
+  Assert(_options.encoding_spec.encoding_type != EncodingType::Unencoded, "Background encoding needs an encoding.");
+
+  _loop_thread = std::make_unique<PausableLoopThread>(_options.check_interval, [this](size_t) {
+    auto timer = Timer{};
+    log_exceptions([&]() { encode_completed_chunks(); });
+    _throttle(timer.lap());
+  });
+}
+
+BackgroundChunkEncoder::~BackgroundChunkEncoder() {
+  _shutdown_requested = true;
+  _throttle_cv.notify_all();
+
+  // Waits for the current iteration to finish
+  _loop_thread.reset();
+}
+
+void BackgroundChunkEncoder::pause() { _loop_thread->pause(); }
+
+void BackgroundChunkEncoder::resume() { _loop_thread->resume(); }
+
+const BackgroundChunkEncoder::Options& BackgroundChunkEncoder::options() const { return _options; }
+
+size_t BackgroundChunkEncoder::encode_completed_chunks() {
+  std::lock_guard<std::mutex> encoding_lock{_encoding_mutex};
+
+  // Collect the candidates first. Insert appends chunks while holding the append mutex, so we acquire it too. The
+  // encoding itself happens without holding it, so that Inserts are not blocked.
+  // Tables may be added or dropped concurrently, so a snapshot of them is used.
+  auto candidates = std::vector<std::pair<std::shared_ptr<Table>, std::shared_ptr<Chunk>>>{};
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    auto append_lock = table->acquire_append_mutex();
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk->has_mvcc_columns() || chunk->size() != table->max_chunk_size() || !is_unencoded(*chunk)) continue;
+
+      candidates.emplace_back(table, chunk);
+    }
+  }
+
+  if (candidates.empty()) return 0;
+
+  // Full chunks do not receive new rows (see Insert), so once a chunk is completed, it stays completed
+  auto next_candidate = std::atomic<size_t>{0};
+  auto encoded_chunk_count = std::atomic<size_t>{0};
+  const auto encode_candidates = [&]() {
+    while (!_shutdown_requested) {
+      const auto candidate_id = next_candidate++;
+      if (candidate_id >= candidates.size()) return;
+
+      const auto& [table, chunk] = candidates[candidate_id];
+      if (!ChunkCompressionTask::chunk_is_completed(chunk, table->max_chunk_size())) continue;
+
+      // Someone else, e.g., a ChunkCompressionTask, might have encoded the chunk since it was collected. That can
+      // still happen while the chunk is encoded, in which case ChunkEncoder throws and the chunk is skipped.
+      if (!is_unencoded(*chunk)) continue;
+
+      log_exceptions([&]() {
+        ChunkEncoder::encode_chunk(chunk, table->column_data_types(), _options.encoding_spec);
+        ++encoded_chunk_count;
+      });
+    }
+  };
+
+  const auto worker_count = std::min(_worker_count(), candidates.size());
+  auto workers = std::vector<std::thread>{};
+  workers.reserve(worker_count - 1);
+  for (auto worker_id = size_t{1}; worker_id < worker_count; ++worker_id) {
+    workers.emplace_back(encode_candidates);
+  }
+  encode_candidates();
+  for (auto& worker : workers) worker.join();
+
+  return encoded_chunk_count;
+}
+
+size_t BackgroundChunkEncoder::_worker_count() const {
+  return std::max(static_cast<size_t>(_core_budget), size_t{1});
+}
+
+void BackgroundChunkEncoder::_throttle(const std::chrono::microseconds busy_time) {
+  // While encoding, _worker_count() cores were busy. If that exceeds the budget, e.g., because the budget is less than
+  // one core, we idle until the average is back at the budget.
+  const auto busy_share = static_cast<float>(_worker_count()) / _core_budget;
+  if (busy_share <= 1.0f) return;
+
+  const auto pause_time =
+      std::chrono::microseconds{static_cast<int64_t>(static_cast<float>(busy_time.count()) * (busy_share - 1.0f))};
+
+  std::unique_lock<std::mutex> throttle_lock{_throttle_mutex};
+  _throttle_cv.wait_for(throttle_lock, pause_time, [&] { return static_cast<bool>(_shutdown_requested); });
+}
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Encodes the chunks of tables that are filled by Insert in the background
+ *
+ * Only bulk loads (e.g., CsvParser with auto_compress) and explicit ChunkCompressionTasks encode chunks. Chunks of
+ * tables that are filled through Insert would otherwise remain unencoded forever. The BackgroundChunkEncoder
+ * periodically looks for chunks in the StorageManager that are completed (full and without uncommitted inserts, see
+ * ChunkCompressionTask) and encodes them using ChunkEncoder, which atomically replaces their columns.
+ *
+ * To keep the encoding off the critical path, it uses at most core_share of the machine's cores: Larger shares are
+ * spread over multiple threads, fractional shares are achieved by pausing after each round of encoding.
+ *
+ * The encoder starts working on construction and stops on destruction. Errors while encoding a chunk (e.g., because it
+ * was encoded by a ChunkCompressionTask in the meantime) are logged and do not stop the encoder.
+ */
+class BackgroundChunkEncoder : private Noncopyable {
+ public:
+  struct Options {
+    Options() : check_interval(std::chrono::milliseconds(100)), core_share(0.25f), encoding_spec() {}
+
+    // The time interval at which the tables are checked for completed chunks
+    std::chrono::milliseconds check_interval;
+
+    // The share of the machine's cores (between 0 and 1) that is used for encoding
+    float core_share;
+
+    // The encoding of all columns of completed chunks. EncodingType::Auto lets the EncodingSelector decide.
+    ColumnEncodingSpec encoding_spec;
+  };
+
+  explicit BackgroundChunkEncoder(const Options& options = Options{});
+  ~BackgroundChunkEncoder();
+
+  void pause();
+  void resume();
+
+  const Options& options() const;
+
+  /**
+   * Encodes all chunks that are completed at the time of the call, using as many threads as the core share allows.
+   * This is what the background thread does in each iteration. It is exposed so that it can be triggered explicitly
+   * (e.g., in tests) without waiting for the next iteration.
+   *
+   * @return the number of encoded chunks
+   */
+  size_t encode_completed_chunks();
+
+ protected:
+  // The number of threads encoding in parallel, i.e., the core budget rounded down but at least one
+  size_t _worker_count() const;
+
+  // Pauses the background thread after encoding for busy_time so that, on average, it uses no more than the budget
+  void _throttle(const std::chrono::microseconds busy_time);
+
+  const Options _options;
+  const float _core_budget;
+
+  // Serializes encode_completed_chunks() so that no chunk is encoded twice
+  std::mutex _encoding_mutex;
+
+  std::atomic_bool _shutdown_requested{false};
+  std::mutex _throttle_mutex;
+  std::condition_variable _throttle_cv;
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
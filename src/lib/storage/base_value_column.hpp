@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+
 #include "base_column.hpp"
+#include "value_column/null_value_vector.hpp"
 
 namespace opossum {
 
@@ -16,12 +19,21 @@ class BaseValueColumn : public BaseColumn {
   // returns true if column supports null values
   virtual bool is_nullable() const = 0;
 
+  // returns true if column is nullable and a value might be null, false guarantees that no value is null
+  virtual bool contains_nulls() const = 0;
+
   /**
    * @brief Returns null array
    *
    * Throws exception if is_nullable() returns false
    */
-  virtual const pmr_concurrent_vector<bool>& null_values() const = 0;
-  virtual pmr_concurrent_vector<bool>& null_values() = 0;
+  virtual const NullValueVector& null_values() const = 0;
+  virtual NullValueVector& null_values() = 0;
+
+  // returns true if the values are stored in a single contiguous buffer, which is the case for immutable columns
+  virtual bool is_contiguous() const = 0;
+
+  // returns a copy of this column that stores its values contiguously, no values can be appended to the copy
+  virtual std::shared_ptr<BaseValueColumn> copy_to_contiguous() const = 0;
 };
 }  // namespace opossum
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "base_column.hpp"
+#include "base_value_column.hpp"
 #include "chunk.hpp"
 #include "index/base_index.hpp"
 #include "reference_column.hpp"
@@ -34,7 +35,25 @@ Chunk::Chunk(const ChunkColumns& columns, const std::shared_ptr<MvccColumns>& mv
 
 bool Chunk::is_mutable() const { return _is_mutable; }
 
-void Chunk::mark_immutable() { _is_mutable = false; }
+void Chunk::mark_immutable() {
+  // Both Insert and ChunkEncoder complete chunks, possibly concurrently. Only the first call copies the columns.
+  if (!_is_mutable.exchange(false)) return;
+
+  // Indices point to the columns they were created on, so the columns of indexed chunks are kept
+  if (!_indices.empty()) return;
+
+  // As no more values are appended, ValueColumns are replaced with contiguous copies. Operators that are still
+  // reading the old column hold a shared_ptr to it and are not affected.
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    auto column = get_column(column_id);
+    const auto value_column = std::dynamic_pointer_cast<const BaseValueColumn>(column);
+    if (!value_column || value_column->is_contiguous()) continue;
+
+    // A column that was replaced in the meantime (e.g., encoded by ChunkEncoder) is not overwritten
+    const auto contiguous_column = std::shared_ptr<BaseColumn>{value_column->copy_to_contiguous()};
+    std::atomic_compare_exchange_strong(&_columns.at(column_id), &column, contiguous_column);
+  }
+}
 
 void Chunk::replace_column(size_t column_id, const std::shared_ptr<BaseColumn>& column) {
   std::atomic_store(&_columns.at(column_id), column);
@@ -172,10 +191,7 @@ size_t Chunk::estimate_memory_usage() const {
   // TODO(anybody) ChunkAccessCounter memory usage missing
 
   if (_mvcc_columns) {
-    bytes += sizeof(_mvcc_columns->tids) + sizeof(_mvcc_columns->begin_cids) + sizeof(_mvcc_columns->end_cids);
-    bytes += _mvcc_columns->tids.size() * sizeof(decltype(_mvcc_columns->tids)::value_type);
-    bytes += _mvcc_columns->begin_cids.size() * sizeof(decltype(_mvcc_columns->begin_cids)::value_type);
-    bytes += _mvcc_columns->end_cids.size() * sizeof(decltype(_mvcc_columns->end_cids)::value_type);
+    bytes += _mvcc_columns->estimate_memory_usage();
   }
 
   return bytes;
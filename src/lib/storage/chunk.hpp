@@ -50,6 +50,8 @@ class Chunk : private Noncopyable {
   // returns whether new rows can be appended to this Chunk
   bool is_mutable() const;
 
+  // marks the chunk as immutable and replaces its ValueColumns with contiguous ones (see ValueColumn::is_contiguous()).
+  // Called once the chunk is completed, i.e., by Insert and ChunkEncoder. Calls on immutable chunks have no effect.
   void mark_immutable();
 
   // Atomically replaces the current column at column_id with the passed column
@@ -156,7 +158,7 @@ class Chunk : private Noncopyable {
   std::shared_ptr<ChunkAccessCounter> _access_counter;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
-  bool _is_mutable = true;
+  std::atomic_bool _is_mutable{true};
 };
 
 }  // namespace opossum
@@ -12,6 +12,7 @@
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/base_encoded_column.hpp"
 #include "storage/column_encoding_utils.hpp"
+#include "storage/encoding_selector.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -24,14 +25,15 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
 
   std::vector<std::shared_ptr<ChunkColumnStatistics>> column_statistics;
   for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
-    const auto spec = chunk_encoding_spec[column_id];
-
     const auto data_type = data_types[column_id];
     const auto base_column = chunk->get_column(column_id);
     const auto value_column = std::dynamic_pointer_cast<const BaseValueColumn>(base_column);
 
     Assert(value_column != nullptr, "All columns of the chunk need to be of type ValueColumn<T>");
 
+    auto spec = chunk_encoding_spec[column_id];
+    if (spec.encoding_type == EncodingType::Auto) spec = EncodingSelector{}.select(*value_column);
+
     if (spec.encoding_type == EncodingType::Unencoded) {
       // No need to encode, but we still want to have statistics for the now immutable value column
       column_statistics.push_back(ChunkColumnStatistics::build_statistics(data_type, value_column));
@@ -46,7 +48,7 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
 
   if (chunk->has_mvcc_columns()) {
-    chunk->get_scoped_mvcc_columns_lock()->shrink();
+    chunk->mvcc_columns()->compact();
   }
 }
 
@@ -48,6 +48,8 @@ class ChunkEncoder {
    * Note: In some cases, it might be benificial to
    *       leave certain columns of a chunk unencoded.
    *       Use EncodingType::Unencoded in this case.
+   *       Columns with EncodingType::Auto are encoded as chosen by
+   *       the EncodingSelector with the default memory weight.
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& data_types,
                            const ChunkEncodingSpec& chunk_encoding_spec);
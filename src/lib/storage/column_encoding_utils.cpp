@@ -3,8 +3,11 @@
 #include <map>
 #include <memory>
 
+#include "storage/alp/alp_encoder.hpp"
+#include "storage/delta/delta_encoder.hpp"
 #include "storage/dictionary_column/dictionary_encoder.hpp"
 #include "storage/frame_of_reference/frame_of_reference_encoder.hpp"
+#include "storage/patched_frame_of_reference/patched_frame_of_reference_encoder.hpp"
 #include "storage/run_length_column/run_length_encoder.hpp"
 
 #include "storage/base_value_column.hpp"
@@ -24,12 +27,17 @@ const auto encoder_for_type = std::map<EncodingType, std::shared_ptr<BaseColumnE
     {EncodingType::Dictionary, std::make_shared<DictionaryEncoder<EncodingType::Dictionary>>()},
     {EncodingType::RunLength, std::make_shared<RunLengthEncoder>()},
     {EncodingType::FixedStringDictionary, std::make_shared<DictionaryEncoder<EncodingType::FixedStringDictionary>>()},
-    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()}};
+    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()},
+    {EncodingType::Delta, std::make_shared<DeltaEncoder>()},
+    {EncodingType::PatchedFrameOfReference, std::make_shared<PatchedFrameOfReferenceEncoder>()},
+    {EncodingType::Alp, std::make_shared<AlpEncoder>()},
+    {EncodingType::FrontCodedDictionary, std::make_shared<DictionaryEncoder<EncodingType::FrontCodedDictionary>>()}};
 
 }  // namespace
 
 std::unique_ptr<BaseColumnEncoder> create_encoder(EncodingType encoding_type) {
   Assert(encoding_type != EncodingType::Unencoded, "Encoding type must not be Unencoded`.");
+  Assert(encoding_type != EncodingType::Auto, "Encoding type Auto must be resolved using the EncodingSelector.");
 
   auto it = encoder_for_type.find(encoding_type);
   Assert(it != encoder_for_type.cend(), "All encoding types must be in encoder_for_type.");
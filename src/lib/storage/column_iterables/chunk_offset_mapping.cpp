@@ -1,18 +1,74 @@
 #include "chunk_offset_mapping.hpp"
 
+#include "storage/pos_list.hpp"
+#include "utils/assert.hpp"
+
 namespace opossum {
 
 ChunkOffsetsByChunkID split_pos_list_by_chunk_id(const PosList& pos_list) {
   auto chunk_offsets_by_chunk_id = ChunkOffsetsByChunkID{};
 
+  if (pos_list.references_single_chunk()) {
+    if (pos_list.empty()) return chunk_offsets_by_chunk_id;
+
+    auto& mapped_chunk_offsets = chunk_offsets_by_chunk_id[pos_list.common_chunk_id()];
+    mapped_chunk_offsets.reserve(pos_list.size());
+
+    for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < pos_list.size(); ++chunk_offset) {
+      mapped_chunk_offsets.push_back({chunk_offset, pos_list[chunk_offset].chunk_offset});
+    }
+
+    return chunk_offsets_by_chunk_id;
+  }
+
+  if (pos_list.grouped_by_chunk()) {
+    // Every chunk is referenced by a single run of positions (NULLs do not end a run). Each run is copied into its own
+    // ChunkOffsetsList, which is sized and added to the map once.
+    auto run_begin = ChunkOffset{0u};
+    while (run_begin < pos_list.size()) {
+      const auto chunk_id = pos_list[run_begin].chunk_id;
+      if (pos_list[run_begin].is_null()) {
+        ++run_begin;
+        continue;
+      }
+
+      auto run_end = static_cast<ChunkOffset>(run_begin + 1u);
+      while (run_end < pos_list.size() && (pos_list[run_end].chunk_id == chunk_id || pos_list[run_end].is_null())) {
+        ++run_end;
+      }
+
+      const auto [iter, inserted] = chunk_offsets_by_chunk_id.emplace(chunk_id, ChunkOffsetsList{});
+      DebugAssert(inserted, "PosList is not grouped by chunk");
+      auto& mapped_chunk_offsets = iter->second;
+      mapped_chunk_offsets.reserve(run_end - run_begin);
+
+      for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+        const auto row_id = pos_list[chunk_offset];
+        if (!row_id.is_null()) mapped_chunk_offsets.push_back({chunk_offset, row_id.chunk_offset});
+      }
+
+      run_begin = run_end;
+    }
+
+    return chunk_offsets_by_chunk_id;
+  }
+
+  // Without a guarantee, a chunk may be referenced by several runs. The ChunkOffsetsList is looked up whenever the
+  // referenced chunk changes.
+  auto current_chunk_id = INVALID_CHUNK_ID;
+  auto current_chunk_offsets = static_cast<ChunkOffsetsList*>(nullptr);
+
   for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < pos_list.size(); ++chunk_offset) {
     const auto row_id = pos_list[chunk_offset];
     if (row_id.is_null()) continue;
 
-    // Returns ChunkOffsetsList for row_id.chunk_id or creates new
-    auto& mapped_chunk_offsets = chunk_offsets_by_chunk_id[row_id.chunk_id];
+    if (row_id.chunk_id != current_chunk_id) {
+      // Returns ChunkOffsetsList for row_id.chunk_id or creates new
+      current_chunk_offsets = &chunk_offsets_by_chunk_id[row_id.chunk_id];
+      current_chunk_id = row_id.chunk_id;
+    }
 
-    mapped_chunk_offsets.push_back({chunk_offset, row_id.chunk_offset});
+    current_chunk_offsets->push_back({chunk_offset, row_id.chunk_offset});
   }
 
   return chunk_offsets_by_chunk_id;
@@ -1,10 +1,13 @@
 #pragma once
 
+#include "storage/alp/alp_iterable.hpp"
 #include "storage/column_iterables/any_column_iterable.hpp"
+#include "storage/delta/delta_iterable.hpp"
 #include "storage/dictionary_column/dictionary_column_iterable.hpp"
 #include "storage/encoding_type.hpp"
 
 #include "storage/frame_of_reference/frame_of_reference_iterable.hpp"
+#include "storage/patched_frame_of_reference/patched_frame_of_reference_iterable.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/run_length_column/run_length_column_iterable.hpp"
 #include "storage/value_column/value_column_iterable.hpp"
@@ -49,11 +52,31 @@ auto create_iterable_from_column(const FixedStringDictionaryColumn<T>& column) {
   return erase_type_from_iterable_if_debug(DictionaryColumnIterable<T, FixedStringVector>{column});
 }
 
+template <typename T>
+auto create_iterable_from_column(const FrontCodedDictionaryColumn<T>& column) {
+  return erase_type_from_iterable_if_debug(DictionaryColumnIterable<T, FrontCodedStringVector>{column});
+}
+
 template <typename T>
 auto create_iterable_from_column(const FrameOfReferenceColumn<T>& column) {
   return erase_type_from_iterable_if_debug(FrameOfReferenceIterable<T>{column});
 }
 
+template <typename T>
+auto create_iterable_from_column(const DeltaColumn<T>& column) {
+  return erase_type_from_iterable_if_debug(DeltaIterable<T>{column});
+}
+
+template <typename T>
+auto create_iterable_from_column(const PatchedFrameOfReferenceColumn<T>& column) {
+  return erase_type_from_iterable_if_debug(PatchedFrameOfReferenceIterable<T>{column});
+}
+
+template <typename T>
+auto create_iterable_from_column(const AlpColumn<T>& column) {
+  return erase_type_from_iterable_if_debug(AlpIterable<T>{column});
+}
+
 /**
  * This function must be forward-declared because ReferenceColumnIterable
  * includes this file leading to a circular dependency
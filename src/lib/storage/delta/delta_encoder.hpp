@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+
+#include "storage/base_column_encoder.hpp"
+
+#include "storage/delta_column.hpp"
+#include "storage/value_column.hpp"
+#include "storage/value_column/value_column_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class DeltaEncoder : public ColumnEncoder<DeltaEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::Delta>;
+  static constexpr auto _uses_vector_compression = true;  // see base_column_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedColumn> _on_encode(const std::shared_ptr<const ValueColumn<T>>& value_column) {
+    const auto alloc = value_column->with_values([](const auto& values) { return values.get_allocator(); });
+
+    static constexpr auto block_size = DeltaColumn<T>::block_size;
+
+    const auto size = value_column->size();
+
+    // holds the base value of each block
+    auto block_bases = pmr_vector<T>{alloc};
+    block_bases.reserve((size + block_size - 1u) / block_size);
+
+    // holds the uncompressed, zig-zag encoded differences
+    auto differences = pmr_vector<uint32_t>{alloc};
+    differences.reserve(size);
+
+    // holds whether a column value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    // used as optional input for the compression of the differences
+    auto max_difference = uint32_t{0u};
+
+    auto iterable = ValueColumnIterable<T>{*value_column};
+    iterable.with_iterators([&](auto column_it, auto column_end) {
+      // a temporary storage to hold the values of one block
+      auto current_value_block = std::array<T, block_size>{};
+      auto current_null_block = std::array<bool, block_size>{};
+
+      while (column_it != column_end) {
+        auto block_row_count = size_t{0u};
+        for (; block_row_count < block_size && column_it != column_end; ++block_row_count, ++column_it) {
+          const auto column_value = *column_it;
+
+          current_value_block[block_row_count] = column_value.is_null() ? T{0u} : column_value.value();
+          current_null_block[block_row_count] = column_value.is_null();
+          null_values.push_back(column_value.is_null());
+        }
+
+        // The base is the first non-NULL value of the block, so that leading NULLs have a difference of zero
+        const auto first_non_null_it =
+            std::find(current_null_block.cbegin(), current_null_block.cbegin() + block_row_count, false);
+        const auto first_non_null_index = static_cast<size_t>(first_non_null_it - current_null_block.cbegin());
+        const auto base = first_non_null_index < block_row_count ? current_value_block[first_non_null_index] : T{0};
+        block_bases.push_back(base);
+
+        // NULLs repeat the previous value
+        auto previous_value = base;
+        for (auto index = size_t{0u}; index < block_row_count; ++index) {
+          const auto value = current_null_block[index] ? previous_value : current_value_block[index];
+
+          const auto difference = DeltaColumn<T>::encode_difference(previous_value, value);
+          Assert(difference <= std::numeric_limits<uint32_t>::max(),
+                 "Differences between consecutive values must fit into uint32_t.");
+
+          differences.push_back(static_cast<uint32_t>(difference));
+          max_difference = std::max(max_difference, static_cast<uint32_t>(difference));
+          previous_value = value;
+        }
+      }
+    });
+
+    auto encoded_differences = compress_vector(differences, vector_compression_type(), alloc, {max_difference});
+
+    return std::allocate_shared<DeltaColumn<T>>(alloc, std::move(block_bases), std::move(null_values),
+                                                std::move(encoded_differences));
+  }
+};
+
+}  // namespace opossum
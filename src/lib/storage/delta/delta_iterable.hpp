@@ -0,0 +1,148 @@
+#pragma once
+
+#include <type_traits>
+
+#include "storage/column_iterables.hpp"
+
+#include "storage/delta_column.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class DeltaIterable : public PointAccessibleColumnIterable<DeltaIterable<T>> {
+ public:
+  explicit DeltaIterable(const DeltaColumn<T>& column) : _column{column} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    resolve_compressed_vector_type(_column.differences(), [&](const auto& differences) {
+      using DifferenceIteratorT = decltype(differences.cbegin());
+
+      auto begin = Iterator<DifferenceIteratorT>{_column.block_bases().cbegin(), differences.cbegin(),
+                                                 _column.null_values().cbegin()};
+
+      auto end = Iterator<DifferenceIteratorT>{differences.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
+    resolve_compressed_vector_type(_column.differences(), [&](const auto& vector) {
+      auto decoder = vector.create_decoder();
+      using DifferenceDecompressorT = std::decay_t<decltype(*decoder)>;
+
+      auto begin = PointAccessIterator<DifferenceDecompressorT>{&_column.block_bases(), &_column.null_values(),
+                                                                decoder.get(), mapped_chunk_offsets.cbegin()};
+
+      auto end = PointAccessIterator<DifferenceDecompressorT>{mapped_chunk_offsets.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _column.size(); }
+
+ private:
+  const DeltaColumn<T>& _column;
+
+ private:
+  template <typename DifferenceIteratorT>
+  class Iterator : public BaseColumnIterator<Iterator<DifferenceIteratorT>, ColumnIteratorValue<T>> {
+   public:
+    using BlockBaseIterator = typename pmr_vector<T>::const_iterator;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    // Begin Iterator
+    explicit Iterator(BlockBaseIterator block_base_it, DifferenceIteratorT difference_it,
+                      NullValueIterator null_value_it)
+        : _block_base_it{block_base_it},
+          _difference_it{difference_it},
+          _null_value_it{null_value_it},
+          _previous_value{},
+          _index_within_block{0u},
+          _chunk_offset{0u} {}
+
+    // End iterator
+    explicit Iterator(DifferenceIteratorT difference_it) : Iterator{{}, difference_it, {}} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      _previous_value = _current_value();
+
+      ++_difference_it;
+      ++_null_value_it;
+      ++_index_within_block;
+      ++_chunk_offset;
+
+      // The block base is only dereferenced once the next value is accessed, as there might be no further block
+      if (_index_within_block >= DeltaColumn<T>::block_size) {
+        _index_within_block = 0u;
+        ++_block_base_it;
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _difference_it == other._difference_it; }
+
+    ColumnIteratorValue<T> dereference() const {
+      return ColumnIteratorValue<T>{_current_value(), *_null_value_it, _chunk_offset};
+    }
+
+    T _current_value() const {
+      const auto previous_value = _index_within_block == 0u ? *_block_base_it : _previous_value;
+      return DeltaColumn<T>::apply_difference(previous_value, *_difference_it);
+    }
+
+   private:
+    BlockBaseIterator _block_base_it;
+    DifferenceIteratorT _difference_it;
+    NullValueIterator _null_value_it;
+    T _previous_value;
+    size_t _index_within_block;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename DifferenceDecompressorT>
+  class PointAccessIterator
+      : public BasePointAccessColumnIterator<PointAccessIterator<DifferenceDecompressorT>, ColumnIteratorValue<T>> {
+   public:
+    // Begin Iterator
+    PointAccessIterator(const pmr_vector<T>* block_bases, const pmr_vector<bool>* null_values,
+                        DifferenceDecompressorT* difference_decoder, ChunkOffsetsIterator chunk_offsets_it)
+        : BasePointAccessColumnIterator<PointAccessIterator<DifferenceDecompressorT>,
+                                        ColumnIteratorValue<T>>{chunk_offsets_it},
+          _block_bases{block_bases},
+          _null_values{null_values},
+          _difference_decoder{difference_decoder} {}
+
+    // End Iterator
+    explicit PointAccessIterator(ChunkOffsetsIterator chunk_offsets_it)
+        : PointAccessIterator{nullptr, nullptr, nullptr, chunk_offsets_it} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    ColumnIteratorValue<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      const auto is_null = (*_null_values)[chunk_offsets.into_referenced];
+      if (is_null) return ColumnIteratorValue<T>{T{}, true, chunk_offsets.into_referencing};
+
+      const auto value =
+          DeltaColumn<T>::decode_value(*_block_bases, *_difference_decoder, chunk_offsets.into_referenced);
+      return ColumnIteratorValue<T>{value, false, chunk_offsets.into_referencing};
+    }
+
+   private:
+    const pmr_vector<T>* _block_bases;
+    const pmr_vector<bool>* _null_values;
+    DifferenceDecompressorT* _difference_decoder;
+  };
+};
+
+}  // namespace opossum
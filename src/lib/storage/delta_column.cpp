@@ -0,0 +1,93 @@
+#include "delta_column.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+DeltaColumn<T, U>::DeltaColumn(pmr_vector<T> block_bases, pmr_vector<bool> null_values,
+                               std::unique_ptr<const BaseCompressedVector> differences)
+    : BaseEncodedColumn{data_type_from_type<T>()},
+      _block_bases{std::move(block_bases)},
+      _null_values{std::move(null_values)},
+      _differences{std::move(differences)},
+      _decoder{_differences->create_base_decoder()} {}
+
+template <typename T, typename U>
+const pmr_vector<T>& DeltaColumn<T, U>::block_bases() const {
+  return _block_bases;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& DeltaColumn<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& DeltaColumn<T, U>::differences() const {
+  return *_differences;
+}
+
+template <typename T, typename U>
+const AllTypeVariant DeltaColumn<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+
+  return *typed_value;
+}
+
+template <typename T, typename U>
+std::optional<T> DeltaColumn<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  return decode_value(_block_bases, *_decoder, chunk_offset);
+}
+
+template <typename T, typename U>
+size_t DeltaColumn<T, U>::size() const {
+  return _differences->size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseColumn> DeltaColumn<T, U>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_block_bases = pmr_vector<T>{_block_bases, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+  auto new_differences = _differences->copy_using_allocator(alloc);
+
+  return std::allocate_shared<DeltaColumn>(alloc, std::move(new_block_bases), std::move(new_null_values),
+                                           std::move(new_differences));
+}
+
+template <typename T, typename U>
+size_t DeltaColumn<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + sizeof(T) * _block_bases.size() + _differences->data_size() +
+         _null_values.size() / bits_per_byte;
+}
+
+template <typename T, typename U>
+EncodingType DeltaColumn<T, U>::encoding_type() const {
+  return EncodingType::Delta;
+}
+
+template <typename T, typename U>
+CompressedVectorType DeltaColumn<T, U>::compressed_vector_type() const {
+  return _differences->type();
+}
+
+template class DeltaColumn<int32_t>;
+template class DeltaColumn<int64_t>;
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <memory>
+#include <optional>
+
+#include "base_encoded_column.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Column implementing delta encoding
+ *
+ * Delta encoding divides the values of a column into fixed-size blocks.
+ * Each block stores a base value (its first non-NULL value). All values
+ * are encoded as the difference to their predecessor (or to the base for
+ * the first value of a block). The differences are zig-zag encoded so
+ * that small negative differences become small unsigned integers, and are
+ * compressed using vector compression. For ascending or slowly changing
+ * columns such as IDs or timestamps, these differences are much smaller
+ * than the offsets stored by FrameOfReference. With SimdBp128, the bit
+ * width is chosen per 128 differences and decoding uses SIMD instructions.
+ *
+ * A NULL value is stored as a difference of zero. Since a value is the sum
+ * of all preceding differences in its block, accessing a single value
+ * decodes up to block_size differences.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::Delta>,
+                                                                               hana::type_c<T>)>>
+class DeltaColumn : public BaseEncodedColumn {
+ public:
+  /**
+   * The block size matches the block size of SimdBp128,
+   * so that point access needs to unpack at most one block.
+   */
+  static constexpr auto block_size = 128u;
+
+  explicit DeltaColumn(pmr_vector<T> block_bases, pmr_vector<bool> null_values,
+                       std::unique_ptr<const BaseCompressedVector> differences);
+
+  const pmr_vector<T>& block_bases() const;
+  const pmr_vector<bool>& null_values() const;
+  const BaseCompressedVector& differences() const;
+
+  // Returns the value at a certain position or std::nullopt if it is NULL. Unlike operator[], this is typed and
+  // does not go through an AllTypeVariant.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  /**
+   * Zig-zag encodes the difference between value and previous_value, i.e., the differences 0, -1, 1, -2, ... are
+   * mapped to 0, 1, 2, 3, ... The computation uses unsigned arithmetic so that it wraps around instead of overflowing.
+   */
+  static std::make_unsigned_t<T> encode_difference(const T previous_value, const T value) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    const auto difference = static_cast<T>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(previous_value));
+    return (static_cast<UnsignedT>(difference) << 1u) ^ static_cast<UnsignedT>(difference >> (sizeof(T) * 8u - 1u));
+  }
+
+  // Inverse of encode_difference()
+  static T apply_difference(const T previous_value, const uint32_t encoded_difference) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    const auto zig_zag = static_cast<UnsignedT>(encoded_difference);
+    const auto difference = (zig_zag >> 1u) ^ (UnsignedT{0u} - (zig_zag & 1u));
+    return static_cast<T>(static_cast<UnsignedT>(previous_value) + difference);
+  }
+
+  // Decodes the value at chunk_offset using the passed decompressor, regardless of whether it is NULL
+  template <typename DifferenceDecompressorT>
+  static T decode_value(const pmr_vector<T>& block_bases, DifferenceDecompressorT& decompressor,
+                        const ChunkOffset chunk_offset) {
+    const auto block_begin = chunk_offset - chunk_offset % block_size;
+
+    auto value = block_bases[chunk_offset / block_size];
+    for (auto index = block_begin; index <= chunk_offset; ++index) {
+      value = apply_difference(value, decompressor.get(index));
+    }
+    return value;
+  }
+
+  /**
+   * @defgroup BaseColumn interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedColumn interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  CompressedVectorType compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<T> _block_bases;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _differences;
+  std::unique_ptr<BaseVectorDecompressor> _decoder;
+};
+
+}  // namespace opossum
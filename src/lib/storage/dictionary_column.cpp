@@ -25,12 +25,21 @@ template <typename T>
 const AllTypeVariant DictionaryColumn<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
 
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+std::optional<T> DictionaryColumn<T>::get_typed_value(const ChunkOffset chunk_offset) const {
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
 
   const auto value_id = _decoder->get(chunk_offset);
 
   if (value_id == _null_value_id) {
-    return NULL_VALUE;
+    return std::nullopt;
   }
 
   return (*_dictionary)[value_id];
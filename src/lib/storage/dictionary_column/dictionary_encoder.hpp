@@ -8,6 +8,7 @@
 
 #include "storage/dictionary_column.hpp"
 #include "storage/fixed_string_dictionary_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
 #include "storage/value_column.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 
@@ -33,18 +34,18 @@ class DictionaryEncoder : public ColumnEncoder<DictionaryEncoder<Encoding>> {
   std::shared_ptr<BaseEncodedColumn> _on_encode(const std::shared_ptr<const ValueColumn<T>>& value_column) {
     // See: https://goo.gl/MCM5rr
     // Create dictionary (enforce uniqueness and sorting)
-    const auto& values = value_column->values();
-
-    if constexpr (Encoding == EncodingType::FixedStringDictionary) {
-      // Encode a column with a FixedStringVector as dictionary. std::string is the only supported type
-      return _encode_dictionary_column(
-          FixedStringVector{values.cbegin(), values.cend(), _calculate_fixed_string_length(values), values.size()},
-          value_column);
-    } else {
-      // Encode a column with a pmr_vector<T> as dictionary
-      return _encode_dictionary_column(pmr_vector<T>{values.cbegin(), values.cend(), values.get_allocator()},
-                                       value_column);
-    }
+    return value_column->with_values([&](const auto& values) -> std::shared_ptr<BaseEncodedColumn> {
+      if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+        // Encode a column with a FixedStringVector as dictionary. std::string is the only supported type
+        return _encode_dictionary_column(
+            FixedStringVector{values.cbegin(), values.cend(), _calculate_fixed_string_length(values), values.size()},
+            values, value_column);
+      } else {
+        // Encode a column with a pmr_vector<T> as dictionary
+        return _encode_dictionary_column(pmr_vector<T>{values.cbegin(), values.cend(), values.get_allocator()},
+                                         values, value_column);
+      }
+    });
   }
 
  private:
@@ -54,14 +55,14 @@ class DictionaryEncoder : public ColumnEncoder<DictionaryEncoder<Encoding>> {
         std::distance(dictionary.cbegin(), std::lower_bound(dictionary.cbegin(), dictionary.cend(), value)));
   }
 
-  template <typename U, typename T>
+  // Values is either a pmr_concurrent_vector or, if the ValueColumn is contiguous, a pmr_vector
+  template <typename U, typename Values, typename T>
   std::shared_ptr<BaseEncodedColumn> _encode_dictionary_column(
-      U dictionary, const std::shared_ptr<const ValueColumn<T>>& value_column) {
-    const auto& values = value_column->values();
+      U dictionary, const Values& values, const std::shared_ptr<const ValueColumn<T>>& value_column) {
     const auto alloc = values.get_allocator();
 
     // Remove null values from value vector
-    if (value_column->is_nullable()) {
+    if (value_column->contains_nulls()) {
       const auto& null_values = value_column->null_values();
 
       // Swap values to back if value is null
@@ -86,7 +87,7 @@ class DictionaryEncoder : public ColumnEncoder<DictionaryEncoder<Encoding>> {
 
     const auto null_value_id = static_cast<uint32_t>(dictionary.size());
 
-    if (value_column->is_nullable()) {
+    if (value_column->contains_nulls()) {
       const auto& null_values = value_column->null_values();
 
       /**
@@ -117,19 +118,26 @@ class DictionaryEncoder : public ColumnEncoder<DictionaryEncoder<Encoding>> {
 
     auto encoded_attribute_vector = compress_vector(
         attribute_vector, ColumnEncoder<DictionaryEncoder<Encoding>>::vector_compression_type(), alloc, {max_value});
-    auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
     auto attribute_vector_sptr = std::shared_ptr<const BaseCompressedVector>(std::move(encoded_attribute_vector));
 
-    if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+    if constexpr (Encoding == EncodingType::FrontCodedDictionary) {
+      // The dictionary is sorted and unique at this point, which front coding requires
+      auto dictionary_sptr = std::allocate_shared<FrontCodedStringVector>(alloc, dictionary);
+      return std::allocate_shared<FrontCodedDictionaryColumn<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
+                                                                 ValueID{null_value_id});
+    } else if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<FixedStringDictionaryColumn<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                                   ValueID{null_value_id});
     } else {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<DictionaryColumn<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                        ValueID{null_value_id});
     }
   }
 
-  size_t _calculate_fixed_string_length(const pmr_concurrent_vector<std::string>& values) const {
+  template <typename Values>
+  size_t _calculate_fixed_string_length(const Values& values) const {
     size_t max_string_length = 0;
     for (const auto& value : values) {
       if (value.size() > max_string_length) max_string_length = value.size();
@@ -0,0 +1,393 @@
+#include "encoding_selector.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/alp/alp_encoder.hpp"
+#include "storage/base_value_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/delta_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/front_coded_dictionary_column/front_coded_string_vector.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+/**
+ * Approximate per-row scan costs relative to a scan on an unencoded numeric column. They are not meant to predict
+ * execution times, they only need to get the order of the encodings right.
+ */
+constexpr auto UNENCODED_SCAN_COST = 1.0f;
+constexpr auto UNENCODED_STRING_SCAN_COST_PER_CHAR = 1.0f / 16.0f;
+constexpr auto DICTIONARY_SCAN_COST = 0.6f;
+// Accessing a value of a front-coded dictionary decodes the strings before it in its block
+constexpr auto FRONT_CODED_DICTIONARY_SCAN_COST = 0.7f;
+constexpr auto FRAME_OF_REFERENCE_SCAN_COST = 0.9f;
+constexpr auto DELTA_SCAN_COST = 1.2f;
+constexpr auto ALP_SCAN_COST = 1.0f;
+constexpr auto RUN_LENGTH_SCAN_COST_PER_ROW = 0.4f;
+constexpr auto RUN_LENGTH_SCAN_COST_PER_RUN = 1.0f;
+
+// Decoding SIMD-BP128 blocks is slower than reading byte-aligned values
+constexpr auto SIMD_BP_128_SCAN_COST_FACTOR = 2.0f;
+
+// Strings of up to this length are stored inside std::string without a heap allocation
+constexpr auto SMALL_STRING_CAPACITY = 15.0f;
+
+struct Candidate {
+  ColumnEncodingSpec spec;
+  float memory_per_row;
+  float scan_cost;
+};
+
+// The number of bytes per value that FixedSizeByteAligned needs for values up to max_value
+float fixed_size_byte_aligned_width(const uint64_t max_value) {
+  if (max_value <= std::numeric_limits<uint8_t>::max()) return 1.0f;
+  if (max_value <= std::numeric_limits<uint16_t>::max()) return 2.0f;
+  return 4.0f;
+}
+
+// The number of bytes per value that SimdBp128 needs for values up to max_value, ignoring the block headers
+float simd_bp_128_width(const uint64_t max_value) {
+  auto bit_count = 1u;
+  while (bit_count < 32u && (max_value >> bit_count) != 0u) ++bit_count;
+  return static_cast<float>(bit_count) / 8.0f;
+}
+
+// Adds a candidate for each vector compression type
+void add_vector_compression_candidates(std::vector<Candidate>& candidates, const EncodingType encoding_type,
+                                       const uint64_t max_value, const float memory_overhead_per_row,
+                                       const float scan_cost) {
+  candidates.push_back({ColumnEncodingSpec{encoding_type, VectorCompressionType::FixedSizeByteAligned},
+                        fixed_size_byte_aligned_width(max_value) + memory_overhead_per_row, scan_cost});
+  candidates.push_back({ColumnEncodingSpec{encoding_type, VectorCompressionType::SimdBp128},
+                        simd_bp_128_width(max_value) + memory_overhead_per_row,
+                        scan_cost * SIMD_BP_128_SCAN_COST_FACTOR});
+}
+
+template <typename T, typename Values>
+void characterize_values(const ValueColumn<T>& column, const Values& values,
+                         EncodingSelector::ColumnCharacteristics& characteristics) {
+  const auto row_count = values.size();
+  characteristics.row_count = row_count;
+  if (row_count == 0u) return;
+
+  // The null count is exact, words without NULLs are skipped
+  const auto contains_nulls = column.contains_nulls();
+  if (contains_nulls) {
+    const auto& null_values = column.null_values();
+    for (auto word_index = size_t{0}; word_index < NullValueVector::word_count_for(row_count); ++word_index) {
+      characteristics.null_count += std::bitset<NullValueVector::BITS_PER_WORD>(null_values.word(word_index)).count();
+    }
+  }
+
+  const auto is_null = [&](const size_t chunk_offset) { return contains_nulls && column.null_values()[chunk_offset]; };
+
+  // Small columns are sampled completely
+  const auto sample_all = row_count <= EncodingSelector::SAMPLE_BLOCK_COUNT * EncodingSelector::SAMPLE_BLOCK_SIZE;
+  const auto block_count = sample_all ? size_t{1} : EncodingSelector::SAMPLE_BLOCK_COUNT;
+  const auto block_size = sample_all ? row_count : EncodingSelector::SAMPLE_BLOCK_SIZE;
+  const auto block_distance = row_count / block_count;
+
+  auto value_counts = std::unordered_map<T, size_t>{};
+  auto sampled_value_count = size_t{0};
+  auto neighbor_count = size_t{0};
+  auto change_count = size_t{0};
+  auto string_length_sum = size_t{0};
+
+  // For floating-point columns, ALP chooses its parameters for each sampled block like the AlpEncoder does
+  auto alp_block_values = std::vector<T>{};
+  auto alp_sampled_values = std::vector<T>{};
+  auto alp_sampled_value_count = size_t{0};
+  auto alp_exception_count = size_t{0};
+  auto alp_max_bit_width = size_t{0};
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_begin = block_index * block_distance;
+    const auto block_end = std::min(block_begin + block_size, row_count);
+    alp_block_values.clear();
+
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      const auto value_is_null = is_null(chunk_offset);
+
+      // A NULL and a value or two different values next to each other start a new run
+      if (chunk_offset > block_begin) {
+        ++neighbor_count;
+        const auto previous_is_null = is_null(chunk_offset - 1);
+        if (value_is_null != previous_is_null ||
+            (!value_is_null && !(values[chunk_offset] == values[chunk_offset - 1]))) {
+          ++change_count;
+        }
+      }
+
+      if (value_is_null) continue;
+
+      const auto& value = values[chunk_offset];
+      ++value_counts[value];
+      ++sampled_value_count;
+
+      if constexpr (std::is_same_v<T, std::string>) {
+        string_length_sum += value.size();
+        characteristics.max_string_length = std::max(characteristics.max_string_length, value.size());
+      }
+
+      if constexpr (std::is_floating_point_v<T>) {
+        alp_block_values.push_back(value);
+      }
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+      static constexpr auto alp_block_size = size_t{AlpColumn<T>::block_size};
+
+      for (auto alp_begin = size_t{0}; alp_begin < alp_block_values.size(); alp_begin += alp_block_size) {
+        const auto alp_end = std::min(alp_begin + alp_block_size, alp_block_values.size());
+        const auto sample_stride = std::max(size_t{1}, (alp_end - alp_begin) / AlpEncoder::sample_size);
+
+        alp_sampled_values.clear();
+        for (auto index = alp_begin; index < alp_end; index += sample_stride) {
+          alp_sampled_values.push_back(alp_block_values[index]);
+        }
+
+        const auto parameters = AlpEncoder::choose_parameters(alp_sampled_values);
+        alp_sampled_value_count += alp_sampled_values.size();
+        alp_exception_count += parameters.exception_count;
+        alp_max_bit_width = std::max(alp_max_bit_width, parameters.bit_width);
+      }
+    }
+  }
+
+  if constexpr (std::is_floating_point_v<T>) {
+    characteristics.alp_max_offset = (uint64_t{1} << alp_max_bit_width) - 1u;
+    if (alp_sampled_value_count > 0u) {
+      characteristics.alp_exception_ratio =
+          static_cast<float>(alp_exception_count) / static_cast<float>(alp_sampled_value_count);
+    }
+  }
+
+  characteristics.run_count =
+      neighbor_count == 0u ? size_t{1} : 1u + change_count * (row_count - 1u) / neighbor_count;
+
+  if (sampled_value_count > 0u) {
+    characteristics.avg_string_length =
+        static_cast<float>(string_length_sum) / static_cast<float>(sampled_value_count);
+  }
+
+  // Front code the distinct values of the sample. As the sample lacks most of the values in between, this rather
+  // underestimates the prefixes that neighboring strings share.
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (!value_counts.empty()) {
+      auto distinct_values = pmr_vector<std::string>{};
+      distinct_values.reserve(value_counts.size());
+      for (const auto& value_count : value_counts) distinct_values.push_back(value_count.first);
+      std::sort(distinct_values.begin(), distinct_values.end());
+
+      const auto front_coded_values = FrontCodedStringVector{distinct_values};
+      characteristics.avg_front_coded_string_size =
+          static_cast<float>(front_coded_values.data_size() - sizeof(FrontCodedStringVector)) /
+          static_cast<float>(distinct_values.size());
+    }
+  }
+
+  // The distinct count is extrapolated using the Guaranteed-Error Estimator (Charikar et al., PODS 2000): values
+  // that occur once in the sample are assumed to stand for sqrt(non_null_count / sampled_value_count) values. As
+  // this underestimates columns that are (nearly) unique, those are extrapolated linearly instead.
+  const auto sampled_distinct_count = value_counts.size();
+  const auto non_null_count = row_count - characteristics.null_count;
+  if (sample_all || sampled_value_count == 0u) {
+    characteristics.distinct_count = sampled_distinct_count;
+  } else {
+    const auto singleton_count = static_cast<size_t>(
+        std::count_if(value_counts.cbegin(), value_counts.cend(), [](const auto& pair) { return pair.second == 1u; }));
+    const auto scale = static_cast<double>(non_null_count) / static_cast<double>(sampled_value_count);
+
+    auto estimate = size_t{0};
+    if (singleton_count * 10u >= sampled_value_count * 9u) {
+      estimate = static_cast<size_t>(scale * static_cast<double>(sampled_distinct_count));
+    } else {
+      estimate = static_cast<size_t>(std::sqrt(scale) * static_cast<double>(singleton_count)) +
+                 (sampled_distinct_count - singleton_count);
+    }
+    characteristics.distinct_count = std::clamp(estimate, sampled_distinct_count, non_null_count);
+  }
+
+  // The block ranges decide whether FrameOfReference is applicable at all, so they are not sampled but computed
+  // exactly. Like the FrameOfReferenceEncoder, NULLs are treated as 0.
+  if constexpr (std::is_integral_v<T>) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    static constexpr auto for_block_size = size_t{FrameOfReferenceColumn<T>::block_size};
+
+    auto max_block_range = uint64_t{0};
+    for (auto block_begin = size_t{0}; block_begin < row_count; block_begin += for_block_size) {
+      const auto block_end = std::min(block_begin + for_block_size, row_count);
+
+      auto block_min = std::numeric_limits<T>::max();
+      auto block_max = std::numeric_limits<T>::min();
+      for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+        const auto value = is_null(chunk_offset) ? T{0} : values[chunk_offset];
+        block_min = std::min(block_min, value);
+        block_max = std::max(block_max, value);
+      }
+
+      const auto block_range = static_cast<UnsignedT>(block_max) - static_cast<UnsignedT>(block_min);
+      max_block_range = std::max(max_block_range, static_cast<uint64_t>(static_cast<UnsignedT>(block_range)));
+    }
+
+    characteristics.max_block_range = max_block_range;
+
+    // Like the DeltaEncoder, each block starts at its first non-NULL value and NULLs repeat the previous value
+    static constexpr auto delta_block_size = size_t{DeltaColumn<T>::block_size};
+
+    auto max_difference = uint64_t{0};
+    for (auto block_begin = size_t{0}; block_begin < row_count; block_begin += delta_block_size) {
+      const auto block_end = std::min(block_begin + delta_block_size, row_count);
+
+      auto previous_value = std::optional<T>{};
+      for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+        if (is_null(chunk_offset)) continue;
+
+        const auto value = values[chunk_offset];
+        if (previous_value) {
+          const auto difference = DeltaColumn<T>::encode_difference(*previous_value, value);
+          max_difference = std::max(max_difference, static_cast<uint64_t>(difference));
+        }
+        previous_value = value;
+      }
+    }
+
+    characteristics.max_difference = max_difference;
+  }
+}
+
+}  // namespace
+
+EncodingSelector::EncodingSelector(const float memory_weight) : _memory_weight{memory_weight} {
+  Assert(memory_weight >= 0.0f && memory_weight <= 1.0f, "Memory weight must be between 0 and 1.");
+}
+
+ColumnEncodingSpec EncodingSelector::select(const BaseValueColumn& column) const {
+  return select(characterize(column), column.data_type());
+}
+
+ChunkEncodingSpec EncodingSelector::select(const Chunk& chunk) const {
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(chunk.column_count());
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto value_column = std::dynamic_pointer_cast<const BaseValueColumn>(chunk.get_column(column_id));
+    Assert(value_column, "Encodings can only be selected for value columns.");
+
+    chunk_encoding_spec.push_back(select(*value_column));
+  }
+
+  return chunk_encoding_spec;
+}
+
+ColumnEncodingSpec EncodingSelector::select(const ColumnCharacteristics& characteristics,
+                                            const DataType data_type) const {
+  const auto row_count = static_cast<float>(std::max(characteristics.row_count, size_t{1}));
+  const auto distinct_count = static_cast<float>(characteristics.distinct_count);
+  const auto run_count = static_cast<float>(characteristics.run_count);
+
+  auto value_size = 0.0f;
+  auto unencoded_scan_cost = UNENCODED_SCAN_COST;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    value_size = static_cast<float>(sizeof(ColumnDataType));
+    if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+      if (characteristics.avg_string_length > SMALL_STRING_CAPACITY) value_size += characteristics.avg_string_length;
+      unencoded_scan_cost += characteristics.avg_string_length * UNENCODED_STRING_SCAN_COST_PER_CHAR;
+    }
+  });
+
+  auto candidates = std::vector<Candidate>{};
+
+  // The attribute vector of dictionary columns stores distinct_count as the value id of NULL
+  const auto dictionary_size_per_row = distinct_count * value_size / row_count;
+  add_vector_compression_candidates(candidates, EncodingType::Dictionary, characteristics.distinct_count,
+                                    dictionary_size_per_row, DICTIONARY_SCAN_COST);
+
+  if (data_type == DataType::String) {
+    const auto fixed_string_dictionary_size_per_row =
+        distinct_count * static_cast<float>(characteristics.max_string_length) / row_count;
+    add_vector_compression_candidates(candidates, EncodingType::FixedStringDictionary,
+                                      characteristics.distinct_count, fixed_string_dictionary_size_per_row,
+                                      DICTIONARY_SCAN_COST);
+
+    const auto front_coded_dictionary_size_per_row =
+        distinct_count * characteristics.avg_front_coded_string_size / row_count;
+    add_vector_compression_candidates(candidates, EncodingType::FrontCodedDictionary, characteristics.distinct_count,
+                                      front_coded_dictionary_size_per_row, FRONT_CODED_DICTIONARY_SCAN_COST);
+  }
+
+  // Each run stores its value, its end position and whether it is NULL
+  const auto run_length_size_per_run = value_size + static_cast<float>(sizeof(ChunkOffset) + sizeof(bool));
+  candidates.push_back({ColumnEncodingSpec{EncodingType::RunLength}, run_count * run_length_size_per_run / row_count,
+                        RUN_LENGTH_SCAN_COST_PER_ROW + RUN_LENGTH_SCAN_COST_PER_RUN * run_count / row_count});
+
+  // The offsets of FrameOfReference must fit into uint32_t. Besides the offsets, it stores the minimum of each block
+  // and a bool per row for NULLs.
+  if (characteristics.max_block_range && *characteristics.max_block_range <= std::numeric_limits<uint32_t>::max()) {
+    const auto block_size = static_cast<float>(FrameOfReferenceColumn<int32_t>::block_size);
+    const auto overhead_per_row = value_size / block_size + 1.0f / 8.0f;
+    add_vector_compression_candidates(candidates, EncodingType::FrameOfReference, *characteristics.max_block_range,
+                                      overhead_per_row, FRAME_OF_REFERENCE_SCAN_COST);
+  }
+
+  // The same holds for the differences of Delta, which stores the first value of each block
+  if (characteristics.max_difference && *characteristics.max_difference <= std::numeric_limits<uint32_t>::max()) {
+    const auto block_size = static_cast<float>(DeltaColumn<int32_t>::block_size);
+    const auto overhead_per_row = value_size / block_size + 1.0f / 8.0f;
+    add_vector_compression_candidates(candidates, EncodingType::Delta, *characteristics.max_difference,
+                                      overhead_per_row, DELTA_SCAN_COST);
+  }
+
+  // ALP stores the parameters, the minimum and the maximum of each block, a bool per row for NULLs, and the chunk
+  // offset and the value of each exception
+  if (characteristics.alp_max_offset) {
+    const auto block_size = static_cast<float>(AlpColumn<double>::block_size);
+    const auto exception_size = static_cast<float>(sizeof(ChunkOffset)) + value_size;
+    const auto overhead_per_row = static_cast<float>(sizeof(AlpColumn<double>::Block)) / block_size + 1.0f / 8.0f +
+                                  characteristics.alp_exception_ratio * exception_size;
+    add_vector_compression_candidates(candidates, EncodingType::Alp, *characteristics.alp_max_offset,
+                                      overhead_per_row, ALP_SCAN_COST);
+  }
+
+  const auto score = [&](const Candidate& candidate) {
+    return _memory_weight * candidate.memory_per_row / value_size +
+           (1.0f - _memory_weight) * candidate.scan_cost / unencoded_scan_cost;
+  };
+
+  const auto best_candidate = std::min_element(
+      candidates.cbegin(), candidates.cend(), [&](const auto& lhs, const auto& rhs) { return score(lhs) < score(rhs); });
+  return best_candidate->spec;
+}
+
+EncodingSelector::ColumnCharacteristics EncodingSelector::characterize(const BaseValueColumn& column) {
+  auto characteristics = ColumnCharacteristics{};
+
+  resolve_data_type(column.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& value_column = static_cast<const ValueColumn<ColumnDataType>&>(column);
+    value_column.with_values(
+        [&](const auto& values) { characterize_values(value_column, values, characteristics); });
+  });
+
+  return characteristics;
+}
+
+float EncodingSelector::memory_weight() const { return _memory_weight; }
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseValueColumn;
+class Chunk;
+
+/**
+ * @brief Chooses the encoding of a value column based on its data
+ *
+ * The selector samples a column, estimates the memory usage and the scan cost of each applicable encoding and vector
+ * compression type, and picks the one with the lowest score. The score weighs memory usage and scan cost (both
+ * relative to the unencoded column) by memory_weight and 1 - memory_weight, respectively. Thus, a memory_weight of 0
+ * picks the encoding that is expected to scan fastest, a memory_weight of 1 picks the smallest one.
+ *
+ * ChunkEncoder uses the default selector for columns whose encoding type is EncodingType::Auto.
+ */
+class EncodingSelector {
+ public:
+  static constexpr auto DEFAULT_MEMORY_WEIGHT = 0.5f;
+
+  // The sample consists of SAMPLE_BLOCK_COUNT evenly spread blocks of consecutive rows, so that runs can be counted
+  static constexpr auto SAMPLE_BLOCK_COUNT = size_t{4};
+  static constexpr auto SAMPLE_BLOCK_SIZE = size_t{2048};
+
+  // The properties of a column that the choice is based on
+  struct ColumnCharacteristics {
+    size_t row_count{0};
+    size_t null_count{0};
+
+    // Estimated from the sample, see EncodingSelector::characterize()
+    size_t run_count{0};
+    size_t distinct_count{0};
+
+    // Only set for integral columns: the largest difference between two values of a FrameOfReference block
+    std::optional<uint64_t> max_block_range;
+
+    // Only set for integral columns: the largest zig-zag encoded difference between two neighbors of a Delta block
+    std::optional<uint64_t> max_difference;
+
+    // Only set for floating-point columns: the largest offset of an ALP block and the share of values that ALP
+    // stores as exceptions, both estimated from the sample
+    std::optional<uint64_t> alp_max_offset;
+    float alp_exception_ratio{0.0f};
+
+    // Only set for string columns
+    size_t max_string_length{0};
+    float avg_string_length{0.0f};
+
+    // Only set for string columns: the average number of bytes per distinct value of a front-coded dictionary,
+    // estimated by front coding the distinct values of the sample
+    float avg_front_coded_string_size{0.0f};
+  };
+
+  explicit EncodingSelector(const float memory_weight = DEFAULT_MEMORY_WEIGHT);
+
+  ColumnEncodingSpec select(const BaseValueColumn& column) const;
+
+  // Selects an encoding for each column of the chunk. All columns need to be value columns.
+  ChunkEncodingSpec select(const Chunk& chunk) const;
+
+  ColumnEncodingSpec select(const ColumnCharacteristics& characteristics, const DataType data_type) const;
+
+  static ColumnCharacteristics characterize(const BaseValueColumn& column);
+
+  float memory_weight() const;
+
+ private:
+  const float _memory_weight;
+};
+
+}  // namespace opossum
@@ -17,7 +17,12 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class EncodingType : uint8_t { Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference };
+/**
+ * Unencoded and Auto are not actual encodings: Unencoded leaves a ValueColumn as it is, Auto lets the ChunkEncoder
+ * choose an encoding based on the column's data (see EncodingSelector).
+ */
+enum class EncodingType : uint8_t { Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference,
+                                  Delta, PatchedFrameOfReference, Alp, FrontCodedDictionary, Auto };
 
 /**
  * @brief Maps each encoding type to its supported data types
@@ -31,7 +36,11 @@ constexpr auto supported_data_types_for_encoding_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::Dictionary>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>, hana::tuple_t<std::string>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t, int64_t>));
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::Delta>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::PatchedFrameOfReference>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::Alp>, hana::tuple_t<float, double>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrontCodedDictionary>, hana::tuple_t<std::string>));
 
 //  Example for an encoding that doesn’t support all data types:
 //  hana::make_pair(enum_c<EncodingType, EncodingType::NewEncoding>, hana::tuple_t<int32_t, int64_t>)
@@ -26,15 +26,24 @@ template <typename T>
 const AllTypeVariant FixedStringDictionaryColumn<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
 
+  auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return AllTypeVariant{std::move(*typed_value)};
+}
+
+template <typename T>
+std::optional<T> FixedStringDictionaryColumn<T>::get_typed_value(const ChunkOffset chunk_offset) const {
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
 
   const auto value_id = _decoder->get(chunk_offset);
 
   if (value_id == _null_value_id) {
-    return NULL_VALUE;
+    return std::nullopt;
   }
 
-  return AllTypeVariant{std::move(_dictionary->get_string_at(value_id))};
+  return _dictionary->get_string_at(value_id);
 }
 
 template <typename T>
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "base_dictionary_column.hpp"
@@ -31,6 +32,10 @@ class FixedStringDictionaryColumn : public BaseDictionaryColumn {
   // returns an underlying dictionary
   std::shared_ptr<const FixedStringVector> fixed_string_dictionary() const;
 
+  // Returns the value at a certain position or std::nullopt if it is NULL. Unlike operator[], this is typed and
+  // does not go through an AllTypeVariant.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
   /**
    * @defgroup BaseColumn interface
    * @{
@@ -23,7 +23,7 @@ class FrameOfReferenceEncoder : public ColumnEncoder<FrameOfReferenceEncoder> {
 
   template <typename T>
   std::shared_ptr<BaseEncodedColumn> _on_encode(const std::shared_ptr<const ValueColumn<T>>& value_column) {
-    const auto alloc = value_column->values().get_allocator();
+    const auto alloc = value_column->with_values([](const auto& values) { return values.get_allocator(); });
 
     static constexpr auto block_size = FrameOfReferenceColumn<T>::block_size;
 
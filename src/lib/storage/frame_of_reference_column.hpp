@@ -8,6 +8,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 
 #include "base_encoded_column.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
@@ -49,6 +50,10 @@ class FrameOfReferenceColumn : public BaseEncodedColumn {
   const pmr_vector<bool>& null_values() const;
   const BaseCompressedVector& offset_values() const;
 
+  // Returns the value at a certain position or std::nullopt if it is NULL. Unlike operator[], this is typed and
+  // does not go through an AllTypeVariant.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
   /**
    * @defgroup BaseColumn interface
    * @{
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "base_dictionary_column.hpp"
+#include "front_coded_dictionary_column/front_coded_string_vector.hpp"
+#include "types.hpp"
+#include "vector_compression/base_compressed_vector.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Column implementing dictionary encoding for strings with a front-coded dictionary
+ *
+ * The dictionary stores each string as the suffix that it does not share with its predecessor (see
+ * FrontCodedStringVector), which suits columns with long, similar strings such as URLs. Equality and range predicates
+ * use lower_bound() and upper_bound(), which search the dictionary without decoding it.
+ * Uses vector compression schemes for its attribute vector.
+ */
+template <typename T>
+class FrontCodedDictionaryColumn : public BaseDictionaryColumn {
+ public:
+  explicit FrontCodedDictionaryColumn(const std::shared_ptr<const FrontCodedStringVector>& dictionary,
+                                       const std::shared_ptr<const BaseCompressedVector>& attribute_vector,
+                                       const ValueID null_value_id);
+
+  // returns the dictionary as pmr_vector, which decodes all of its strings
+  std::shared_ptr<const pmr_vector<std::string>> dictionary() const;
+
+  // returns an underlying dictionary
+  std::shared_ptr<const FrontCodedStringVector> front_coded_dictionary() const;
+
+  // Returns the value at a certain position or std::nullopt if it is NULL. Unlike operator[], this is typed and
+  // does not go through an AllTypeVariant.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  /**
+   * @defgroup BaseColumn interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedColumn interface
+   * @{
+   */
+  CompressedVectorType compressed_vector_type() const final;
+  /**@}*/
+
+  /**
+   * @defgroup BaseDictionaryColumn interface
+   * @{
+   */
+  EncodingType encoding_type() const final;
+
+  ValueID lower_bound(const AllTypeVariant& value) const final;
+  ValueID upper_bound(const AllTypeVariant& value) const final;
+
+  size_t unique_values_count() const final;
+
+  std::shared_ptr<const BaseCompressedVector> attribute_vector() const final;
+
+  const ValueID null_value_id() const final;
+
+  /**@}*/
+
+ protected:
+  const std::shared_ptr<const FrontCodedStringVector> _dictionary;
+  const std::shared_ptr<const BaseCompressedVector> _attribute_vector;
+  const ValueID _null_value_id;
+  const std::unique_ptr<BaseVectorDecompressor> _decoder;
+};
+
+}  // namespace opossum
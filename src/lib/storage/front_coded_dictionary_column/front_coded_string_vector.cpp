@@ -0,0 +1,173 @@
+#include "front_coded_string_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+void append_length(pmr_vector<char>& chars, size_t length) {
+  while (length >= 0x80u) {
+    chars.push_back(static_cast<char>((length & 0x7Fu) | 0x80u));
+    length >>= 7u;
+  }
+  chars.push_back(static_cast<char>(length));
+}
+
+size_t read_length(const char*& position) {
+  auto length = size_t{0u};
+  for (auto shift = 0u;; shift += 7u) {
+    const auto byte = static_cast<uint8_t>(*position++);
+    length |= static_cast<size_t>(byte & 0x7Fu) << shift;
+    if (byte < 0x80u) return length;
+  }
+}
+
+size_t common_prefix_length(const std::string& lhs, const std::string& rhs) {
+  const auto max_length = std::min(lhs.size(), rhs.size());
+  const auto mismatch = std::mismatch(lhs.cbegin(), lhs.cbegin() + max_length, rhs.cbegin());
+  return static_cast<size_t>(std::distance(lhs.cbegin(), mismatch.first));
+}
+
+}  // namespace
+
+FrontCodedStringVector::FrontCodedStringVector(const pmr_vector<std::string>& strings)
+    : _size{strings.size()}, _chars{strings.get_allocator()}, _block_offsets{strings.get_allocator()} {
+  _block_offsets.reserve((_size + block_size - 1u) / block_size);
+
+  for (auto pos = size_t{0u}; pos < _size; ++pos) {
+    const auto& string = strings[pos];
+
+    if (pos % block_size == 0u) {
+      _block_offsets.push_back(static_cast<uint32_t>(_chars.size()));
+      append_length(_chars, string.size());
+      _chars.insert(_chars.end(), string.cbegin(), string.cend());
+      continue;
+    }
+
+    const auto& previous_string = strings[pos - 1u];
+    DebugAssert(previous_string < string, "Strings need to be sorted and unique.");
+
+    const auto prefix_length = common_prefix_length(previous_string, string);
+    append_length(_chars, prefix_length);
+    append_length(_chars, string.size() - prefix_length);
+    _chars.insert(_chars.end(), string.cbegin() + prefix_length, string.cend());
+  }
+
+  Assert(_chars.size() <= std::numeric_limits<uint32_t>::max(), "FrontCodedStringVector can hold up to 4 GB.");
+  _chars.shrink_to_fit();
+}
+
+FrontCodedStringVector::FrontCodedStringVector(const FrontCodedStringVector& other,
+                                               const PolymorphicAllocator<size_t>& alloc)
+    : _size{other._size}, _chars{other._chars, alloc}, _block_offsets{other._block_offsets, alloc} {}
+
+std::string FrontCodedStringVector::get_string_at(const size_t pos) const {
+  DebugAssert(pos < _size, "Position out of range.");
+
+  const auto block_index = pos / block_size;
+
+  auto string = std::string{};
+  auto entry = _chars.data() + _block_offsets[block_index];
+  for (auto index = block_index * block_size; index <= pos; ++index) {
+    entry = _decode_entry(entry, index % block_size == 0u, string);
+  }
+
+  return string;
+}
+
+size_t FrontCodedStringVector::lower_bound(const std::string& value) const {
+  const auto value_view = std::string_view{value};
+  return _partition_point([&](const std::string_view string) { return string < value_view; });
+}
+
+size_t FrontCodedStringVector::upper_bound(const std::string& value) const {
+  const auto value_view = std::string_view{value};
+  return _partition_point([&](const std::string_view string) { return string <= value_view; });
+}
+
+std::pair<size_t, size_t> FrontCodedStringVector::prefix_range(const std::string& prefix) const {
+  const auto prefix_view = std::string_view{prefix};
+
+  // The strings starting with prefix follow all strings that are smaller and precede all strings whose beginning is
+  // larger than prefix
+  const auto first = lower_bound(prefix);
+  const auto last = _partition_point(
+      [&](const std::string_view string) { return string.substr(0u, prefix_view.size()) <= prefix_view; });
+
+  return {first, last};
+}
+
+size_t FrontCodedStringVector::size() const { return _size; }
+
+size_t FrontCodedStringVector::data_size() const {
+  return sizeof(*this) + _chars.size() + _block_offsets.size() * sizeof(uint32_t);
+}
+
+std::shared_ptr<const pmr_vector<std::string>> FrontCodedStringVector::dictionary() const {
+  auto strings = pmr_vector<std::string>{};
+  strings.reserve(_size);
+  for_each([&](const std::string& string) { strings.push_back(string); });
+
+  return std::make_shared<pmr_vector<std::string>>(std::move(strings));
+}
+
+const char* FrontCodedStringVector::_decode_entry(const char* entry, const bool is_head, std::string& string) {
+  if (is_head) {
+    const auto length = read_length(entry);
+    string.assign(entry, length);
+    return entry + length;
+  }
+
+  const auto prefix_length = read_length(entry);
+  const auto suffix_length = read_length(entry);
+  string.resize(prefix_length);
+  string.append(entry, suffix_length);
+  return entry + suffix_length;
+}
+
+std::string_view FrontCodedStringVector::_head(const size_t block_index) const {
+  auto entry = _chars.data() + _block_offsets[block_index];
+  const auto length = read_length(entry);
+  return std::string_view{entry, length};
+}
+
+template <typename Predicate>
+size_t FrontCodedStringVector::_partition_point(const Predicate& predicate) const {
+  // Find the first block whose head does not satisfy predicate
+  auto first_block = size_t{0u};
+  auto last_block = _block_offsets.size();
+  while (first_block < last_block) {
+    const auto middle_block = first_block + (last_block - first_block) / 2u;
+    if (predicate(_head(middle_block))) {
+      first_block = middle_block + 1u;
+    } else {
+      last_block = middle_block;
+    }
+  }
+
+  if (first_block == 0u) return 0u;
+
+  // The head of the previous block satisfies predicate, so the partition point lies within that block or right
+  // after it. Only the strings of that block are decoded.
+  const auto block_index = first_block - 1u;
+  const auto block_begin = block_index * block_size;
+  const auto block_end = std::min(block_begin + block_size, _size);
+
+  auto string = std::string{};
+  auto entry = _decode_entry(_chars.data() + _block_offsets[block_index], true, string);
+  for (auto pos = block_begin + 1u; pos < block_end; ++pos) {
+    entry = _decode_entry(entry, false, string);
+    if (!predicate(std::string_view{string})) return pos;
+  }
+
+  return block_end;
+}
+
+}  // namespace opossum
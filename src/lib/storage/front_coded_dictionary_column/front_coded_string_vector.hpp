@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * FrontCodedStringVector stores sorted, unique strings using front coding (also known as incremental encoding).
+ *
+ * The strings are grouped into blocks of block_size strings. The first string of a block, its head, is stored
+ * completely. Every other string only stores the length of the prefix it shares with its predecessor and the
+ * remaining suffix. Sorted strings with long common prefixes, such as URLs, thus take up only a fraction of their
+ * original size, and no std::string object is needed per string. All lengths are stored as variable-length integers
+ * with seven bits per byte.
+ *
+ * Searches work on the encoded strings: lower_bound() and upper_bound() binary search over the heads, which are
+ * compared in place, and decode the strings of a single block only.
+ */
+class FrontCodedStringVector {
+ public:
+  static constexpr auto block_size = size_t{16u};
+
+  // Front codes strings, which need to be sorted and unique, using their allocator
+  explicit FrontCodedStringVector(const pmr_vector<std::string>& strings);
+
+  FrontCodedStringVector(const FrontCodedStringVector& other, const PolymorphicAllocator<size_t>& alloc);
+
+  // Return the string at a certain position. This decodes up to block_size strings.
+  std::string get_string_at(const size_t pos) const;
+
+  // Return the position of the first string >= value (or > value, respectively) or size() if there is none
+  size_t lower_bound(const std::string& value) const;
+  size_t upper_bound(const std::string& value) const;
+
+  // Return the positions [first, last) of the strings that start with prefix
+  std::pair<size_t, size_t> prefix_range(const std::string& prefix) const;
+
+  // Call functor with each string in ascending order. Unlike get_string_at(), each string is decoded only once.
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    auto string = std::string{};
+    auto entry = _chars.data();
+    for (auto pos = size_t{0u}; pos < _size; ++pos) {
+      entry = _decode_entry(entry, pos % block_size == 0u, string);
+      functor(static_cast<const std::string&>(string));
+    }
+  }
+
+  // Return the number of strings
+  size_t size() const;
+
+  // Return the calculated size of FrontCodedStringVector in main memory
+  size_t data_size() const;
+
+  // Return the decoded strings as a vector of strings
+  std::shared_ptr<const pmr_vector<std::string>> dictionary() const;
+
+ private:
+  // Decode the entry starting at entry into string, which needs to hold the previous string unless the entry is the
+  // head of a block. Returns the beginning of the next entry.
+  static const char* _decode_entry(const char* entry, const bool is_head, std::string& string);
+
+  std::string_view _head(const size_t block_index) const;
+
+  // Return the position of the first string for which predicate is false. Predicate needs to be true for all strings
+  // before that position and false for all strings after it.
+  template <typename Predicate>
+  size_t _partition_point(const Predicate& predicate) const;
+
+  const size_t _size;
+  pmr_vector<char> _chars;
+
+  // The position of each block's head in _chars
+  pmr_vector<uint32_t> _block_offsets;
+};
+
+}  // namespace opossum
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <optional>
 
 #include "resolve_type.hpp"
 #include "storage/base_column.hpp"
+#include "storage/base_value_column.hpp"
 #include "storage/create_iterable_from_column.hpp"
 
 namespace opossum {
@@ -43,6 +45,26 @@ void materialize_values_and_nulls(const BaseColumn& column, Container& container
 // Materialize the nulls in the Column
 template <typename ColumnValueType, typename Container>
 void materialize_nulls(const BaseColumn& column, Container& container) {
+  // The null values of value columns are copied word by word, words without nulls are skipped
+  if (const auto value_column = dynamic_cast<const BaseValueColumn*>(&column)) {
+    DebugAssert(container.empty(), "Trying to materialize into a non-empty container");
+    container.resize(value_column->size(), false);
+    if (!value_column->contains_nulls()) return;
+
+    const auto& null_values = value_column->null_values();
+    const auto size = std::min(container.size(), null_values.size());
+    for (auto word_begin = size_t{0}; word_begin < size; word_begin += NullValueVector::BITS_PER_WORD) {
+      const auto word = null_values.word(word_begin / NullValueVector::BITS_PER_WORD);
+      if (word == 0u) continue;
+
+      const auto word_end = std::min(word_begin + NullValueVector::BITS_PER_WORD, size);
+      for (auto index = word_begin; index < word_end; ++index) {
+        container[index] = (word >> (index - word_begin)) & 1u;
+      }
+    }
+    return;
+  }
+
   resolve_column_type<ColumnValueType>(column, [&](const auto& column) {
     create_iterable_from_column<ColumnValueType>(column).materialize_nulls(container);
   });
@@ -1,5 +1,7 @@
 #include "mvcc_columns.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <shared_mutex>
 
 #include "utils/assert.hpp"
@@ -8,32 +10,206 @@ namespace opossum {
 
 MvccColumns::MvccColumns(const size_t size) { grow_by(size, 0); }
 
+MvccColumns::~MvccColumns() { delete[] _compact_tids.load(); }
+
 size_t MvccColumns::size() const { return _size; }
 
+bool MvccColumns::is_compact() const { return _is_compact; }
+
+TransactionID MvccColumns::tid(ChunkOffset chunk_offset) const {
+  if (!_is_compact) return tids[chunk_offset];
+
+  const auto compact_tids = _compact_tids.load();
+  return compact_tids ? compact_tids[chunk_offset].load() : TransactionID{0};
+}
+
+void MvccColumns::set_tid(ChunkOffset chunk_offset, TransactionID tid) {
+  if (!_is_compact) {
+    tids[chunk_offset] = tid;
+    return;
+  }
+
+  // Unlocking a row does not require the TIDs to be allocated
+  if (tid == 0 && !_compact_tids.load()) return;
+  _get_or_allocate_compact_tids()[chunk_offset] = tid;
+}
+
+bool MvccColumns::compare_exchange_tid(ChunkOffset chunk_offset, TransactionID expected, TransactionID desired) {
+  if (!_is_compact) return tids[chunk_offset].compare_exchange_strong(expected, desired);
+
+  return _get_or_allocate_compact_tids()[chunk_offset].compare_exchange_strong(expected, desired);
+}
+
+CommitID MvccColumns::begin_cid(ChunkOffset chunk_offset) const {
+  return _is_compact ? _compact_begin_cid : begin_cids[chunk_offset];
+}
+
+void MvccColumns::set_begin_cid(ChunkOffset chunk_offset, CommitID begin_cid) {
+  DebugAssert(!_is_compact, "Rows of compact MVCC columns have already been committed");
+  begin_cids[chunk_offset] = begin_cid;
+}
+
+CommitID MvccColumns::end_cid(ChunkOffset chunk_offset) const {
+  if (!_is_compact) return end_cids[chunk_offset];
+
+  const auto iter = _compact_end_cids.find(chunk_offset);
+  return iter != _compact_end_cids.end() ? iter->second : MAX_COMMIT_ID;
+}
+
+void MvccColumns::set_end_cid(ChunkOffset chunk_offset, CommitID end_cid) {
+  // Insert and Delete have already counted the row via on_insert_rolled_back() or on_delete_locked(). Counting it
+  // again only keeps the summary conservative for callers that did not.
+  if (end_cid != MAX_COMMIT_ID) ++_invalidated_row_count;
+
+  if (!_is_compact) {
+    end_cids[chunk_offset] = end_cid;
+    return;
+  }
+
+  // Rows are only deleted once (they stay locked after the Delete committed), so entries are never overwritten
+  [[maybe_unused]] const auto inserted = _compact_end_cids.emplace(chunk_offset, end_cid).second;
+  DebugAssert(inserted, "End CID was already set");
+}
+
 void MvccColumns::shrink() {
+  if (_is_compact) return;
+
+  tids.shrink_to_fit();
+  begin_cids.shrink_to_fit();
+  end_cids.shrink_to_fit();
+}
+
+void MvccColumns::compact() {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  if (_is_compact) return;
+
+  const auto first_begin_cid = _size > 0 ? begin_cids[0] : MAX_COMMIT_ID;
+  const auto all_begin_cids_equal = std::all_of(begin_cids.begin(), begin_cids.end(),
+                                                [&](const auto begin_cid) { return begin_cid == first_begin_cid; });
+  if (first_begin_cid == MAX_COMMIT_ID || !all_begin_cids_equal) {
+    shrink();
+    return;
+  }
+
+  _compact_begin_cid = first_begin_cid;
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    if (end_cids[chunk_offset] != MAX_COMMIT_ID) _compact_end_cids.emplace(chunk_offset, end_cids[chunk_offset]);
+  }
+
+  // Rows stay locked after they were deleted, so the TIDs have to be kept if any row was locked
+  const auto any_row_locked = std::any_of(tids.begin(), tids.end(), [](const auto& tid) { return tid != 0u; });
+  if (any_row_locked) {
+    const auto compact_tids = _get_or_allocate_compact_tids();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+      compact_tids[chunk_offset] = tids[chunk_offset].load();
+    }
+  }
+
+  tids.clear();
   tids.shrink_to_fit();
+  begin_cids.clear();
   begin_cids.shrink_to_fit();
+  end_cids.clear();
   end_cids.shrink_to_fit();
+
+  _is_compact = true;
 }
 
 void MvccColumns::grow_by(size_t delta, CommitID begin_cid) {
+  DebugAssert(!_is_compact, "Compact MVCC columns cannot grow");
+
+  // The summary is updated before the rows exist, so that it never claims that rows are visible that are not
+  if (begin_cid == MAX_COMMIT_ID) {
+    _uncommitted_row_count += delta;
+  } else {
+    _raise_max_begin_cid(begin_cid);
+  }
+
   _size += delta;
   tids.grow_to_at_least(_size);
   begin_cids.grow_to_at_least(_size, begin_cid);
   end_cids.grow_to_at_least(_size, MAX_COMMIT_ID);
 }
 
+bool MvccColumns::all_rows_visible(CommitID snapshot_commit_id) const {
+  // _uncommitted_row_count needs to be read first: on_insert_committed() raises _max_begin_cid before it decrements it
+  return _uncommitted_row_count == 0 && _invalidated_row_count == 0 && _max_begin_cid <= snapshot_commit_id;
+}
+
+void MvccColumns::on_insert_committed(CommitID begin_cid) {
+  _raise_max_begin_cid(begin_cid);
+  --_uncommitted_row_count;
+}
+
+void MvccColumns::on_insert_rolled_back() {
+  // Rolled back rows are invisible to everyone
+  ++_invalidated_row_count;
+  --_uncommitted_row_count;
+}
+
+void MvccColumns::on_delete_locked() { ++_invalidated_row_count; }
+
+void MvccColumns::on_delete_unlocked() { --_invalidated_row_count; }
+
+void MvccColumns::_raise_max_begin_cid(CommitID begin_cid) {
+  auto max_begin_cid = _max_begin_cid.load();
+  while (max_begin_cid < begin_cid && !_max_begin_cid.compare_exchange_weak(max_begin_cid, begin_cid)) {
+  }
+}
+
+std::atomic<TransactionID>* MvccColumns::_get_or_allocate_compact_tids() {
+  auto compact_tids = _compact_tids.load();
+  if (compact_tids) return compact_tids;
+
+  auto allocated_tids = new std::atomic<TransactionID>[_size];
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    allocated_tids[chunk_offset] = 0u;
+  }
+
+  // Another thread might have allocated the TIDs in the meantime
+  if (!_compact_tids.compare_exchange_strong(compact_tids, allocated_tids)) {
+    delete[] allocated_tids;
+    return compact_tids;
+  }
+
+  return allocated_tids;
+}
+
+size_t MvccColumns::estimate_memory_usage() const {
+  auto bytes = sizeof(*this);
+
+  if (!_is_compact) {
+    bytes += tids.size() * sizeof(decltype(tids)::value_type);
+    bytes += begin_cids.size() * sizeof(decltype(begin_cids)::value_type);
+    bytes += end_cids.size() * sizeof(decltype(end_cids)::value_type);
+    return bytes;
+  }
+
+  // Each entry of the map is a list node with the value and two pointers
+  bytes += _compact_end_cids.size() * (sizeof(decltype(_compact_end_cids)::value_type) + 2 * sizeof(void*));
+  if (_compact_tids.load()) bytes += _size * sizeof(std::atomic<TransactionID>);
+
+  return bytes;
+}
+
 void MvccColumns::print(std::ostream& stream) const {
   stream << "TIDs: ";
-  for (const auto& tid : tids) stream << tid << ", ";
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    stream << tid(chunk_offset) << ", ";
+  }
   stream << std::endl;
 
   stream << "BeginCIDs: ";
-  for (const auto& begin_cid : begin_cids) stream << begin_cid << ", ";
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    stream << begin_cid(chunk_offset) << ", ";
+  }
   stream << std::endl;
 
   stream << "EndCIDs: ";
-  for (const auto& end_cid : end_cids) stream << end_cid << ", ";
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    stream << end_cid(chunk_offset) << ", ";
+  }
   stream << std::endl;
 }
 
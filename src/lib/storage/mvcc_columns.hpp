@@ -1,8 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
 
+#include "tbb/concurrent_unordered_map.h"
+
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
 
@@ -11,6 +14,15 @@ namespace opossum {
 /**
  * Columns storing visibility information
  * for multiversion concurrency control
+ *
+ * There are two representations:
+ *  - Dense: tids, begin_cids and end_cids store one entry per row. This is what mutable chunks use.
+ *  - Compact: Used for immutable chunks in which all rows were committed by the same transaction, e.g., bulk-loaded
+ *    chunks (see compact()). A single begin CID is stored for the entire chunk, the end CIDs of deleted rows are kept
+ *    in a sparse map, and the TIDs are only allocated once the first row is locked by a Delete.
+ *
+ * The tid(), begin_cid() and end_cid() accessors (and their setters) work with both representations. The vectors
+ * are only filled in the dense representation.
  */
 struct MvccColumns {
   friend class Chunk;
@@ -24,9 +36,23 @@ struct MvccColumns {
   pmr_concurrent_vector<CommitID> end_cids;                    ///< commit id when record was deleted
 
   explicit MvccColumns(const size_t size);
+  ~MvccColumns();
 
   size_t size() const;
 
+  bool is_compact() const;
+
+  TransactionID tid(ChunkOffset chunk_offset) const;
+  void set_tid(ChunkOffset chunk_offset, TransactionID tid);
+  bool compare_exchange_tid(ChunkOffset chunk_offset, TransactionID expected, TransactionID desired);
+
+  CommitID begin_cid(ChunkOffset chunk_offset) const;
+  void set_begin_cid(ChunkOffset chunk_offset, CommitID begin_cid);
+
+  CommitID end_cid(ChunkOffset chunk_offset) const;
+  // Also marks the row as invalidated in the visibility summary, see all_rows_visible()
+  void set_end_cid(ChunkOffset chunk_offset, CommitID end_cid);
+
   /**
    * Compacts the internal representation of
    * the mvcc columns in order to reduce fragmentation
@@ -34,6 +60,13 @@ struct MvccColumns {
    */
   void shrink();
 
+  /**
+   * Switches to the compact representation if all rows share the same begin CID. Otherwise, shrink()s the dense
+   * representation. Meant for chunks that have become immutable, as rows cannot be added to compact MVCC columns.
+   * Locks the mvcc columns exclusively, so it must not be called through get_scoped_mvcc_columns_lock().
+   */
+  void compact();
+
   /**
    * Grows all mvcc columns by the given delta
    *
@@ -41,6 +74,27 @@ struct MvccColumns {
    */
   void grow_by(size_t delta, CommitID begin_cid);
 
+  /**
+   * @return true if every row is visible to all transactions with the given snapshot commit id, i.e., all rows were
+   *         committed no later than the snapshot and none has been (or is being) deleted. Validate uses this to skip
+   *         the per-row visibility checks. Does not require the MVCC columns to be locked.
+   *
+   * The summary is only updated by set_end_cid() and the on_...() callbacks below, not by writes to tids, begin_cids
+   * or end_cids. A chunk created via MvccColumns(size) starts out with all rows visible, so end CIDs must be set
+   * through set_end_cid() - writing end_cids directly would let Validate skip the deleted rows.
+   */
+  bool all_rows_visible(CommitID snapshot_commit_id) const;
+
+  /**
+   * Called by Insert and Delete to keep the visibility summary up to date
+   */
+  void on_insert_committed(CommitID begin_cid);
+  void on_insert_rolled_back();
+  void on_delete_locked();
+  void on_delete_unlocked();
+
+  size_t estimate_memory_usage() const;
+
   void print(std::ostream& stream = std::cout) const;
 
  private:
@@ -53,7 +107,23 @@ struct MvccColumns {
    */
   std::shared_mutex _mutex;
 
+  void _raise_max_begin_cid(CommitID begin_cid);
+
   size_t _size{0};
+
+  // Compact representation, see class comment. _compact_tids points to an array of _size TIDs once it is allocated.
+  bool _is_compact{false};
+  CommitID _compact_begin_cid{0};
+  tbb::concurrent_unordered_map<ChunkOffset, CommitID> _compact_end_cids;
+  std::atomic<std::atomic<TransactionID>*> _compact_tids{nullptr};
+
+  // Returns _compact_tids, allocating it first if necessary
+  std::atomic<TransactionID>* _get_or_allocate_compact_tids();
+
+  // Visibility summary, see all_rows_visible()
+  std::atomic<CommitID> _max_begin_cid{0};
+  std::atomic<size_t> _uncommitted_row_count{0};
+  std::atomic<size_t> _invalidated_row_count{0};
 };
 
 }  // namespace opossum
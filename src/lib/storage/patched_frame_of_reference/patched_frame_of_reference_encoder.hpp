@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/base_column_encoder.hpp"
+
+#include "storage/patched_frame_of_reference_column.hpp"
+#include "storage/value_column.hpp"
+#include "storage/value_column/value_column_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class PatchedFrameOfReferenceEncoder : public ColumnEncoder<PatchedFrameOfReferenceEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::PatchedFrameOfReference>;
+  static constexpr auto _uses_vector_compression = true;  // see base_column_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedColumn> _on_encode(const std::shared_ptr<const ValueColumn<T>>& value_column) {
+    const auto alloc = value_column->with_values([](const auto& values) { return values.get_allocator(); });
+
+    static constexpr auto block_size = PatchedFrameOfReferenceColumn<T>::block_size;
+
+    const auto size = value_column->size();
+
+    // holds the reference of each block
+    auto block_references = pmr_vector<T>{alloc};
+    block_references.reserve((size + block_size - 1u) / block_size);
+
+    // holds the uncompressed offset values
+    auto offset_values = pmr_vector<uint32_t>{alloc};
+    offset_values.reserve(size);
+
+    // holds whether a column value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    auto exception_offsets = pmr_vector<ChunkOffset>{alloc};
+    auto exception_values = pmr_vector<T>{alloc};
+
+    // used as optional input for the compression of the offset values
+    auto max_offset = uint32_t{0u};
+
+    auto iterable = ValueColumnIterable<T>{*value_column};
+    iterable.with_iterators([&](auto column_it, auto column_end) {
+      // a temporary storage to hold the values of one block
+      auto current_value_block = std::array<T, block_size>{};
+      auto current_null_block = std::array<bool, block_size>{};
+      auto sorted_values = std::vector<T>{};
+      sorted_values.reserve(block_size);
+
+      auto block_begin = ChunkOffset{0u};
+      while (column_it != column_end) {
+        auto block_row_count = size_t{0u};
+        for (; block_row_count < block_size && column_it != column_end; ++block_row_count, ++column_it) {
+          const auto column_value = *column_it;
+
+          current_value_block[block_row_count] = column_value.is_null() ? T{0u} : column_value.value();
+          current_null_block[block_row_count] = column_value.is_null();
+          null_values.push_back(column_value.is_null());
+        }
+
+        sorted_values.clear();
+        for (auto index = size_t{0u}; index < block_row_count; ++index) {
+          if (!current_null_block[index]) sorted_values.push_back(current_value_block[index]);
+        }
+        std::sort(sorted_values.begin(), sorted_values.end());
+
+        const auto [reference, max_range] = _choose_frame(sorted_values, block_row_count);
+        block_references.push_back(reference);
+
+        for (auto index = size_t{0u}; index < block_row_count; ++index) {
+          using UnsignedT = std::make_unsigned_t<T>;
+          const auto value = current_value_block[index];
+          const auto offset = static_cast<UnsignedT>(value) - static_cast<UnsignedT>(reference);
+
+          // NULLs are stored as offset 0
+          if (current_null_block[index] || (value >= reference && offset <= max_range)) {
+            offset_values.push_back(current_null_block[index] ? 0u : static_cast<uint32_t>(offset));
+            max_offset = std::max(max_offset, offset_values.back());
+          } else {
+            offset_values.push_back(0u);
+            exception_offsets.push_back(static_cast<ChunkOffset>(block_begin + index));
+            exception_values.push_back(value);
+          }
+        }
+
+        block_begin += block_row_count;
+      }
+    });
+
+    auto encoded_offset_values = compress_vector(offset_values, vector_compression_type(), alloc, {max_offset});
+
+    return std::allocate_shared<PatchedFrameOfReferenceColumn<T>>(
+        alloc, std::move(block_references), std::move(null_values), std::move(encoded_offset_values),
+        std::move(exception_offsets), std::move(exception_values));
+  }
+
+ private:
+  /**
+   * Chooses the frame, i.e., the reference and the largest offset, of a block. For each bit width, the frame that
+   * covers the most values is found with a sliding window over the sorted values. The bit width with the smallest
+   * estimated size (offsets plus exceptions) wins.
+   *
+   * @param sorted_values the non-NULL values of the block in ascending order
+   * @return the reference and the largest offset that is not an exception
+   */
+  template <typename T>
+  static std::pair<T, uint32_t> _choose_frame(const std::vector<T>& sorted_values, const size_t block_row_count) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    static constexpr auto exception_size_in_bits = (sizeof(ChunkOffset) + sizeof(T)) * 8u;
+
+    if (sorted_values.empty()) return {T{0}, 0u};
+
+    auto best_reference = sorted_values.front();
+    auto best_max_range = uint32_t{0u};
+    auto best_size_in_bits = std::numeric_limits<size_t>::max();
+
+    for (auto bit_width = size_t{0u}; bit_width <= 32u; ++bit_width) {
+      const auto max_range = static_cast<uint32_t>((uint64_t{1u} << bit_width) - 1u);
+
+      // Find the window [sorted_values[begin], sorted_values[begin] + max_range] that covers the most values
+      auto covered_count = size_t{0u};
+      auto covering_begin = size_t{0u};
+      for (auto begin = size_t{0u}, end = size_t{0u}; begin < sorted_values.size(); ++begin) {
+        end = std::max(end, begin);
+        while (end < sorted_values.size() &&
+               static_cast<UnsignedT>(sorted_values[end]) - static_cast<UnsignedT>(sorted_values[begin]) <= max_range) {
+          ++end;
+        }
+
+        if (end - begin > covered_count) {
+          covered_count = end - begin;
+          covering_begin = begin;
+        }
+      }
+
+      const auto size_in_bits =
+          block_row_count * bit_width + (sorted_values.size() - covered_count) * exception_size_in_bits;
+      if (size_in_bits < best_size_in_bits) {
+        best_reference = sorted_values[covering_begin];
+        best_max_range = max_range;
+        best_size_in_bits = size_in_bits;
+      }
+
+      // Wider frames cannot cover more values
+      if (covered_count == sorted_values.size()) break;
+    }
+
+    return {best_reference, best_max_range};
+  }
+};
+
+}  // namespace opossum
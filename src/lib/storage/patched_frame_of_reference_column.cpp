@@ -0,0 +1,113 @@
+#include "patched_frame_of_reference_column.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+PatchedFrameOfReferenceColumn<T, U>::PatchedFrameOfReferenceColumn(
+    pmr_vector<T> block_references, pmr_vector<bool> null_values,
+    std::unique_ptr<const BaseCompressedVector> offset_values, pmr_vector<ChunkOffset> exception_offsets,
+    pmr_vector<T> exception_values)
+    : BaseEncodedColumn{data_type_from_type<T>()},
+      _block_references{std::move(block_references)},
+      _null_values{std::move(null_values)},
+      _offset_values{std::move(offset_values)},
+      _exception_offsets{std::move(exception_offsets)},
+      _exception_values{std::move(exception_values)},
+      _decoder{_offset_values->create_base_decoder()} {
+  DebugAssert(_exception_offsets.size() == _exception_values.size(), "Each exception needs an offset and a value.");
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& PatchedFrameOfReferenceColumn<T, U>::block_references() const {
+  return _block_references;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& PatchedFrameOfReferenceColumn<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& PatchedFrameOfReferenceColumn<T, U>::offset_values() const {
+  return *_offset_values;
+}
+
+template <typename T, typename U>
+const pmr_vector<ChunkOffset>& PatchedFrameOfReferenceColumn<T, U>::exception_offsets() const {
+  return _exception_offsets;
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& PatchedFrameOfReferenceColumn<T, U>::exception_values() const {
+  return _exception_values;
+}
+
+template <typename T, typename U>
+const AllTypeVariant PatchedFrameOfReferenceColumn<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+
+  return *typed_value;
+}
+
+template <typename T, typename U>
+std::optional<T> PatchedFrameOfReferenceColumn<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  return decode_value(_block_references, *_decoder, _exception_offsets, _exception_values, chunk_offset);
+}
+
+template <typename T, typename U>
+size_t PatchedFrameOfReferenceColumn<T, U>::size() const {
+  return _offset_values->size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseColumn> PatchedFrameOfReferenceColumn<T, U>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_block_references = pmr_vector<T>{_block_references, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+  auto new_offset_values = _offset_values->copy_using_allocator(alloc);
+  auto new_exception_offsets = pmr_vector<ChunkOffset>{_exception_offsets, alloc};
+  auto new_exception_values = pmr_vector<T>{_exception_values, alloc};
+
+  return std::allocate_shared<PatchedFrameOfReferenceColumn>(
+      alloc, std::move(new_block_references), std::move(new_null_values), std::move(new_offset_values),
+      std::move(new_exception_offsets), std::move(new_exception_values));
+}
+
+template <typename T, typename U>
+size_t PatchedFrameOfReferenceColumn<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + sizeof(T) * _block_references.size() + _offset_values->data_size() +
+         _null_values.size() / bits_per_byte + (sizeof(ChunkOffset) + sizeof(T)) * _exception_offsets.size();
+}
+
+template <typename T, typename U>
+EncodingType PatchedFrameOfReferenceColumn<T, U>::encoding_type() const {
+  return EncodingType::PatchedFrameOfReference;
+}
+
+template <typename T, typename U>
+CompressedVectorType PatchedFrameOfReferenceColumn<T, U>::compressed_vector_type() const {
+  return _offset_values->type();
+}
+
+template class PatchedFrameOfReferenceColumn<int32_t>;
+template class PatchedFrameOfReferenceColumn<int64_t>;
+
+}  // namespace opossum
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+
+#include "base_encoded_column.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Column implementing patched frame-of-reference (PFOR) encoding
+ *
+ * Like FrameOfReferenceColumn, the column is divided into fixed-size blocks
+ * and the values of each block are stored as offsets from a per-block
+ * reference value. In FrameOfReference, a single outlier determines the
+ * range of the whole block and thus the bit width needed for the offsets.
+ * PFOR instead chooses the reference and the range per block such that the
+ * estimated size is minimal. Values outside of the range are stored as
+ * exceptions (“patches”) with their chunk offset, and their offset is set
+ * to zero. Thus, the value range of a block does not need to fit into
+ * uint32_t.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(
+                          enum_c<EncodingType, EncodingType::PatchedFrameOfReference>, hana::type_c<T>)>>
+class PatchedFrameOfReferenceColumn : public BaseEncodedColumn {
+ public:
+  static constexpr auto block_size = 2048u;
+
+  explicit PatchedFrameOfReferenceColumn(pmr_vector<T> block_references, pmr_vector<bool> null_values,
+                                         std::unique_ptr<const BaseCompressedVector> offset_values,
+                                         pmr_vector<ChunkOffset> exception_offsets, pmr_vector<T> exception_values);
+
+  const pmr_vector<T>& block_references() const;
+  const pmr_vector<bool>& null_values() const;
+  const BaseCompressedVector& offset_values() const;
+
+  // The chunk offsets of the exceptions in ascending order and their values
+  const pmr_vector<ChunkOffset>& exception_offsets() const;
+  const pmr_vector<T>& exception_values() const;
+
+  // Returns the value at a certain position or std::nullopt if it is NULL. Unlike operator[], this is typed and
+  // does not go through an AllTypeVariant.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Decodes the value at chunk_offset using the passed decompressor, regardless of whether it is NULL
+  template <typename OffsetValueDecompressorT>
+  static T decode_value(const pmr_vector<T>& block_references, OffsetValueDecompressorT& decompressor,
+                        const pmr_vector<ChunkOffset>& exception_offsets, const pmr_vector<T>& exception_values,
+                        const ChunkOffset chunk_offset) {
+    const auto exception_it = std::lower_bound(exception_offsets.cbegin(), exception_offsets.cend(), chunk_offset);
+    if (exception_it != exception_offsets.cend() && *exception_it == chunk_offset) {
+      return exception_values[std::distance(exception_offsets.cbegin(), exception_it)];
+    }
+
+    return apply_offset(block_references[chunk_offset / block_size], decompressor.get(chunk_offset));
+  }
+
+  // Adds the offset to the reference. The computation uses unsigned arithmetic, as the sum fits into T, but the
+  // offset might not.
+  static T apply_offset(const T reference, const uint32_t offset) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<UnsignedT>(reference) + static_cast<UnsignedT>(offset));
+  }
+
+  /**
+   * @defgroup BaseColumn interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedColumn interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  CompressedVectorType compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<T> _block_references;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  const pmr_vector<ChunkOffset> _exception_offsets;
+  const pmr_vector<T> _exception_values;
+  std::unique_ptr<BaseVectorDecompressor> _decoder;
+};
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#include "pos_list.hpp"
+
+#include <unordered_set>
+#include <utility>
+
+namespace opossum {
+
+void PosList::_materialize_chunk_range() {
+  Vector::resize(_range_size);
+  for (auto index = ChunkOffset{0}; index < _range_size; ++index) {
+    Vector::operator[](index) = std::as_const(*this)[index];
+  }
+
+  _is_chunk_range = false;
+  _range_begin = NULL_ROW_ID;
+  _range_size = 0u;
+}
+
+bool PosList::_all_rows_reference_one_chunk() const {
+  for (const auto row_id : *this) {
+    if (row_id.is_null() || row_id.chunk_id != front().chunk_id) return false;
+  }
+  return true;
+}
+
+bool PosList::_rows_are_grouped_by_chunk() const {
+  // Each chunk may only be referenced by a single run of positions, NULLs do not interrupt a run
+  auto finished_chunk_ids = std::unordered_set<ChunkID>{};
+  auto previous_chunk_id = INVALID_CHUNK_ID;
+  for (const auto row_id : *this) {
+    if (row_id.is_null() || row_id.chunk_id == previous_chunk_id) continue;
+
+    finished_chunk_ids.emplace(previous_chunk_id);
+    if (finished_chunk_ids.count(row_id.chunk_id)) return false;
+    previous_chunk_id = row_id.chunk_id;
+  }
+  return true;
+}
+
+}  // namespace opossum
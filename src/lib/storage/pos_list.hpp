@@ -0,0 +1,365 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * A list of RowIDs, as referenced by ReferenceColumns.
+ *
+ * Besides the RowIDs, a PosList holds guarantees that its producer can give about them. Consumers use these for fast
+ * paths, e.g., to avoid hashing the ChunkID of every position in split_pos_list_by_chunk_id().
+ *   - references_single_chunk: All RowIDs reference the same chunk, none of them is NULL (e.g., the output of
+ *                              a TableScan on a data table)
+ *   - grouped_by_chunk:        All RowIDs that reference the same chunk are adjacent, apart from NULLs in between
+ *                              (e.g., the probe side of JoinHash). Only given by operators whose output order is
+ *                              defined by their implementation anyway.
+ * The guarantees are only checked in debug builds. Adding positions (push_back(), emplace_back(), assign(),
+ * insert(), resize()) drops them. Writing to positions keeps them, so the writer has to make sure they still hold.
+ *
+ * A PosList that references a contiguous range of a single chunk can be created via PosList::chunk_range(). It does
+ * not store its RowIDs at all but computes them on access. Before it can be modified, materialize() has to store its
+ * RowIDs, after which the PosList is an ordinary one. This is explicit so that a read-only consumer does not copy a
+ * whole chunk worth of RowIDs just because it happens to hold a non-const PosList.
+ *
+ * Apart from that, a PosList offers the interface of a std::vector. As the RowIDs of a chunk range only exist on
+ * access, read-only access (i.e., via a const PosList, which is all that ReferenceColumn::pos_list() hands out)
+ * returns RowIDs by value.
+ */
+class PosList : private pmr_vector<RowID> {
+  using Vector = pmr_vector<RowID>;
+
+ public:
+  /**
+   * Iterates over the RowIDs, no matter whether they are stored or computed on access (chunk ranges). Dereferencing
+   * returns the RowID by value.
+   */
+  class ConstIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = RowID;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const RowID*;
+    using reference = RowID;
+
+    ConstIterator() = default;
+    ConstIterator(const RowID* row_ids, const RowID range_begin, const difference_type index)
+        : _row_ids{row_ids}, _range_begin{range_begin}, _index{index} {}
+
+    RowID operator*() const {
+      if (_row_ids) return _row_ids[_index];
+      return RowID{_range_begin.chunk_id, static_cast<ChunkOffset>(_range_begin.chunk_offset + _index)};
+    }
+
+    RowID operator[](const difference_type offset) const { return *(*this + offset); }
+
+    // Allows it->chunk_id etc. even though no RowID object exists for chunk ranges
+    struct ArrowProxy {
+      RowID row_id;
+      const RowID* operator->() const { return &row_id; }
+    };
+    ArrowProxy operator->() const { return ArrowProxy{**this}; }
+
+    ConstIterator& operator++() {
+      ++_index;
+      return *this;
+    }
+    ConstIterator operator++(int) {
+      auto copy = *this;
+      ++_index;
+      return copy;
+    }
+    ConstIterator& operator--() {
+      --_index;
+      return *this;
+    }
+    ConstIterator operator--(int) {
+      auto copy = *this;
+      --_index;
+      return copy;
+    }
+    ConstIterator& operator+=(const difference_type offset) {
+      _index += offset;
+      return *this;
+    }
+    ConstIterator& operator-=(const difference_type offset) {
+      _index -= offset;
+      return *this;
+    }
+    ConstIterator operator+(const difference_type offset) const {
+      return ConstIterator{_row_ids, _range_begin, _index + offset};
+    }
+    ConstIterator operator-(const difference_type offset) const {
+      return ConstIterator{_row_ids, _range_begin, _index - offset};
+    }
+    friend ConstIterator operator+(const difference_type offset, const ConstIterator& it) { return it + offset; }
+    difference_type operator-(const ConstIterator& other) const { return _index - other._index; }
+
+    bool operator==(const ConstIterator& other) const { return _index == other._index; }
+    bool operator!=(const ConstIterator& other) const { return _index != other._index; }
+    bool operator<(const ConstIterator& other) const { return _index < other._index; }
+    bool operator<=(const ConstIterator& other) const { return _index <= other._index; }
+    bool operator>(const ConstIterator& other) const { return _index > other._index; }
+    bool operator>=(const ConstIterator& other) const { return _index >= other._index; }
+
+   private:
+    const RowID* _row_ids{nullptr};  // nullptr for chunk ranges
+    RowID _range_begin{NULL_ROW_ID};
+    difference_type _index{0};
+  };
+
+  using value_type = RowID;
+  using allocator_type = Vector::allocator_type;
+  using size_type = Vector::size_type;
+  using difference_type = Vector::difference_type;
+  using reference = Vector::reference;
+  using const_reference = RowID;
+  using iterator = Vector::iterator;
+  using const_iterator = ConstIterator;
+
+  PosList() = default;
+  using Vector::Vector;
+
+  // Creates a PosList referencing the rows [begin_offset, end_offset) of the chunk without storing them
+  static PosList chunk_range(const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+    DebugAssert(begin_offset <= end_offset, "Invalid chunk range");
+
+    auto pos_list = PosList{};
+    pos_list._is_chunk_range = true;
+    pos_list._range_begin = RowID{chunk_id, begin_offset};
+    pos_list._range_size = end_offset - begin_offset;
+    pos_list._references_single_chunk = true;
+    pos_list._grouped_by_chunk = true;
+    return pos_list;
+  }
+
+  /**
+   * @defgroup Guarantees given by the producer of the PosList
+   * @{
+   */
+
+  void guarantee_single_chunk() {
+    DebugAssert(_all_rows_reference_one_chunk(), "PosList references more than one chunk or contains NULLs");
+    _references_single_chunk = true;
+    _grouped_by_chunk = true;
+  }
+
+  void guarantee_grouped_by_chunk() {
+    DebugAssert(_rows_are_grouped_by_chunk(), "PosList is not grouped by chunk");
+    _grouped_by_chunk = true;
+  }
+
+  // For a PosList that holds a subsequence of the positions of another one, i.e., a subset in the same order (e.g.,
+  // the output of a filter), the guarantees of the other PosList hold as well
+  void inherit_guarantees(const PosList& superset) {
+    if (superset._references_single_chunk) guarantee_single_chunk();
+    if (superset._grouped_by_chunk) guarantee_grouped_by_chunk();
+  }
+
+  bool references_single_chunk() const { return _references_single_chunk; }
+
+  bool grouped_by_chunk() const { return _grouped_by_chunk; }
+
+  bool is_chunk_range() const { return _is_chunk_range; }
+
+  // Turns a chunk range into an ordinary PosList that stores its RowIDs. Has no effect on other PosLists.
+  void materialize() {
+    if (_is_chunk_range) _materialize_chunk_range();
+  }
+
+  // The chunk that all positions reference. Requires references_single_chunk() and at least one position.
+  ChunkID common_chunk_id() const {
+    DebugAssert(_references_single_chunk && !empty(), "PosList does not reference a single chunk");
+    return _is_chunk_range ? _range_begin.chunk_id : Vector::front().chunk_id;
+  }
+
+  /**@}*/
+
+  /**
+   * @defgroup Read-only vector interface, also available for chunk ranges
+   * @{
+   */
+
+  size_type size() const { return _is_chunk_range ? _range_size : Vector::size(); }
+
+  bool empty() const { return size() == 0u; }
+
+  RowID operator[](const size_type index) const {
+    if (_is_chunk_range) {
+      return RowID{_range_begin.chunk_id, static_cast<ChunkOffset>(_range_begin.chunk_offset + index)};
+    }
+    return Vector::operator[](index);
+  }
+
+  RowID at(const size_type index) const {
+    if (_is_chunk_range) {
+      Assert(index < _range_size, "PosList index out of range");
+      return (*this)[index];
+    }
+    return Vector::at(index);
+  }
+
+  RowID front() const { return (*this)[0]; }
+  RowID back() const { return (*this)[size() - 1]; }
+
+  ConstIterator begin() const { return cbegin(); }
+  ConstIterator end() const { return cend(); }
+
+  ConstIterator cbegin() const { return ConstIterator{_is_chunk_range ? nullptr : Vector::data(), _range_begin, 0}; }
+
+  ConstIterator cend() const {
+    return ConstIterator{_is_chunk_range ? nullptr : Vector::data(), _range_begin,
+                         static_cast<ConstIterator::difference_type>(size())};
+  }
+
+  /**@}*/
+
+  /**
+   * @defgroup Modifying vector interface, chunk ranges have to be materialized first
+   * @{
+   */
+
+  reference operator[](const size_type index) {
+    _assert_materialized();
+    return Vector::operator[](index);
+  }
+
+  reference at(const size_type index) {
+    _assert_materialized();
+    return Vector::at(index);
+  }
+
+  reference front() {
+    _assert_materialized();
+    return Vector::front();
+  }
+
+  reference back() {
+    _assert_materialized();
+    return Vector::back();
+  }
+
+  iterator begin() {
+    _assert_materialized();
+    return Vector::begin();
+  }
+
+  iterator end() {
+    _assert_materialized();
+    return Vector::end();
+  }
+
+  void push_back(const RowID& row_id) {
+    _drop_guarantees();
+    Vector::push_back(row_id);
+  }
+
+  void push_back(RowID&& row_id) {
+    _drop_guarantees();
+    Vector::push_back(std::move(row_id));
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    _drop_guarantees();
+    return Vector::emplace_back(std::forward<Args>(args)...);
+  }
+
+  void assign(const size_type count, const RowID& row_id) {
+    _drop_guarantees();
+    Vector::assign(count, row_id);
+  }
+
+  template <typename InputIterator>
+  void assign(InputIterator first, InputIterator last) {
+    _drop_guarantees();
+    Vector::assign(first, last);
+  }
+
+  void assign(std::initializer_list<RowID> row_ids) {
+    _drop_guarantees();
+    Vector::assign(row_ids);
+  }
+
+  template <typename... Args>
+  iterator insert(Vector::const_iterator position, Args&&... args) {
+    _drop_guarantees();
+    return Vector::insert(position, std::forward<Args>(args)...);
+  }
+
+  iterator insert(Vector::const_iterator position, std::initializer_list<RowID> row_ids) {
+    _drop_guarantees();
+    return Vector::insert(position, row_ids);
+  }
+
+  template <typename... Args>
+  void resize(Args&&... args) {
+    _drop_guarantees();
+    Vector::resize(std::forward<Args>(args)...);
+  }
+
+  // Removing positions keeps the guarantees
+  template <typename... Args>
+  iterator erase(Args&&... args) {
+    _assert_materialized();
+    return Vector::erase(std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    _assert_materialized();
+    Vector::pop_back();
+  }
+
+  void clear() {
+    _is_chunk_range = false;
+    _range_begin = NULL_ROW_ID;
+    _range_size = 0u;
+    Vector::clear();
+  }
+
+  using Vector::capacity;
+  using Vector::get_allocator;
+  using Vector::reserve;
+  using Vector::shrink_to_fit;
+
+  /**@}*/
+
+  friend bool operator==(const PosList& lhs, const PosList& rhs);
+  friend bool operator!=(const PosList& lhs, const PosList& rhs) { return !(lhs == rhs); }
+
+ private:
+  void _assert_materialized() const {
+    DebugAssert(!_is_chunk_range, "Chunk ranges have to be materialized before they are modified");
+  }
+
+  void _materialize_chunk_range();
+
+  void _drop_guarantees() {
+    _assert_materialized();
+    _references_single_chunk = false;
+    _grouped_by_chunk = false;
+  }
+
+  bool _all_rows_reference_one_chunk() const;
+  bool _rows_are_grouped_by_chunk() const;
+
+  bool _is_chunk_range{false};
+  bool _references_single_chunk{false};
+  bool _grouped_by_chunk{false};
+  RowID _range_begin{NULL_ROW_ID};
+  ChunkOffset _range_size{0u};
+};
+
+inline bool operator==(const PosList& lhs, const PosList& rhs) {
+  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+}  // namespace opossum
@@ -47,7 +47,9 @@ std::shared_ptr<BaseColumn> ReferenceColumn::copy_using_allocator(const Polymorp
 }
 
 size_t ReferenceColumn::estimate_memory_usage() const {
-  return sizeof(*this) + _pos_list->size() * sizeof(decltype(_pos_list)::element_type::value_type);
+  // Chunk ranges do not store their positions
+  const auto stored_position_count = _pos_list->is_chunk_range() ? size_t{0} : _pos_list->size();
+  return sizeof(*this) + stored_position_count * sizeof(decltype(_pos_list)::element_type::value_type);
 }
 
 }  // namespace opossum
@@ -1,15 +1,27 @@
 #pragma once
 
-#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "storage/column_iterables.hpp"
+#include "storage/column_iterables/chunk_offset_mapping.hpp"
+#include "storage/create_iterable_from_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/resolve_encoded_column_type.hpp"
 
 namespace opossum {
 
+/**
+ * Instead of resolving every position of the PosList individually, the positions are grouped by the chunk they
+ * reference. For each referenced chunk, the typed point-access iterators of the referenced value or encoded column
+ * are used to decode all positions into that chunk in one go, in the order in which they appear in the PosList.
+ *
+ * If the PosList is a chunk range over an entire chunk, the sequential iterators of the referenced column are used. If
+ * all positions reference the same chunk (e.g., the output of a TableScan) and none of them is NULL, the
+ * point-access iterators of the referenced column are passed on directly. Otherwise, the values are first gathered
+ * into a buffer in the order of the PosList, which is then iterated over.
+ */
 template <typename T>
 class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>> {
  public:
@@ -19,85 +31,93 @@ class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>
   void _on_with_iterators(const Functor& functor) const {
     const auto table = _column.referenced_table();
     const auto column_id = _column.referenced_column_id();
+    const auto& pos_list = *_column.pos_list();
+
+    // A chunk range over an entire chunk is iterated just like the referenced column itself
+    if (pos_list.is_chunk_range() && !pos_list.empty() && pos_list.front().chunk_offset == 0u) {
+      const auto& referenced_column = *table->get_chunk(pos_list.common_chunk_id())->get_column(column_id);
+      if (referenced_column.size() == pos_list.size()) {
+        _with_referenced_iterable(referenced_column, [&](const auto& iterable) { iterable.with_iterators(functor); });
+        return;
+      }
+    }
 
-    const auto begin_it = _column.pos_list()->begin();
-    const auto end_it = _column.pos_list()->end();
+    const auto chunk_offsets_by_chunk_id = split_pos_list_by_chunk_id(pos_list);
+
+    if (chunk_offsets_by_chunk_id.size() == 1u && chunk_offsets_by_chunk_id.begin()->second.size() == pos_list.size()) {
+      const auto& mapped_chunk_offsets = chunk_offsets_by_chunk_id.begin()->second;
+      const auto chunk_id = chunk_offsets_by_chunk_id.begin()->first;
+      const auto& referenced_column = *table->get_chunk(chunk_id)->get_column(column_id);
+      _with_referenced_iterable(referenced_column, [&](const auto& iterable) {
+        iterable.with_iterators(&mapped_chunk_offsets, functor);
+      });
+      return;
+    }
 
-    auto begin = Iterator{table, column_id, begin_it, begin_it};
-    auto end = Iterator{table, column_id, begin_it, end_it};
+    // NULL positions are not part of any ChunkOffsetsList, so they are never overwritten
+    auto values = std::vector<T>(pos_list.size());
+    auto null_values = std::vector<bool>(pos_list.size(), true);
+
+    for (const auto& chunk_id_and_offsets : chunk_offsets_by_chunk_id) {
+      const auto& mapped_chunk_offsets = chunk_id_and_offsets.second;
+      const auto& referenced_column = *table->get_chunk(chunk_id_and_offsets.first)->get_column(column_id);
+      _with_referenced_iterable(referenced_column, [&](const auto& iterable) {
+        iterable.for_each(&mapped_chunk_offsets, [&](const auto& value) {
+          const auto chunk_offset = value.chunk_offset();
+          null_values[chunk_offset] = value.is_null();
+          if (!value.is_null()) values[chunk_offset] = value.value();
+        });
+      });
+    }
+
+    auto begin = Iterator{values, null_values, ChunkOffset{0u}};
+    auto end = Iterator{values, null_values, static_cast<ChunkOffset>(pos_list.size())};
     functor(begin, end);
   }
 
   size_t _on_size() const { return _column.size(); }
 
+ private:
+  // Calls the functor with the point-accessible iterable of the value or encoded column that is referenced
+  template <typename Functor>
+  static void _with_referenced_iterable(const BaseColumn& referenced_column, const Functor& functor) {
+    if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&referenced_column)) {
+      functor(create_iterable_from_column(*value_column));
+    } else if (const auto encoded_column = dynamic_cast<const BaseEncodedColumn*>(&referenced_column)) {
+      resolve_encoded_column_type<T>(*encoded_column, [&](const auto& typed_column) {
+        functor(create_iterable_from_column(typed_column));
+      });
+    } else {
+      Fail("Reference columns may only reference value or encoded columns of the same data type.");
+    }
+  }
+
  private:
   const ReferenceColumn& _column;
 
  private:
+  // Iterates over the values gathered from the referenced columns
   class Iterator : public BaseColumnIterator<Iterator, ColumnIteratorValue<T>> {
    public:
-    using PosListIterator = PosList::const_iterator;
-
-   public:
-    explicit Iterator(const std::shared_ptr<const Table> table, const ColumnID column_id,
-                      const PosListIterator& begin_pos_list_it, const PosListIterator& pos_list_it)
-        : _table{table},
-          _column_id{column_id},
-          _cached_chunk_id{INVALID_CHUNK_ID},
-          _cached_column{nullptr},
-          _begin_pos_list_it{begin_pos_list_it},
-          _pos_list_it{pos_list_it} {}
+    explicit Iterator(const std::vector<T>& values, const std::vector<bool>& null_values,
+                      const ChunkOffset chunk_offset)
+        : _values{&values}, _null_values{&null_values}, _chunk_offset{chunk_offset} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    void increment() { ++_pos_list_it; }
+    void increment() { ++_chunk_offset; }
 
-    bool equal(const Iterator& other) const { return _pos_list_it == other._pos_list_it; }
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
 
-    // TODO(anyone): benchmark if using two maps instead doing the dynamic cast every time really is faster.
     ColumnIteratorValue<T> dereference() const {
-      if (_pos_list_it->is_null()) return ColumnIteratorValue<T>{T{}, true, 0u};
-
-      const auto chunk_id = _pos_list_it->chunk_id;
-      const auto& chunk_offset = _pos_list_it->chunk_offset;
-
-      if (chunk_id != _cached_chunk_id) {
-        _cached_chunk_id = chunk_id;
-        const auto chunk = _table->get_chunk(chunk_id);
-        _cached_column = chunk->get_column(_column_id);
-      }
-
-      /**
-       * This is just a temporary solution to supporting encoded column type.
-       * It’s very slow and is going to be replaced very soon!
-       */
-      return _value_from_any_column(*_cached_column, chunk_offset);
+      return ColumnIteratorValue<T>{(*_values)[_chunk_offset], (*_null_values)[_chunk_offset], _chunk_offset};
     }
 
    private:
-    auto _value_from_any_column(const BaseColumn& column, const ChunkOffset& chunk_offset) const {
-      const auto variant_value = column[chunk_offset];
-
-      const auto chunk_offset_into_ref_column =
-          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
-
-      if (variant_is_null(variant_value)) {
-        return ColumnIteratorValue<T>{T{}, true, chunk_offset_into_ref_column};
-      }
-
-      return ColumnIteratorValue<T>{type_cast<T>(variant_value), false, chunk_offset_into_ref_column};
-    }
-
-   private:
-    const std::shared_ptr<const Table> _table;
-    const ColumnID _column_id;
-
-    mutable ChunkID _cached_chunk_id;
-    mutable std::shared_ptr<const BaseColumn> _cached_column;
-
-    const PosListIterator _begin_pos_list_it;
-    PosListIterator _pos_list_it;
+    const std::vector<T>* _values;
+    const std::vector<bool>* _null_values;
+    ChunkOffset _chunk_offset;
   };
 };
 
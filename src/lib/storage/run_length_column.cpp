@@ -37,14 +37,21 @@ template <typename T>
 const AllTypeVariant RunLengthColumn<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
 
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) return NULL_VALUE;
+
+  return AllTypeVariant{*typed_value};
+}
+
+template <typename T>
+std::optional<T> RunLengthColumn<T>::get_typed_value(const ChunkOffset chunk_offset) const {
   const auto end_position_it = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset);
   const auto index = std::distance(_end_positions->cbegin(), end_position_it);
 
   const auto is_null = (*_null_values)[index];
-  if (is_null) return NULL_VALUE;
+  if (is_null) return std::nullopt;
 
-  const auto value = (*_values)[index];
-  return AllTypeVariant{value};
+  return (*_values)[index];
 }
 
 template <typename T>
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "base_encoded_column.hpp"
 #include "types.hpp"
@@ -36,6 +37,10 @@ class RunLengthColumn : public BaseEncodedColumn {
   std::shared_ptr<const pmr_vector<bool>> null_values() const;
   std::shared_ptr<const pmr_vector<ChunkOffset>> end_positions() const;
 
+  // Returns the value at a certain position or std::nullopt if it is NULL. Unlike operator[], this is typed and
+  // does not go through an AllTypeVariant.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
   /**
    * @defgroup BaseColumn interface
    * @{
@@ -19,7 +19,7 @@ class RunLengthEncoder : public ColumnEncoder<RunLengthEncoder> {
 
   template <typename T>
   std::shared_ptr<BaseEncodedColumn> _on_encode(const std::shared_ptr<const ValueColumn<T>>& value_column) {
-    const auto alloc = value_column->values().get_allocator();
+    const auto alloc = value_column->with_values([](const auto& values) { return values.get_allocator(); });
 
     auto values = pmr_vector<T>{alloc};
     auto null_values = pmr_vector<bool>{alloc};
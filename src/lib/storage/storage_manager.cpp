@@ -1,6 +1,9 @@
 #include "storage_manager.hpp"
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>  // NOLINT lint thinks this is a C header or something
 #include <string>
 #include <utility>
 #include <vector>
@@ -22,32 +25,41 @@ StorageManager& StorageManager::get() {
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  Assert(_tables.find(name) == _tables.end(), "A table with the name " + name + " already exists");
-  Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
-
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
     Assert(table->get_chunk(chunk_id)->has_mvcc_columns(), "Table must have MVCC columns.");
   }
 
+  // Generating the statistics takes a while, so it happens before the lock is acquired
   table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  Assert(_tables.find(name) == _tables.end(), "A table with the name " + name + " already exists");
+  Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
+
   _tables.emplace(name, std::move(table));
 }
 
 void StorageManager::drop_table(const std::string& name) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
   const auto num_deleted = _tables.erase(name);
   Assert(num_deleted == 1, "Error deleting table " + name + ": _erase() returned " + std::to_string(num_deleted) + ".");
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
   const auto iter = _tables.find(name);
   Assert(iter != _tables.end(), "No such table named '" + name + "'");
 
   return iter->second;
 }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name); }
+bool StorageManager::has_table(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _tables.count(name);
+}
 
 std::vector<std::string> StorageManager::table_names() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
   std::vector<std::string> table_names;
   table_names.reserve(_tables.size());
 
@@ -58,7 +70,13 @@ std::vector<std::string> StorageManager::table_names() const {
   return table_names;
 }
 
+std::map<std::string, std::shared_ptr<Table>> StorageManager::tables() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _tables;
+}
+
 void StorageManager::add_lqp_view(const std::string& name, const std::shared_ptr<LQPView>& view) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
   Assert(_tables.find(name) == _tables.end(),
          "Cannot add view " + name + " - a table with the same name already exists");
   Assert(_views.find(name) == _views.end(), "A view with the name " + name + " already exists");
@@ -67,20 +85,30 @@ void StorageManager::add_lqp_view(const std::string& name, const std::shared_ptr
 }
 
 void StorageManager::drop_lqp_view(const std::string& name) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
   const auto num_deleted = _views.erase(name);
   Assert(num_deleted == 1, "Error deleting view " + name + ": _erase() returned " + std::to_string(num_deleted) + ".");
 }
 
 std::shared_ptr<LQPView> StorageManager::get_view(const std::string& name) const {
-  const auto iter = _views.find(name);
-  Assert(iter != _views.end(), "No such view named '" + name + "'");
+  auto view = std::shared_ptr<LQPView>{};
+  {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    const auto iter = _views.find(name);
+    Assert(iter != _views.end(), "No such view named '" + name + "'");
+    view = iter->second;
+  }
 
-  return iter->second->deep_copy();
+  return view->deep_copy();
 }
 
-bool StorageManager::has_view(const std::string& name) const { return _views.count(name); }
+bool StorageManager::has_view(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _views.count(name);
+}
 
 std::vector<std::string> StorageManager::view_names() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
   std::vector<std::string> view_names;
   view_names.reserve(_views.size());
 
@@ -92,6 +120,8 @@ std::vector<std::string> StorageManager::view_names() const {
 }
 
 void StorageManager::print(std::ostream& out) const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
   out << "==================" << std::endl;
   out << "===== Tables =====" << std::endl << std::endl;
 
@@ -111,13 +141,20 @@ void StorageManager::print(std::ostream& out) const {
   }
 }
 
-void StorageManager::reset() { get() = StorageManager(); }
+void StorageManager::reset() {
+  auto& storage_manager = get();
+  std::unique_lock<std::shared_mutex> lock(storage_manager._mutex);
+  storage_manager._tables.clear();
+  storage_manager._views.clear();
+}
 
 void StorageManager::export_all_tables_as_csv(const std::string& path) {
+  const auto tables_snapshot = tables();
+
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(_tables.size());
+  jobs.reserve(tables_snapshot.size());
 
-  for (auto& pair : _tables) {
+  for (auto& pair : tables_snapshot) {
     auto job_task = std::make_shared<JobTask>([pair, &path]() {
       const auto& name = pair.first;
       auto& table = pair.second;
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <shared_mutex>  // NOLINT lint thinks this is a C header or something
 #include <string>
 #include <vector>
 
@@ -16,6 +17,7 @@ class AbstractLQPNode;
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+// All methods may be called concurrently, e.g., by the server sessions and the BackgroundChunkEncoder.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -35,6 +37,9 @@ class StorageManager : private Noncopyable {
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
+  // returns a snapshot of all tables, which does not change when tables are added or dropped afterwards
+  std::map<std::string, std::shared_ptr<Table>> tables() const;
+
   // adds a view to the storage manager
   void add_lqp_view(const std::string& name, const std::shared_ptr<LQPView>& view);
 
@@ -66,7 +71,9 @@ class StorageManager : private Noncopyable {
 
  protected:
   StorageManager() {}
-  StorageManager& operator=(StorageManager&&) = default;
+
+  // Protects _tables and _views
+  mutable std::shared_mutex _mutex;
 
   std::map<std::string, std::shared_ptr<Table>> _tables;
   std::map<std::string, std::shared_ptr<LQPView>> _views;
@@ -140,10 +140,13 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
-  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
+  // The statistics may be replaced by a background task (see refresh_table_statistics()), so access them atomically
+  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) {
+    std::atomic_store(&_table_statistics, table_statistics);
+  }
 
-  std::shared_ptr<TableStatistics> table_statistics() { return _table_statistics; }
-  std::shared_ptr<const TableStatistics> table_statistics() const { return _table_statistics; }
+  std::shared_ptr<TableStatistics> table_statistics() { return std::atomic_load(&_table_statistics); }
+  std::shared_ptr<const TableStatistics> table_statistics() const { return std::atomic_load(&_table_statistics); }
 
   std::vector<IndexInfo> get_indexes() const;
 
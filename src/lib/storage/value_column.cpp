@@ -17,13 +17,13 @@ namespace opossum {
 
 template <typename T>
 ValueColumn<T>::ValueColumn(bool nullable) : BaseValueColumn(data_type_from_type<T>()) {
-  if (nullable) _null_values = pmr_concurrent_vector<bool>();
+  if (nullable) _null_values = NullValueVector();
 }
 
 template <typename T>
 ValueColumn<T>::ValueColumn(const PolymorphicAllocator<T>& alloc, bool nullable)
     : BaseValueColumn(data_type_from_type<T>()), _values(alloc) {
-  if (nullable) _null_values = pmr_concurrent_vector<bool>(alloc);
+  if (nullable) _null_values = NullValueVector(alloc);
 }
 
 template <typename T>
@@ -31,11 +31,11 @@ ValueColumn<T>::ValueColumn(pmr_concurrent_vector<T>&& values, const Polymorphic
     : BaseValueColumn(data_type_from_type<T>()), _values(std::move(values), alloc) {}
 
 template <typename T>
-ValueColumn<T>::ValueColumn(pmr_concurrent_vector<T>&& values, pmr_concurrent_vector<bool>&& null_values,
+ValueColumn<T>::ValueColumn(pmr_concurrent_vector<T>&& values, NullValueVector&& null_values,
                             const PolymorphicAllocator<T>& alloc)
     : BaseValueColumn(data_type_from_type<T>()),
       _values(std::move(values), alloc),
-      _null_values({std::move(null_values), alloc}) {}
+      _null_values(std::move(null_values)) {}
 
 template <typename T>
 ValueColumn<T>::ValueColumn(std::vector<T>& values, const PolymorphicAllocator<T>& alloc)
@@ -46,19 +46,45 @@ ValueColumn<T>::ValueColumn(std::vector<T>& values, std::vector<bool>& null_valu
                             const PolymorphicAllocator<T>& alloc)
     : BaseValueColumn(data_type_from_type<T>()),
       _values(values, alloc),
-      _null_values(pmr_concurrent_vector<bool>(null_values, alloc)) {}
+      _null_values(NullValueVector(null_values, alloc)) {}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(pmr_vector<T>&& values, const PolymorphicAllocator<T>& alloc)
+    : BaseValueColumn(data_type_from_type<T>()),
+      _values(alloc),
+      _contiguous_values(pmr_vector<T>(std::move(values), alloc)) {}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(pmr_vector<T>&& values, NullValueVector&& null_values, const PolymorphicAllocator<T>& alloc)
+    : BaseValueColumn(data_type_from_type<T>()),
+      _values(alloc),
+      _contiguous_values(pmr_vector<T>(std::move(values), alloc)),
+      _null_values(std::move(null_values)) {}
 
 template <typename T>
 const AllTypeVariant ValueColumn<T>::operator[](const ChunkOffset chunk_offset) const {
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
   PerformanceWarning("operator[] used");
 
+  const auto& value = _contiguous_values ? _contiguous_values->at(chunk_offset) : _values.at(chunk_offset);
+
   // Column supports null values and value is null
-  if (is_nullable() && _null_values->at(chunk_offset)) {
+  if (is_null(chunk_offset)) {
     return NULL_VALUE;
   }
 
-  return _values.at(chunk_offset);
+  return value;
+}
+
+template <typename T>
+std::optional<T> ValueColumn<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  return _contiguous_values ? (*_contiguous_values)[chunk_offset] : _values[chunk_offset];
 }
 
 template <typename T>
@@ -70,16 +96,20 @@ template <typename T>
 const T ValueColumn<T>::get(const ChunkOffset chunk_offset) const {
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
 
-  Assert(!is_nullable() || !(*_null_values).at(chunk_offset), "Can’t return value of column type because it is null.");
-  return _values.at(chunk_offset);
+  const auto& value = _contiguous_values ? _contiguous_values->at(chunk_offset) : _values.at(chunk_offset);
+
+  Assert(!is_null(chunk_offset), "Can’t return value of column type because it is null.");
+  return value;
 }
 
 template <typename T>
 void ValueColumn<T>::append(const AllTypeVariant& val) {
+  Assert(!is_contiguous(), "Cannot append to a contiguous ValueColumn.");
+
   bool is_null = variant_is_null(val);
 
   if (is_nullable()) {
-    (*_null_values).push_back(is_null);
+    _null_values->push_back(is_null);
     _values.push_back(is_null ? T{} : type_cast<T>(val));
     return;
   }
@@ -91,28 +121,65 @@ void ValueColumn<T>::append(const AllTypeVariant& val) {
 
 template <typename T>
 const pmr_concurrent_vector<T>& ValueColumn<T>::values() const {
+  DebugAssert(!is_contiguous(), "The values of a contiguous ValueColumn are accessed via contiguous_values().");
+
   return _values;
 }
 
 template <typename T>
 pmr_concurrent_vector<T>& ValueColumn<T>::values() {
+  DebugAssert(!is_contiguous(), "The values of a contiguous ValueColumn are accessed via contiguous_values().");
+
   return _values;
 }
 
+template <typename T>
+bool ValueColumn<T>::is_contiguous() const {
+  return static_cast<bool>(_contiguous_values);
+}
+
+template <typename T>
+const pmr_vector<T>& ValueColumn<T>::contiguous_values() const {
+  DebugAssert(is_contiguous(), "This ValueColumn is not contiguous.");
+
+  return *_contiguous_values;
+}
+
+template <typename T>
+std::shared_ptr<BaseValueColumn> ValueColumn<T>::copy_to_contiguous() const {
+  const auto alloc = _values.get_allocator();
+
+  auto contiguous_values = with_values([&](const auto& values) {
+    return pmr_vector<T>(values.cbegin(), values.cend(), alloc);
+  });
+
+  if (is_nullable()) {
+    NullValueVector new_null_values(*_null_values, alloc);
+    return std::allocate_shared<ValueColumn<T>>(alloc, std::move(contiguous_values), std::move(new_null_values));
+  } else {
+    return std::allocate_shared<ValueColumn<T>>(alloc, std::move(contiguous_values));
+  }
+}
+
 template <typename T>
 bool ValueColumn<T>::is_nullable() const {
   return static_cast<bool>(_null_values);
 }
 
 template <typename T>
-const pmr_concurrent_vector<bool>& ValueColumn<T>::null_values() const {
+bool ValueColumn<T>::contains_nulls() const {
+  return is_nullable() && _null_values->contains_nulls();
+}
+
+template <typename T>
+const NullValueVector& ValueColumn<T>::null_values() const {
   DebugAssert(is_nullable(), "This ValueColumn does not support null values.");
 
   return *_null_values;
 }
 
 template <typename T>
-pmr_concurrent_vector<bool>& ValueColumn<T>::null_values() {
+NullValueVector& ValueColumn<T>::null_values() {
   DebugAssert(is_nullable(), "This ValueColumn does not support null values.");
 
   return *_null_values;
@@ -120,15 +187,25 @@ pmr_concurrent_vector<bool>& ValueColumn<T>::null_values() {
 
 template <typename T>
 size_t ValueColumn<T>::size() const {
-  return _values.size();
+  return _contiguous_values ? _contiguous_values->size() : _values.size();
 }
 
 template <typename T>
 std::shared_ptr<BaseColumn> ValueColumn<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  if (is_contiguous()) {
+    pmr_vector<T> new_values(*_contiguous_values, alloc);
+    if (is_nullable()) {
+      NullValueVector new_null_values(*_null_values, alloc);
+      return std::allocate_shared<ValueColumn<T>>(alloc, std::move(new_values), std::move(new_null_values));
+    } else {
+      return std::allocate_shared<ValueColumn<T>>(alloc, std::move(new_values));
+    }
+  }
+
   pmr_concurrent_vector<T> new_values(_values, alloc);  // NOLINT(cppcoreguidelines-slicing)
                                                         // (clang-tidy reports slicing that comes from tbb)
   if (is_nullable()) {
-    pmr_concurrent_vector<bool> new_null_values(*_null_values, alloc);  // NOLINT(cppcoreguidelines-slicing) (see above)
+    NullValueVector new_null_values(*_null_values, alloc);
     return std::allocate_shared<ValueColumn<T>>(alloc, std::move(new_values), std::move(new_null_values));
   } else {
     return std::allocate_shared<ValueColumn<T>>(alloc, std::move(new_values));
@@ -137,7 +214,8 @@ std::shared_ptr<BaseColumn> ValueColumn<T>::copy_using_allocator(const Polymorph
 
 template <typename T>
 size_t ValueColumn<T>::estimate_memory_usage() const {
-  return sizeof(*this) + _values.size() * sizeof(T) + (_null_values ? _null_values->size() * sizeof(bool) : 0u);
+  return sizeof(*this) + size() * sizeof(T) +
+         (_null_values ? _null_values->word_count() * sizeof(NullValueVector::Word) : 0u);
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueColumn);
@@ -11,6 +11,8 @@
 namespace opossum {
 
 // ValueColumn is a specific column type that stores all its values in a vector.
+// While values can be appended, this is a pmr_concurrent_vector. Once the chunk of a ValueColumn becomes immutable,
+// the column is replaced by a copy that stores the values in a contiguous pmr_vector (see Chunk::mark_immutable()).
 template <typename T>
 class ValueColumn : public BaseValueColumn {
  public:
@@ -19,12 +21,16 @@ class ValueColumn : public BaseValueColumn {
 
   // Create a ValueColumn with the given values.
   explicit ValueColumn(pmr_concurrent_vector<T>&& values, const PolymorphicAllocator<T>& alloc = {});
-  explicit ValueColumn(pmr_concurrent_vector<T>&& values, pmr_concurrent_vector<bool>&& null_values,
+  explicit ValueColumn(pmr_concurrent_vector<T>&& values, NullValueVector&& null_values,
                        const PolymorphicAllocator<T>& alloc = {});
   explicit ValueColumn(std::vector<T>& values, const PolymorphicAllocator<T>& alloc = {});
   explicit ValueColumn(std::vector<T>& values, std::vector<bool>& null_values,
                        const PolymorphicAllocator<T>& alloc = {});
 
+  // Create a contiguous ValueColumn with the given values. No values can be appended to it.
+  explicit ValueColumn(pmr_vector<T>&& values, const PolymorphicAllocator<T>& alloc = {});
+  explicit ValueColumn(pmr_vector<T>&& values, NullValueVector&& null_values, const PolymorphicAllocator<T>& alloc = {});
+
   // Return the value at a certain position. If you want to write efficient operators, back off!
   // Use values() and null_values() to get the vectors and check the content yourself.
   const AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
@@ -36,24 +42,48 @@ class ValueColumn : public BaseValueColumn {
   // Only use if you are certain that no null values are present, otherwise an Assert fails.
   const T get(const ChunkOffset chunk_offset) const;
 
+  // Return the value at a certain position or std::nullopt if it is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
   // Add a value to the end of the column.
   void append(const AllTypeVariant& val) final;
 
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. auto& values = col.values(); and then: values.at(i); in your loop.
+  // Must not be called on contiguous columns, use contiguous_values() or with_values() instead.
   const pmr_concurrent_vector<T>& values() const;
   pmr_concurrent_vector<T>& values();
 
+  // Return whether the values are stored contiguously, i.e., in contiguous_values() instead of values().
+  bool is_contiguous() const final;
+
+  // Return the values of a contiguous column. They can be iterated using pointers, which allows the compiler to
+  // vectorize loops over them.
+  const pmr_vector<T>& contiguous_values() const;
+
+  // Calls the functor with either values() or contiguous_values(), depending on where the values are stored.
+  template <typename Functor>
+  decltype(auto) with_values(const Functor& functor) const {
+    if (_contiguous_values) return functor(*_contiguous_values);
+    return functor(_values);
+  }
+
+  std::shared_ptr<BaseValueColumn> copy_to_contiguous() const final;
+
   // Return whether column supports null values.
   bool is_nullable() const final;
 
+  // Return whether a value might be null. If false, the null value vector does not have to be checked.
+  bool contains_nulls() const final;
+
   // Return null value vector that indicates whether a value is null with true at position i.
   // Throws exception if is_nullable() returns false
   // This is the preferred method to check a for a null value at a certain index.
   // Usually you need to access more than a single value anyway.
-  const pmr_concurrent_vector<bool>& null_values() const final;
-  pmr_concurrent_vector<bool>& null_values() final;
+  // The null values are stored as a bitmap, see NullValueVector for how to check 64 of them at once.
+  const NullValueVector& null_values() const final;
+  NullValueVector& null_values() final;
 
   // Return the number of entries in the column.
   size_t size() const final;
@@ -66,10 +96,13 @@ class ValueColumn : public BaseValueColumn {
  protected:
   pmr_concurrent_vector<T> _values;
 
+  // Holds the values instead of _values if the column is contiguous
+  std::optional<pmr_vector<T>> _contiguous_values;
+
   // While a ValueColumn knows if it is nullable or not by looking at this optional, most other column types
   // (e.g. DictionaryColumn) does not. For this reason, we need to store the nullable information separately
   // in the table's definition.
-  std::optional<pmr_concurrent_vector<bool>> _null_values;
+  std::optional<NullValueVector> _null_values;
 };
 
 }  // namespace opossum
@@ -0,0 +1,49 @@
+#include "null_value_vector.hpp"
+
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+NullValueVector::NullValueVector(const PolymorphicAllocator<Word>& alloc) : _words(alloc) {}
+
+NullValueVector::NullValueVector(const size_t size, const PolymorphicAllocator<Word>& alloc)
+    : _words(word_count_for(size), copyable_atomic<Word>{0u}, alloc), _size{size} {}
+
+NullValueVector::NullValueVector(const std::vector<bool>& null_values, const PolymorphicAllocator<Word>& alloc)
+    : NullValueVector(null_values.cbegin(), null_values.cend(), alloc) {}
+
+NullValueVector::NullValueVector(const NullValueVector& other, const PolymorphicAllocator<Word>& alloc)
+    : _words(other._words, alloc), _size{other.size()}, _contains_nulls{other.contains_nulls()} {}
+
+void NullValueVector::set(const size_t index, const bool is_null) {
+  DebugAssert(index < size(), "NullValueVector index out of range");
+
+  auto& word = _words[index / BITS_PER_WORD];
+  const auto mask = Word{1} << (index % BITS_PER_WORD);
+
+  if (is_null) {
+    _contains_nulls.store(true);
+    word.fetch_or(mask);
+  } else {
+    word.fetch_and(~mask);
+  }
+}
+
+void NullValueVector::push_back(const bool is_null) {
+  const auto index = size();
+  if (index % BITS_PER_WORD == 0u) _words.push_back(copyable_atomic<Word>{0u});
+  _size.store(index + 1);
+
+  if (is_null) set(index, true);
+}
+
+void NullValueVector::resize(const size_t new_size) {
+  Assert(new_size >= size(), "NullValueVectors cannot shrink");
+
+  _words.grow_to_at_least(word_count_for(new_size), copyable_atomic<Word>{0u});
+  _size.store(new_size);
+}
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/copyable_atomic.hpp"
+
+namespace opossum {
+
+/**
+ * Stores the NULL flags of a ValueColumn as a bitmap. Bit i of word w is set if position w * BITS_PER_WORD + i is
+ * NULL, bits beyond size() are never set.
+ *
+ * Instead of checking the positions one by one, consumers can process BITS_PER_WORD positions at a time via word(),
+ * e.g., to skip all NULL checks for a word that is zero. If contains_nulls() returns false, no position is NULL and
+ * the bitmap does not need to be looked at at all.
+ *
+ * Like the values of a ValueColumn, a NullValueVector can grow while it is being read. As concurrent Inserts write
+ * into adjacent positions, which may share a word, the words are modified atomically.
+ */
+class NullValueVector {
+ public:
+  using Word = uint64_t;
+  static constexpr auto BITS_PER_WORD = size_t{64};
+
+  // Iterates over the NULL flags, dereferencing returns the flag by value
+  class ConstIterator : public boost::iterator_facade<ConstIterator, bool, boost::random_access_traversal_tag, bool> {
+   public:
+    ConstIterator(const NullValueVector& null_values, const size_t index)
+        : _null_values{&null_values}, _index{index} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    bool dereference() const { return (*_null_values)[_index]; }
+    bool equal(const ConstIterator& other) const { return _index == other._index; }
+    void increment() { ++_index; }
+    void decrement() { --_index; }
+    void advance(const std::ptrdiff_t n) { _index += n; }
+    std::ptrdiff_t distance_to(const ConstIterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+   private:
+    const NullValueVector* _null_values;
+    size_t _index;
+  };
+
+  using value_type = bool;
+  using const_iterator = ConstIterator;
+  using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+  explicit NullValueVector(const PolymorphicAllocator<Word>& alloc = {});
+
+  // Creates a NullValueVector of the given size in which no position is NULL
+  explicit NullValueVector(const size_t size, const PolymorphicAllocator<Word>& alloc = {});
+
+  // Creates a NullValueVector from a range of bools
+  template <typename Iterator>
+  NullValueVector(Iterator begin, const Iterator end, const PolymorphicAllocator<Word>& alloc = {})
+      : NullValueVector(static_cast<size_t>(std::distance(begin, end)), alloc) {
+    for (auto index = size_t{0}; begin != end; ++begin, ++index) {
+      if (*begin) set(index, true);
+    }
+  }
+
+  explicit NullValueVector(const std::vector<bool>& null_values, const PolymorphicAllocator<Word>& alloc = {});
+
+  // Copies the NullValueVector using a new allocator
+  NullValueVector(const NullValueVector& other, const PolymorphicAllocator<Word>& alloc);
+
+  NullValueVector(const NullValueVector&) = default;
+  NullValueVector(NullValueVector&&) = default;
+  NullValueVector& operator=(const NullValueVector&) = default;
+  NullValueVector& operator=(NullValueVector&&) = default;
+
+  bool operator[](const size_t index) const {
+    return (word(index / BITS_PER_WORD) >> (index % BITS_PER_WORD)) & Word{1};
+  }
+
+  // Sets the NULL flag of a position. Can be called concurrently for different positions.
+  void set(const size_t index, const bool is_null);
+
+  // Appends a position. Like ValueColumn::append(), this may not be called concurrently.
+  void push_back(const bool is_null);
+
+  // Grows the vector, the added positions are not NULL. NullValueVectors cannot shrink.
+  void resize(const size_t new_size);
+
+  size_t size() const { return _size.load(std::memory_order_relaxed); }
+  bool empty() const { return size() == 0u; }
+
+  // If false, no position is NULL. Once a position has been set to NULL, this stays true.
+  bool contains_nulls() const { return _contains_nulls.load(std::memory_order_relaxed); }
+
+  /**
+   * @defgroup Word-wise access
+   * @{
+   */
+
+  size_t word_count() const { return _words.size(); }
+
+  Word word(const size_t word_index) const { return _words[word_index].load(std::memory_order_relaxed); }
+
+  // The number of words needed to store the given number of positions
+  static size_t word_count_for(const size_t size) { return (size + BITS_PER_WORD - 1) / BITS_PER_WORD; }
+
+  /**@}*/
+
+  ConstIterator begin() const { return cbegin(); }
+  ConstIterator end() const { return cend(); }
+  ConstIterator cbegin() const { return ConstIterator{*this, 0u}; }
+  ConstIterator cend() const { return ConstIterator{*this, size()}; }
+  const_reverse_iterator crbegin() const { return const_reverse_iterator{cend()}; }
+  const_reverse_iterator crend() const { return const_reverse_iterator{cbegin()}; }
+
+  bool front() const { return (*this)[0]; }
+  bool back() const { return (*this)[size() - 1]; }
+
+ private:
+  pmr_concurrent_vector<copyable_atomic<Word>> _words;
+  copyable_atomic<size_t> _size{0u};
+  copyable_atomic<bool> _contains_nulls{false};
+};
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "storage/column_iterables.hpp"
+#include "storage/value_column/null_value_vector.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -14,7 +15,7 @@ namespace opossum {
  */
 class NullValueVectorIterable : public PointAccessibleColumnIterable<NullValueVectorIterable> {
  public:
-  explicit NullValueVectorIterable(const pmr_concurrent_vector<bool>& null_values) : _null_values{null_values} {}
+  explicit NullValueVectorIterable(const NullValueVector& null_values) : _null_values{null_values} {}
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
@@ -31,12 +32,12 @@ class NullValueVectorIterable : public PointAccessibleColumnIterable<NullValueVe
   }
 
  private:
-  const pmr_concurrent_vector<bool>& _null_values;
+  const NullValueVector& _null_values;
 
  private:
   class Iterator : public BaseColumnIterator<Iterator, ColumnIteratorNullValue> {
    public:
-    using NullValueIterator = pmr_concurrent_vector<bool>::const_iterator;
+    using NullValueIterator = NullValueVector::ConstIterator;
 
    public:
     explicit Iterator(const NullValueIterator& begin_null_value_it, const NullValueIterator& null_value_it)
@@ -59,9 +60,6 @@ class NullValueVectorIterable : public PointAccessibleColumnIterable<NullValueVe
   };
 
   class PointAccessIterator : public BasePointAccessColumnIterator<PointAccessIterator, ColumnIteratorNullValue> {
-   public:
-    using NullValueVector = pmr_concurrent_vector<bool>;
-
    public:
     explicit PointAccessIterator(const NullValueVector& null_values, const ChunkOffsetsIterator& chunk_offsets_it)
         : BasePointAccessColumnIterator<PointAccessIterator, ColumnIteratorNullValue>{chunk_offsets_it},
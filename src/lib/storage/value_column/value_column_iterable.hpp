@@ -1,5 +1,6 @@
 #pragma once
 
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -13,31 +14,41 @@ class ValueColumnIterable : public PointAccessibleColumnIterable<ValueColumnIter
  public:
   explicit ValueColumnIterable(const ValueColumn<T>& column) : _column{column} {}
 
+  // If no value is null, the null value vector is not looked at. The iterators of contiguous columns wrap the
+  // iterators of a pmr_vector, which boil down to pointer arithmetic.
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
-    if (_column.is_nullable()) {
-      auto begin = Iterator{_column.values().cbegin(), _column.values().cbegin(), _column.null_values().cbegin()};
-      auto end = Iterator{_column.values().cbegin(), _column.values().cend(), _column.null_values().cend()};
+    _column.with_values([&](const auto& values) {
+      using ValueIterator = typename std::decay_t<decltype(values)>::const_iterator;
+
+      if (_column.contains_nulls()) {
+        auto begin = Iterator<ValueIterator>{values.cbegin(), values.cbegin(), _column.null_values()};
+        auto end = Iterator<ValueIterator>{values.cbegin(), values.cend(), _column.null_values()};
+        functor(begin, end);
+        return;
+      }
+
+      auto begin = NonNullIterator<ValueIterator>{values.cbegin(), values.cbegin()};
+      auto end = NonNullIterator<ValueIterator>{values.cend(), values.cend()};
       functor(begin, end);
-      return;
-    }
-
-    auto begin = NonNullIterator{_column.values().cbegin(), _column.values().cbegin()};
-    auto end = NonNullIterator{_column.values().cend(), _column.values().cend()};
-    functor(begin, end);
+    });
   }
 
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
-    if (_column.is_nullable()) {
-      auto begin = PointAccessIterator{_column.values(), _column.null_values(), mapped_chunk_offsets.cbegin()};
-      auto end = PointAccessIterator{_column.values(), _column.null_values(), mapped_chunk_offsets.cend()};
-      functor(begin, end);
-    } else {
-      auto begin = NonNullPointAccessIterator{_column.values(), mapped_chunk_offsets.cbegin()};
-      auto end = NonNullPointAccessIterator{_column.values(), mapped_chunk_offsets.cend()};
-      functor(begin, end);
-    }
+    _column.with_values([&](const auto& values) {
+      using ValueVector = std::decay_t<decltype(values)>;
+
+      if (_column.contains_nulls()) {
+        auto begin = PointAccessIterator<ValueVector>{values, _column.null_values(), mapped_chunk_offsets.cbegin()};
+        auto end = PointAccessIterator<ValueVector>{values, _column.null_values(), mapped_chunk_offsets.cend()};
+        functor(begin, end);
+      } else {
+        auto begin = NonNullPointAccessIterator<ValueVector>{values, mapped_chunk_offsets.cbegin()};
+        auto end = NonNullPointAccessIterator<ValueVector>{values, mapped_chunk_offsets.cend()};
+        functor(begin, end);
+      }
+    });
   }
 
   size_t _on_size() const { return _column.size(); }
@@ -46,10 +57,8 @@ class ValueColumnIterable : public PointAccessibleColumnIterable<ValueColumnIter
   const ValueColumn<T>& _column;
 
  private:
-  class NonNullIterator : public BaseColumnIterator<NonNullIterator, NonNullColumnIteratorValue<T>> {
-   public:
-    using ValueIterator = typename pmr_concurrent_vector<T>::const_iterator;
-
+  template <typename ValueIterator>
+  class NonNullIterator : public BaseColumnIterator<NonNullIterator<ValueIterator>, NonNullColumnIteratorValue<T>> {
    public:
     explicit NonNullIterator(const ValueIterator begin_value_it, const ValueIterator value_it)
         : _value_it{value_it}, _chunk_offset{static_cast<ChunkOffset>(std::distance(begin_value_it, value_it))} {}
@@ -72,47 +81,59 @@ class ValueColumnIterable : public PointAccessibleColumnIterable<ValueColumnIter
     ChunkOffset _chunk_offset;
   };
 
-  class Iterator : public BaseColumnIterator<Iterator, ColumnIteratorValue<T>> {
-   public:
-    using ValueIterator = typename pmr_concurrent_vector<T>::const_iterator;
-    using NullValueIterator = pmr_concurrent_vector<bool>::const_iterator;
-
+  // Loads the null values word by word, i.e., once every NullValueVector::BITS_PER_WORD values
+  template <typename ValueIterator>
+  class Iterator : public BaseColumnIterator<Iterator<ValueIterator>, ColumnIteratorValue<T>> {
    public:
     explicit Iterator(const ValueIterator begin_value_it, const ValueIterator value_it,
-                      const NullValueIterator null_value_it)
+                      const NullValueVector& null_values)
         : _value_it(value_it),
-          _null_value_it{null_value_it},
-          _chunk_offset{static_cast<ChunkOffset>(std::distance(begin_value_it, value_it))} {}
+          _null_values{&null_values},
+          _chunk_offset{static_cast<ChunkOffset>(std::distance(begin_value_it, value_it))},
+          _null_word{_load_null_word()} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
     void increment() {
       ++_value_it;
-      ++_null_value_it;
       ++_chunk_offset;
+
+      if (_chunk_offset % NullValueVector::BITS_PER_WORD == 0u) {
+        _null_word = _load_null_word();
+      } else {
+        _null_word >>= 1u;
+      }
     }
 
     bool equal(const Iterator& other) const { return _value_it == other._value_it; }
 
     ColumnIteratorValue<T> dereference() const {
-      return ColumnIteratorValue<T>{*_value_it, *_null_value_it, _chunk_offset};
+      return ColumnIteratorValue<T>{*_value_it, static_cast<bool>(_null_word & 1u), _chunk_offset};
+    }
+
+    // Returns the word of the current chunk offset, shifted so that its null value is the lowest bit
+    NullValueVector::Word _load_null_word() const {
+      const auto word_index = _chunk_offset / NullValueVector::BITS_PER_WORD;
+      if (word_index >= _null_values->word_count()) return 0u;
+
+      return _null_values->word(word_index) >> (_chunk_offset % NullValueVector::BITS_PER_WORD);
     }
 
    private:
     ValueIterator _value_it;
-    NullValueIterator _null_value_it;
+    const NullValueVector* _null_values;
     ChunkOffset _chunk_offset;
+    NullValueVector::Word _null_word;
   };
 
+  template <typename ValueVector>
   class NonNullPointAccessIterator
-      : public BasePointAccessColumnIterator<NonNullPointAccessIterator, ColumnIteratorValue<T>> {
-   public:
-    using ValueVector = pmr_concurrent_vector<T>;
-
+      : public BasePointAccessColumnIterator<NonNullPointAccessIterator<ValueVector>, ColumnIteratorValue<T>> {
    public:
     explicit NonNullPointAccessIterator(const ValueVector& values, const ChunkOffsetsIterator& chunk_offsets_it)
-        : BasePointAccessColumnIterator<NonNullPointAccessIterator, ColumnIteratorValue<T>>{chunk_offsets_it},
+        : BasePointAccessColumnIterator<NonNullPointAccessIterator<ValueVector>, ColumnIteratorValue<T>>{
+              chunk_offsets_it},
           _values{values} {}
 
    private:
@@ -128,15 +149,13 @@ class ValueColumnIterable : public PointAccessibleColumnIterable<ValueColumnIter
     const ValueVector& _values;
   };
 
-  class PointAccessIterator : public BasePointAccessColumnIterator<PointAccessIterator, ColumnIteratorValue<T>> {
-   public:
-    using ValueVector = pmr_concurrent_vector<T>;
-    using NullValueVector = pmr_concurrent_vector<bool>;
-
+  template <typename ValueVector>
+  class PointAccessIterator
+      : public BasePointAccessColumnIterator<PointAccessIterator<ValueVector>, ColumnIteratorValue<T>> {
    public:
     explicit PointAccessIterator(const ValueVector& values, const NullValueVector& null_values,
                                  const ChunkOffsetsIterator& chunk_offsets_it)
-        : BasePointAccessColumnIterator<PointAccessIterator, ColumnIteratorValue<T>>{chunk_offsets_it},
+        : BasePointAccessColumnIterator<PointAccessIterator<ValueVector>, ColumnIteratorValue<T>>{chunk_offsets_it},
           _values{values},
           _null_values{null_values} {}
 
@@ -29,20 +29,20 @@ void ChunkCompressionTask::_on_execute() {
 
     auto chunk = table->get_chunk(chunk_id);
 
-    DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
+    DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
     ChunkEncoder::encode_chunk(chunk, table->column_data_types());
   }
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
   if (chunk->size() != max_chunk_size) return false;
 
   auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
 
-  for (const auto begin_cid : mvcc_columns->begin_cids) {
-    if (begin_cid == MvccColumns::MAX_COMMIT_ID) return false;
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < mvcc_columns->size(); ++chunk_offset) {
+    if (mvcc_columns->begin_cid(chunk_offset) == MvccColumns::MAX_COMMIT_ID) return false;
   }
 
   return true;
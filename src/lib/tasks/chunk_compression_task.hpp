@@ -35,16 +35,15 @@ class ChunkCompressionTask : public AbstractTask {
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
   explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
 
- protected:
-  void _on_execute() override;
-
- private:
   /**
    * @brief Checks if a chunks is completed
    *
    * See class comment for further explanation
    */
-  bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+  static bool chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+
+ protected:
+  void _on_execute() override;
 
  private:
   const std::string _table_name;
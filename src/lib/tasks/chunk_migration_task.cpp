@@ -47,8 +47,8 @@ bool ChunkMigrationTask::chunk_is_completed(const std::shared_ptr<const Chunk>&
   if (chunk->has_mvcc_columns()) {
     auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
 
-    for (const auto begin_cid : mvcc_columns->begin_cids) {
-      if (begin_cid == MvccColumns::MAX_COMMIT_ID) return false;
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < mvcc_columns->size(); ++chunk_offset) {
+      if (mvcc_columns->begin_cid(chunk_offset) == MvccColumns::MAX_COMMIT_ID) return false;
     }
   }
 
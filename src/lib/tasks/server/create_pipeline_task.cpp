@@ -10,7 +10,8 @@ void CreatePipelineTask::_on_execute() {
   auto result = std::make_unique<CreatePipelineResult>();
 
   try {
-    result->sql_pipeline = std::make_shared<SQLPipeline>(SQLPipelineBuilder{_sql}.create_pipeline());
+    result->sql_pipeline = std::make_shared<SQLPipeline>(
+        SQLPipelineBuilder{_sql}.with_execution_mode(ExecutionMode::MorselDriven).create_pipeline());
   } catch (const std::exception& exception) {
     // Try LOAD file_name table_name
     if (_allow_load_table && _is_load_table()) {
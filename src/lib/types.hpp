@@ -135,7 +135,7 @@ using TransactionID = uint32_t;
 
 using AttributeVectorWidth = uint8_t;
 
-using PosList = pmr_vector<RowID>;
+class PosList;  // see storage/pos_list.hpp
 using ColumnIDPair = std::pair<ColumnID, ColumnID>;
 
 constexpr NodeID INVALID_NODE_ID{std::numeric_limits<NodeID::base_type>::max()};
@@ -199,6 +199,9 @@ enum class DescriptionMode { SingleLine, MultiLine };
 enum class UseMvcc : bool { Yes = true, No = false };
 enum class CleanupTemporaries : bool { Yes = true, No = false };
 
+// OperatorAtATime materializes the output of every operator, MorselDriven pushes chunks through chains of operators
+enum class ExecutionMode { OperatorAtATime, MorselDriven };
+
 class Noncopyable {
  protected:
   Noncopyable() = default;
@@ -62,6 +62,16 @@ class copyable_atomic {
     return _atomic.exchange(std::forward<Args>(args)...);
   }
 
+  template <typename... Args>
+  decltype(auto) fetch_or(Args&&... args) {
+    return _atomic.fetch_or(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  decltype(auto) fetch_and(Args&&... args) {
+    return _atomic.fetch_and(std::forward<Args>(args)...);
+  }
+
   template <typename... Args>
   bool compare_exchange_weak(Args&&... args) {
     return _atomic.compare_exchange_weak(std::forward<Args>(args)...);
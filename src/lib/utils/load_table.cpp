@@ -56,7 +56,7 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
 
     auto chunk = test_table->get_chunk(static_cast<ChunkID>(test_table->chunk_count() - 1));
     auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
-    mvcc_columns->begin_cids.back() = 0;
+    mvcc_columns->set_begin_cid(static_cast<ChunkOffset>(mvcc_columns->size() - 1), 0);
   }
   return test_table;
 }
@@ -2,6 +2,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -108,4 +109,71 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, PendingTransactionsAreCommittedInOneBatch) {
+  auto contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  for (auto context_idx = 0; context_idx < 4; ++context_idx) {
+    contexts.emplace_back(manager().new_transaction_context());
+  }
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto committed_count = 0;
+  const auto callback = [&](TransactionID) {
+    ++committed_count;
+    // The commit IDs of all four contexts are published at once
+    EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + 4);
+  };
+
+  // While a context commits its records (i.e., after it got its commit ID), the next context commits. Thus, all
+  // contexts are pending when the first one is done committing its records.
+  for (auto context_idx = size_t{0}; context_idx + 1 < contexts.size(); ++context_idx) {
+    auto commit_op = std::make_shared<CommitFuncOp>([&, context_idx]() {
+      contexts[context_idx + 1]->commit_async(callback);
+      EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id);
+    });
+    commit_op->set_transaction_context(contexts[context_idx]);
+    commit_op->execute();
+  }
+
+  contexts.front()->commit_async(callback);
+
+  EXPECT_EQ(committed_count, 4);
+  EXPECT_EQ(manager().last_commit_id(), contexts.back()->commit_id());
+}
+
+TEST_F(TransactionContextTest, ConcurrentCommits) {
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto COMMITS_PER_THREAD = 200;
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_idx = 0; thread_idx < THREAD_COUNT; ++thread_idx) {
+    threads.emplace_back([&]() {
+      for (auto commit_idx = 0; commit_idx < COMMITS_PER_THREAD; ++commit_idx) {
+        auto context = manager().new_transaction_context();
+
+        // Operators register themselves concurrently if they are executed by different workers
+        auto register_threads = std::vector<std::thread>{};
+        for (auto op_idx = 0; op_idx < 2; ++op_idx) {
+          register_threads.emplace_back([&]() {
+            auto op = std::make_shared<CommitFuncOp>([]() {});
+            op->set_transaction_context(context);
+            op->execute();
+          });
+        }
+        for (auto& register_thread : register_threads) register_thread.join();
+
+        context->commit();
+        EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+        EXPECT_GE(manager().last_commit_id(), context->commit_id());
+      }
+    });
+  }
+
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + THREAD_COUNT * COMMITS_PER_THREAD);
+}
+
 }  // namespace opossum
@@ -0,0 +1,88 @@
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_feature_lqp_node_proxy.hpp"
+#include "cost_model/cost_model_physical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+using namespace std::string_literals;            // NOLINT
+
+namespace opossum {
+
+class CostModelPhysicalTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("customer", load_table("src/test/tables/tpch/sf-0.001/customer.tbl"));
+    StorageManager::get().add_table("nation", load_table("src/test/tables/tpch/sf-0.001/nation.tbl"));
+
+    customer = StoredTableNode::make("customer");
+    nation = StoredTableNode::make("nation");
+    join_node = JoinNode::make(JoinMode::Inner,
+                               equals_(customer->get_column("c_nationkey"s), nation->get_column("n_nationkey"s)),
+                               customer, nation);
+  }
+
+  void TearDown() override { StorageManager::reset(); }
+
+  std::shared_ptr<StoredTableNode> customer, nation;
+  std::shared_ptr<JoinNode> join_node;
+};
+
+TEST_F(CostModelPhysicalTest, WeightedSumOfFeatures) {
+  const auto cost_model = CostModelPhysical{{{OperatorType::JoinHash,
+                                              {{CostFeature::LeftInputRowCount, 2.0f},
+                                               {CostFeature::RightInputRowCount, 0.5f}}}}};
+
+  EXPECT_FLOAT_EQ(cost_model.estimate_lqp_node_cost(join_node, OperatorType::JoinHash), 150 * 2.0f + 25 * 0.5f);
+
+  // OperatorTypes without coefficients are never considered cheap
+  EXPECT_EQ(cost_model.estimate_lqp_node_cost(join_node, OperatorType::JoinSortMerge),
+            std::numeric_limits<Cost>::infinity());
+}
+
+TEST_F(CostModelPhysicalTest, DefaultCoefficientsPreferHashJoin) {
+  const auto cost_model = CostModelPhysical{};
+
+  const auto join_hash_cost = cost_model.estimate_lqp_node_cost(join_node, OperatorType::JoinHash);
+  EXPECT_GT(join_hash_cost, 0.0f);
+  EXPECT_LT(join_hash_cost, cost_model.estimate_lqp_node_cost(join_node, OperatorType::JoinSortMerge));
+  EXPECT_LT(join_hash_cost, cost_model.estimate_lqp_node_cost(join_node, OperatorType::JoinMPSM));
+}
+
+TEST_F(CostModelPhysicalTest, ImportExportCoefficients) {
+  const auto coefficients = CostModelPhysical::default_coefficients();
+  const auto json = export_cost_model_coefficients(coefficients);
+
+  EXPECT_FLOAT_EQ(json["JoinHash"]["LeftInputRowCount"].get<float>(),
+                  coefficients.at(OperatorType::JoinHash).at(CostFeature::LeftInputRowCount));
+
+  const auto imported_coefficients = import_cost_model_coefficients(json);
+  EXPECT_EQ(imported_coefficients, coefficients);
+}
+
+TEST_F(CostModelPhysicalTest, RightInputIsIndexed) {
+  auto nation_table = StorageManager::get().get_table("nation");
+  ChunkEncoder::encode_all_chunks(nation_table);
+  nation_table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  const auto cost_model = CostModelPhysical{{{OperatorType::JoinIndex, {{CostFeature::LeftInputRowCount, 1.0f}}}}};
+  EXPECT_FLOAT_EQ(cost_model.estimate_lqp_node_cost(join_node, OperatorType::JoinIndex), 150.0f);
+
+  const auto feature_proxy = CostFeatureLQPNodeProxy{join_node};
+  EXPECT_TRUE(feature_proxy.extract_feature(CostFeature::RightInputIsIndexed).boolean());
+}
+
+}  // namespace opossum
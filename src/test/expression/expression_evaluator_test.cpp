@@ -74,7 +74,7 @@ class ExpressionEvaluatorTest : public ::testing::Test {
     ChunkColumns columns;
     columns.emplace_back(std::make_shared<ValueColumn<int32_t>>(pmr_concurrent_vector<int32_t>{}));
     columns.emplace_back(
-        std::make_shared<ValueColumn<float>>(pmr_concurrent_vector<float>{}, pmr_concurrent_vector<bool>{}));
+        std::make_shared<ValueColumn<float>>(pmr_concurrent_vector<float>{}, NullValueVector{}));
     columns.emplace_back(std::make_shared<ValueColumn<std::string>>(pmr_concurrent_vector<std::string>{}));
     table_empty->append_chunk(columns);
 
@@ -1,4 +1,5 @@
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -10,9 +11,9 @@ namespace opossum {
 
 class LikeMatcherTest : public ::testing::Test {
  public:
-  bool match(const std::string& value, const std::string& pattern) const {
+  bool match(const std::string& value, const std::string& pattern, const bool case_insensitive = false) const {
     auto result = false;
-    LikeMatcher{pattern}.resolve(false, [&](const auto& matcher) { result = matcher(value); });
+    LikeMatcher{pattern, case_insensitive}.resolve(false, [&](const auto& matcher) { result = matcher(value); });
     return result;
   }
 };
@@ -52,6 +53,87 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("hello", "Hello"));
   EXPECT_FALSE(match("Hello", "Hello_"));
   EXPECT_FALSE(match("Hello", "He_o"));
+  EXPECT_FALSE(match("Hello World", "%o_W%x"));
+  EXPECT_FALSE(match("Hello", "%H%ello%o"));
+}
+
+TEST_F(LikeMatcherTest, GenericPattern) {
+  EXPECT_EQ(LikeMatcher::pattern_string_to_pattern_variant("H_llo%W%ld").type(),
+            typeid(LikeMatcher::GenericPattern));
+
+  EXPECT_TRUE(match("", ""));
+  EXPECT_TRUE(match("", "%%"));
+  EXPECT_TRUE(match("Hello World", "H_llo%W%ld"));
+  EXPECT_TRUE(match("Hello World", "%l_o%_%"));
+  EXPECT_TRUE(match("Hello World", "___%___"));
+  EXPECT_TRUE(match("abab", "%ab"));
+  EXPECT_TRUE(match("aXbaYb", "a%a_b"));
+  EXPECT_TRUE(match("Backslash \\ and [brackets]", "%\\%[_rackets]"));
+
+  // The segments in between must not overlap with the first or the last segment
+  EXPECT_FALSE(match("Hello", ""));
+  EXPECT_FALSE(match("abc", "ab%bc"));
+  EXPECT_FALSE(match("abc", "a%b%bc"));
+  EXPECT_FALSE(match("bbbba", "%bb%bb"));
+  EXPECT_FALSE(match("Hello", "______"));
+  EXPECT_FALSE(match("Hello World", "Hello%_x_%"));
+}
+
+TEST_F(LikeMatcherTest, Find) {
+  // Longer than a single SSE block, so that both the vectorized and the remaining positions are searched
+  const auto haystack = std::string(40, 'a') + "needle" + std::string(20, 'b') + "needle";
+
+  EXPECT_EQ(LikeMatcher::find(haystack, "needle"), 40u);
+  EXPECT_EQ(LikeMatcher::find(haystack, "needle", 41u), 66u);
+  EXPECT_EQ(LikeMatcher::find(haystack, "needle", 67u), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find(haystack, "n"), 40u);
+  EXPECT_EQ(LikeMatcher::find(haystack, "eb"), 45u);
+  EXPECT_EQ(LikeMatcher::find(haystack, "nee_le"), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find(haystack, ""), 0u);
+  EXPECT_EQ(LikeMatcher::find(haystack, "", haystack.size()), haystack.size());
+  EXPECT_EQ(LikeMatcher::find(haystack, "a", haystack.size() + 1), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find("short", "longer than short"), std::string_view::npos);
+
+  EXPECT_TRUE(match(haystack, "%needle%bbbb%needle"));
+  EXPECT_FALSE(match(haystack, "%needle%needle%needle%"));
+}
+
+TEST_F(LikeMatcherTest, CaseInsensitive) {
+  EXPECT_TRUE(LikeMatcher("%Hello%", true).is_case_insensitive());
+  EXPECT_FALSE(LikeMatcher("%Hello%").is_case_insensitive());
+
+  EXPECT_TRUE(match("hello", "Hello", true));
+  EXPECT_TRUE(match("HELLO WORLD", "hello%", true));
+  EXPECT_TRUE(match("HELLO WORLD", "%World", true));
+  EXPECT_TRUE(match("Say HeLLo!", "%hello%", true));
+  EXPECT_TRUE(match("Hello World", "%HELLO%WORLD%", true));
+  EXPECT_TRUE(match("Hello World", "h_LLO%w%D", true));
+  EXPECT_FALSE(match("Hello World", "h_LLO%x%D", true));
+  EXPECT_FALSE(match("HELLO WORLD", "hello%"));
+}
+
+TEST_F(LikeMatcherTest, StartsWithPrefix) {
+  EXPECT_EQ(LikeMatcher{"Hello%"}.starts_with_prefix(), "Hello");
+  EXPECT_EQ(LikeMatcher{"%Hello%"}.starts_with_prefix(), std::nullopt);
+  EXPECT_EQ(LikeMatcher{"H_llo%"}.starts_with_prefix(), std::nullopt);
+
+  // Dictionaries are sorted case-sensitively, so a case-insensitive prefix cannot be searched for in them
+  EXPECT_EQ(LikeMatcher("Hello%", true).starts_with_prefix(), std::nullopt);
+}
+
+TEST_F(LikeMatcherTest, MatchAll) {
+  const auto strings = std::vector<std::string>{"Hello", "hello", "Hello World", "World", ""};
+
+  auto matches = std::vector<bool>(strings.size());
+  EXPECT_EQ(LikeMatcher{"Hello%"}.match_all(strings, false, matches), 2u);
+  EXPECT_EQ(matches, std::vector<bool>({true, false, true, false, false}));
+
+  EXPECT_EQ(LikeMatcher{"Hello%"}.match_all(strings, true, matches), 3u);
+  EXPECT_EQ(matches, std::vector<bool>({false, true, false, true, true}));
+
+  auto int_matches = std::vector<int32_t>(strings.size());
+  EXPECT_EQ(LikeMatcher("%L_o%", true).match_all(strings, false, int_matches), 3u);
+  EXPECT_EQ(int_matches, std::vector<int32_t>({1, 1, 1, 0, 0}));
 }
 
 }  // namespace opossum
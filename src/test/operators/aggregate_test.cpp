@@ -17,6 +17,9 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -581,4 +584,30 @@ TEST_F(OperatorsAggregateTest, OuterJoinThenAggregate) {
                     "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/outer_join.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, GroupByInParallelBatches) {
+  // Enough small chunks for the grouping to be split into several batches (see JobGranularity)
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int, true}}, TableType::Data, 500);
+  for (auto row_idx = 0; row_idx < 40'000; ++row_idx) {
+    table->append({(row_idx * 7919) % 1000, row_idx % 7 ? AllTypeVariant{row_idx} : NULL_VALUE});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum}};
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{1}, ColumnID{0}};
+
+  auto sequential_aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+  sequential_aggregate->execute();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto parallel_aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+  parallel_aggregate->execute();
+
+  // The groups are identified in the order of their first occurrence, no matter how many batches were used
+  EXPECT_TABLE_EQ_ORDERED(parallel_aggregate->get_output(), sequential_aggregate->get_output());
+}
+
 }  // namespace opossum
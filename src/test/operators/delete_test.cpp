@@ -15,6 +15,7 @@
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -93,6 +94,44 @@ TEST_F(OperatorsDeleteTest, ExecuteAndCommit) { helper(true); }
 
 TEST_F(OperatorsDeleteTest, ExecuteAndAbort) { helper(false); }
 
+TEST_F(OperatorsDeleteTest, DeleteFromCompactMvccColumns) {
+  // Encoding makes the chunk immutable, so its MVCC columns are compacted
+  ChunkEncoder::encode_all_chunks(_table);
+  const auto mvcc_columns = _table->get_chunk(ChunkID{0})->mvcc_columns();
+  ASSERT_TRUE(mvcc_columns->is_compact());
+
+  auto t1_context = TransactionManager::get().new_transaction_context();
+  auto t2_context = TransactionManager::get().new_transaction_context();
+
+  // Selects two out of three rows.
+  auto table_scan = std::make_shared<TableScan>(_gt, ColumnID{0}, PredicateCondition::GreaterThan, "456.7");
+  table_scan->execute();
+
+  auto delete_op1 = std::make_shared<Delete>(_table_name, table_scan);
+  delete_op1->set_transaction_context(t1_context);
+  delete_op1->execute();
+  EXPECT_FALSE(delete_op1->execute_failed());
+
+  auto delete_op2 = std::make_shared<Delete>(_table_name, table_scan);
+  delete_op2->set_transaction_context(t2_context);
+  delete_op2->execute();
+  EXPECT_TRUE(delete_op2->execute_failed());
+
+  t1_context->commit();
+  t2_context->rollback();
+
+  EXPECT_EQ(mvcc_columns->end_cid(0u), t1_context->commit_id());
+  EXPECT_EQ(mvcc_columns->end_cid(1u), MvccColumns::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_columns->tid(0u), t1_context->transaction_id());
+
+  auto validate = std::make_shared<Validate>(_gt);
+  auto t3_context = TransactionManager::get().new_transaction_context();
+  validate->set_transaction_context(t3_context);
+  validate->execute();
+
+  EXPECT_EQ(validate->get_output()->row_count(), 1u);
+}
+
 TEST_F(OperatorsDeleteTest, DetectDirtyWrite) {
   auto t1_context = TransactionManager::get().new_transaction_context();
   auto t2_context = TransactionManager::get().new_transaction_context();
@@ -16,6 +16,7 @@
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/value_column.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -78,6 +79,55 @@ TEST_F(OperatorsInsertTest, InsertRespectChunkSize) {
   EXPECT_EQ(t->chunk_count(), 4u);
   EXPECT_EQ(t->get_chunk(ChunkID{3})->size(), 1u);
   EXPECT_EQ(t->row_count(), 13u);
+
+  // The chunks created by the Insert only contain rows that were committed by it
+  for (auto chunk_id = ChunkID{1}; chunk_id < t->chunk_count(); ++chunk_id) {
+    const auto& mvcc_columns = *t->get_chunk(chunk_id)->mvcc_columns();
+    EXPECT_TRUE(mvcc_columns.all_rows_visible(context->commit_id()));
+    EXPECT_FALSE(mvcc_columns.all_rows_visible(context->commit_id() - 1));
+  }
+}
+
+TEST_F(OperatorsInsertTest, CompletedChunksBecomeContiguous) {
+  auto t_name = "test1";
+  auto t_name2 = "test2";
+
+  // 3 Rows, chunk_size = 4
+  auto t = load_table("src/test/tables/int.tbl", 4u);
+  StorageManager::get().add_table(t_name, t);
+
+  // 10 Rows
+  auto t2 = load_table("src/test/tables/10_ints.tbl", Chunk::MAX_SIZE);
+  StorageManager::get().add_table(t_name2, t2);
+
+  auto gt2 = std::make_shared<GetTable>(t_name2);
+  gt2->execute();
+
+  auto ins = std::make_shared<Insert>(t_name, gt2);
+  auto context = TransactionManager::get().new_transaction_context();
+  ins->set_transaction_context(context);
+  ins->execute();
+
+  // Full chunks are not completed as long as the inserted rows are uncommitted
+  ASSERT_EQ(t->chunk_count(), 4u);
+  EXPECT_TRUE(t->get_chunk(ChunkID{1})->is_mutable());
+
+  context->commit();
+
+  // The full chunks remain unencoded, but their ValueColumns are contiguous
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{3}; ++chunk_id) {
+    const auto chunk = t->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    const auto value_column = std::dynamic_pointer_cast<const ValueColumn<int32_t>>(chunk->get_column(ColumnID{0}));
+    ASSERT_NE(value_column, nullptr);
+    EXPECT_TRUE(value_column->is_contiguous());
+    EXPECT_EQ(value_column->size(), 4u);
+  }
+
+  // The last chunk can still receive rows
+  EXPECT_TRUE(t->get_chunk(ChunkID{3})->is_mutable());
+  EXPECT_FALSE(std::dynamic_pointer_cast<const ValueColumn<int32_t>>(t->get_chunk(ChunkID{3})->get_column(ColumnID{0}))
+                   ->is_contiguous());
 }
 
 TEST_F(OperatorsInsertTest, MultipleChunks) {
@@ -156,6 +206,7 @@ TEST_F(OperatorsInsertTest, Rollback) {
   validate->execute();
 
   EXPECT_EQ(validate->get_output()->row_count(), 3u);
+  EXPECT_FALSE(t->get_chunk(ChunkID{1})->mvcc_columns()->all_rows_visible(context2->snapshot_commit_id()));
 }
 
 TEST_F(OperatorsInsertTest, InsertStringNullValue) {
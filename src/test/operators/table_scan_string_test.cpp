@@ -68,7 +68,8 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanStringTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary,
-                                          EncodingType::FixedStringDictionary, EncodingType::RunLength),
+                                          EncodingType::FixedStringDictionary, EncodingType::RunLength,
+                                          EncodingType::FrontCodedDictionary),
                         formatter);
 
 TEST_P(OperatorsTableScanStringTest, ScanEquals) {
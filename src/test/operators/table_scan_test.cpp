@@ -13,10 +13,15 @@
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_granularity.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -205,7 +210,8 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
-                                          EncodingType::FrameOfReference),
+                                          EncodingType::FrameOfReference, EncodingType::Delta,
+                                          EncodingType::PatchedFrameOfReference),
                         formatter);
 
 TEST_P(OperatorsTableScanTest, DoubleScan) {
@@ -237,6 +243,33 @@ TEST_P(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanTest, ScanMatchingEntireChunksOutputsChunkRanges) {
+  const auto table_wrapper = get_table_op();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  scan->execute();
+
+  const auto& output = *scan->get_output();
+  ASSERT_EQ(output.chunk_count(), 2u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto& column = static_cast<const ReferenceColumn&>(*output.get_chunk(chunk_id)->get_column(ColumnID{0}));
+    EXPECT_TRUE(column.pos_list()->is_chunk_range());
+    EXPECT_EQ(column.pos_list()->common_chunk_id(), chunk_id);
+  }
+  EXPECT_TABLE_EQ_ORDERED(scan->get_output(), table_wrapper->get_output());
+
+  // Scanning the chunk ranges again yields PosLists that still reference a single chunk
+  auto scan_2 = std::make_shared<TableScan>(scan, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  scan_2->execute();
+
+  const auto& output_2 = *scan_2->get_output();
+  ASSERT_EQ(output_2.chunk_count(), 2u);
+  const auto& column_2 = static_cast<const ReferenceColumn&>(*output_2.get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  EXPECT_FALSE(column_2.pos_list()->is_chunk_range());
+  EXPECT_TRUE(column_2.pos_list()->references_single_chunk());
+  EXPECT_TABLE_EQ_UNORDERED(scan_2->get_output(), load_table("src/test/tables/int_float_filtered2.tbl", 1));
+}
+
 TEST_P(OperatorsTableScanTest, ScanOnCompressedColumn) {
   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
 
@@ -629,6 +662,59 @@ TEST_P(OperatorsTableScanTest, ScanWithExcludedFirstChunk) {
   ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
 }
 
+TEST_P(OperatorsTableScanTest, ScanSplitsLargeChunks) {
+  // With a scheduler, chunks of more than JobGranularity::MIN_ROWS_PER_JOB rows are scanned in parts by several jobs
+  const auto row_count = static_cast<int32_t>(JobGranularity::MIN_ROWS_PER_JOB * 4);
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, row_count);
+  for (auto value = 0; value < row_count; ++value) {
+    table->append({value});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, {_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // Without a scheduler, the chunk is scanned as a whole. These scans provide reference inputs that consist of a single
+  // chunk, one with a chunk range and one with an ordinary PosList.
+  const auto all_rows =
+      std::make_shared<opossum::TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  all_rows->execute();
+  const auto all_rows_but_five =
+      std::make_shared<opossum::TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::NotEquals, 5);
+  all_rows_but_five->execute();
+  ASSERT_EQ(all_rows->get_output()->chunk_count(), 1u);
+  ASSERT_EQ(all_rows_but_five->get_output()->chunk_count(), 1u);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{table_wrapper, all_rows, all_rows_but_five}) {
+    const auto scan =
+        std::make_shared<opossum::TableScan>(input, ColumnID{0}, PredicateCondition::LessThan, row_count / 2);
+    scan->execute();
+    const auto output = scan->get_output();
+
+    EXPECT_GT(output->chunk_count(), 1u);
+
+    // Every value below row_count / 2 is found exactly once, except for the 5 if it was filtered out before
+    auto found_values = std::vector<bool>(row_count / 2, false);
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto& column = *output->get_chunk(chunk_id)->get_column(ColumnID{0});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < column.size(); ++chunk_offset) {
+        const auto value = type_cast<int32_t>(column[chunk_offset]);
+        ASSERT_LT(value, row_count / 2);
+        EXPECT_FALSE(found_values[value]);
+        found_values[value] = true;
+      }
+    }
+    EXPECT_EQ(found_values[5], input != all_rows_but_five);
+    EXPECT_EQ(output->row_count(), static_cast<size_t>(row_count / 2 - (input == all_rows_but_five ? 1 : 0)));
+  }
+}
+
 TEST_P(OperatorsTableScanTest, SetParameters) {
   const auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{{ParameterID{3}, AllTypeVariant{5}},
                                                                           {ParameterID{2}, AllTypeVariant{6}}};
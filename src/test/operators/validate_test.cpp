@@ -7,13 +7,21 @@
 #include "gtest/gtest.h"
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "operators/abstract_read_only_operator.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/value_column.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -80,4 +88,139 @@ TEST_F(OperatorsValidateTest, ScanValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ValidateUngroupedPosList) {
+  // The positions alternate between the referenced chunks, so that the referenced chunk changes with every position
+  const auto referenced_table = _table_wrapper->get_output();
+  const auto pos_list =
+      std::make_shared<PosList>(PosList{{ChunkID{1}, 0u}, {ChunkID{0}, 0u}, {ChunkID{1}, 1u}, {ChunkID{0}, 1u}});
+
+  auto columns = ChunkColumns{};
+  for (auto column_id = ColumnID{0}; column_id < referenced_table->column_count(); ++column_id) {
+    columns.push_back(std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list));
+  }
+  const auto reference_table = std::make_shared<Table>(referenced_table->column_definitions(), TableType::References);
+  reference_table->append_chunk(columns);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(std::make_shared<TransactionContext>(1u, 3u));
+  validate->execute();
+
+  // The row with a = 7 is invisible, the order of the others is retained
+  const auto output = validate->get_output();
+  ASSERT_EQ(output->chunk_count(), 1u);
+  const auto& column = *output->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+  ASSERT_EQ(column.size(), 3u);
+  EXPECT_EQ(column[0], AllTypeVariant{1});
+  EXPECT_EQ(column[1], AllTypeVariant{11});
+  EXPECT_EQ(column[2], AllTypeVariant{4});
+}
+
+TEST_F(OperatorsValidateTest, ValidateSplitsLargeChunks) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 100'000,
+                                             UseMvcc::Yes);
+  for (auto row_idx = 0; row_idx < 100'000; ++row_idx) {
+    table->append({row_idx});
+  }
+  set_all_records_visible(*table);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 100'000; chunk_offset += 10) {
+    set_record_invisible_for(*table, RowID{ChunkID{0}, chunk_offset}, 2u);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto transaction_context = std::make_shared<TransactionContext>(1u, 3u);
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  // The single chunk was validated in several parts, but the order of the rows is retained
+  const auto output = validate->get_output();
+  EXPECT_GT(output->chunk_count(), 1u);
+  ASSERT_EQ(output->row_count(), 90'000u);
+
+  auto expected_value = 1;
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& column = *output->get_chunk(chunk_id)->get_column(ColumnID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < column.size(); ++chunk_offset) {
+      ASSERT_EQ(column[chunk_offset], AllTypeVariant{expected_value});
+      expected_value += expected_value % 10 == 9 ? 2 : 1;
+    }
+  }
+}
+
+TEST_F(OperatorsValidateTest, FullyVisibleChunks) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 3,
+                                             UseMvcc::Yes);
+  auto values_a = std::vector<int32_t>{1, 2, 3};
+  auto values_b = std::vector<int32_t>{4, 5, 6};
+  table->append_chunk({std::make_shared<ValueColumn<int32_t>>(values_a)});
+  table->append_chunk({std::make_shared<ValueColumn<int32_t>>(values_b)});
+  StorageManager::get().add_table("validate_table", table);
+
+  const auto& mvcc_columns_a = *table->get_chunk(ChunkID{0})->mvcc_columns();
+  const auto& mvcc_columns_b = *table->get_chunk(ChunkID{1})->mvcc_columns();
+  EXPECT_TRUE(mvcc_columns_a.all_rows_visible(0u));
+  EXPECT_TRUE(mvcc_columns_b.all_rows_visible(0u));
+
+  const auto validate_table = [&](const std::shared_ptr<TransactionContext>& transaction_context) {
+    auto get_table = std::make_shared<GetTable>("validate_table");
+    get_table->execute();
+    auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+    table_scan->execute();
+    auto validate = std::make_shared<Validate>(table_scan);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  };
+
+  // Fully visible chunks of reference inputs are passed on without creating a new PosList
+  {
+    auto get_table = std::make_shared<GetTable>("validate_table");
+    get_table->execute();
+    auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+    table_scan->execute();
+    auto validate = std::make_shared<Validate>(table_scan);
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    const auto pos_list_of = [](const std::shared_ptr<const Table>& table, const ChunkID chunk_id) {
+      return std::static_pointer_cast<const ReferenceColumn>(table->get_chunk(chunk_id)->get_column(ColumnID{0}))
+          ->pos_list();
+    };
+    ASSERT_EQ(validate->get_output()->chunk_count(), 2u);
+    EXPECT_EQ(pos_list_of(validate->get_output(), ChunkID{0}), pos_list_of(table_scan->get_output(), ChunkID{0}));
+    EXPECT_EQ(pos_list_of(validate->get_output(), ChunkID{1}), pos_list_of(table_scan->get_output(), ChunkID{1}));
+  }
+
+  // Delete the row with a = 5
+  const auto delete_context = TransactionManager::get().new_transaction_context();
+  auto get_table = std::make_shared<GetTable>("validate_table");
+  get_table->execute();
+  auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::Equals, 5);
+  table_scan->execute();
+  auto delete_op = std::make_shared<Delete>("validate_table", table_scan);
+  delete_op->set_transaction_context(delete_context);
+  delete_op->execute();
+
+  // Only the chunk that the row is deleted from needs to be checked row by row
+  EXPECT_TRUE(mvcc_columns_a.all_rows_visible(0u));
+  EXPECT_FALSE(mvcc_columns_b.all_rows_visible(0u));
+
+  const auto concurrent_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(validate_table(delete_context), 4u);
+  EXPECT_EQ(validate_table(concurrent_context), 5u);
+
+  delete_context->commit();
+  EXPECT_EQ(validate_table(concurrent_context), 5u);
+  EXPECT_EQ(validate_table(TransactionManager::get().new_transaction_context()), 4u);
+}
+
 }  // namespace opossum
@@ -6,6 +6,7 @@
 
 #include "gtest/gtest.h"
 
+#include "cost_model/cost_model_physical.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
 #include "expression/expression_functional.hpp"
@@ -28,6 +29,7 @@
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/show_columns.hpp"
@@ -581,6 +583,40 @@ TEST_F(LQPTranslatorTest, JoinNode) {
   EXPECT_EQ(join_op->mode(), JoinMode::Outer);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeSelectsIndexJoinForSmallProbeSide) {
+  // A small input joined with a large indexed table should not build a hash table over the large table
+  auto indexed_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 100);
+  for (auto value = 0; value < 1000; ++value) indexed_table->append({value});
+  ChunkEncoder::encode_all_chunks(indexed_table);
+  StorageManager::get().add_table("table_indexed", indexed_table);
+
+  const auto indexed_node = StoredTableNode::make("table_indexed");
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, indexed_node->get_column("a")), int_float_node, indexed_node);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+
+  indexed_table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(LQPTranslator{}.translate_node(join_node));
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->mode(), JoinMode::Inner);
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeSelectsCheapestJoinOfCostModel) {
+  auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a), int_float_node, int_float2_node);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+
+  const auto cost_model = std::make_shared<CostModelPhysical>(
+      CostModelPhysicalCoefficients{{OperatorType::JoinHash, {{CostFeature::LeftInputRowCount, 10.0f}}},
+                                    {OperatorType::JoinSortMerge, {{CostFeature::LeftInputRowCount, 1.0f}}},
+                                    {OperatorType::JoinMPSM, {{CostFeature::LeftInputRowCount, 5.0f}}}});
+  const auto op = LQPTranslator{cost_model}.translate_node(join_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(op));
+}
+
 TEST_F(LQPTranslatorTest, ShowTablesNode) {
   /**
    * Build LQP and translate to PQP
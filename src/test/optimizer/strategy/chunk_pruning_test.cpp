@@ -259,4 +259,35 @@ TEST_F(ChunkPruningTest, FixedStringPruningTest) {
   EXPECT_EQ(excluded, expected);
 }
 
+TEST_F(ChunkPruningTest, StringBloomFilterPruningTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("string_compressed");
+
+  // "vvv" lies between the minimum and maximum of the second chunk, but is not contained in it
+  auto predicate_node =
+      std::make_shared<PredicateNode>(equals_(LQPColumnReference(stored_table_node, ColumnID{0}), "vvv"));
+  predicate_node->set_left_input(stored_table_node);
+
+  auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(pruned, predicate_node);
+  std::vector<ChunkID> expected = {ChunkID{0}, ChunkID{1}};
+  std::vector<ChunkID> excluded = stored_table_node->excluded_chunk_ids();
+  EXPECT_EQ(excluded, expected);
+}
+
+TEST_F(ChunkPruningTest, LikePrefixPruningTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("string_compressed");
+
+  auto predicate_node =
+      std::make_shared<PredicateNode>(like_(LQPColumnReference(stored_table_node, ColumnID{0}), "zz%"));
+  predicate_node->set_left_input(stored_table_node);
+
+  auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(pruned, predicate_node);
+  std::vector<ChunkID> expected = {ChunkID{0}};
+  std::vector<ChunkID> excluded = stored_table_node->excluded_chunk_ids();
+  EXPECT_EQ(excluded, expected);
+}
+
 }  // namespace opossum
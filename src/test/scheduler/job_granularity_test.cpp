@@ -0,0 +1,109 @@
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_granularity.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class JobGranularityTest : public BaseTest {
+ protected:
+  static std::vector<ChunkID> chunk_ids_of(const MorselBatch& batch) {
+    auto chunk_ids = std::vector<ChunkID>{};
+    for (const auto& morsel : batch) {
+      chunk_ids.emplace_back(morsel.chunk_id);
+    }
+    return chunk_ids;
+  }
+};
+
+TEST_F(JobGranularityTest, ChunksOf) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 2);
+  for (auto value = 0; value < 5; ++value) {
+    table->append({value});
+  }
+
+  const auto chunks = JobGranularity::chunks_of(*table);
+  ASSERT_EQ(chunks.size(), 3u);
+  EXPECT_EQ(chunks[2].chunk_id, ChunkID{2});
+  EXPECT_EQ(chunks[2].begin_offset, 0u);
+  EXPECT_EQ(chunks[2].end_offset, 1u);
+
+  const auto some_chunks = JobGranularity::chunks_of(*table, {ChunkID{0}, ChunkID{2}});
+  ASSERT_EQ(some_chunks.size(), 2u);
+  EXPECT_EQ(some_chunks[1].chunk_id, ChunkID{2});
+}
+
+TEST_F(JobGranularityTest, BatchSmallChunks) {
+  const auto chunks = std::vector<Morsel>{{ChunkID{0}, 0, 10},
+                                          {ChunkID{1}, 0, 10},
+                                          {ChunkID{2}, 0, 10},
+                                          {ChunkID{3}, 0, 10},
+                                          {ChunkID{4}, 0, 30},
+                                          {ChunkID{5}, 0, 5}};
+
+  const auto batches = JobGranularity::plan_jobs(chunks, SplitChunks::No, 20);
+  ASSERT_EQ(batches.size(), 4u);
+  EXPECT_EQ(chunk_ids_of(batches[0]), std::vector<ChunkID>({ChunkID{0}, ChunkID{1}}));
+  EXPECT_EQ(chunk_ids_of(batches[1]), std::vector<ChunkID>({ChunkID{2}, ChunkID{3}}));
+  EXPECT_EQ(chunk_ids_of(batches[2]), std::vector<ChunkID>({ChunkID{4}}));
+  EXPECT_EQ(chunk_ids_of(batches[3]), std::vector<ChunkID>({ChunkID{5}}));
+
+  // Without SplitChunks::Yes, chunks are never split
+  EXPECT_EQ(batches[2].front().end_offset, 30u);
+}
+
+TEST_F(JobGranularityTest, SplitLargeChunks) {
+  const auto chunks = std::vector<Morsel>{{ChunkID{0}, 0, 10}, {ChunkID{1}, 0, 100}, {ChunkID{2}, 0, 5}};
+
+  const auto batches = JobGranularity::plan_jobs(chunks, SplitChunks::Yes, 40);
+  ASSERT_EQ(batches.size(), 5u);
+
+  EXPECT_EQ(chunk_ids_of(batches[0]), std::vector<ChunkID>({ChunkID{0}}));
+
+  // The second chunk is split into three parts of (almost) equal size
+  auto next_begin_offset = ChunkOffset{0};
+  for (auto batch_idx = size_t{1}; batch_idx <= 3; ++batch_idx) {
+    ASSERT_EQ(batches[batch_idx].size(), 1u);
+    const auto& morsel = batches[batch_idx].front();
+    EXPECT_EQ(morsel.chunk_id, ChunkID{1});
+    EXPECT_EQ(morsel.begin_offset, next_begin_offset);
+    EXPECT_GE(morsel.size(), 33u);
+    next_begin_offset = morsel.end_offset;
+  }
+  EXPECT_EQ(next_begin_offset, 100u);
+
+  EXPECT_EQ(chunk_ids_of(batches[4]), std::vector<ChunkID>({ChunkID{2}}));
+}
+
+TEST_F(JobGranularityTest, TargetRowsPerJob) {
+  // Without a scheduler, there is no point in using more than one job
+  EXPECT_EQ(JobGranularity::target_rows_per_job(100'000'000), 100'000'000u);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  EXPECT_EQ(JobGranularity::target_rows_per_job(10), JobGranularity::MIN_ROWS_PER_JOB);
+  EXPECT_EQ(JobGranularity::target_rows_per_job(100'000'000'000), JobGranularity::MAX_ROWS_PER_JOB);
+}
+
+TEST_F(JobGranularityTest, ExecuteJobs) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto executed_jobs = std::vector<std::atomic_uint>(100);
+  JobGranularity::execute_jobs(executed_jobs.size(), [&](const size_t job_idx) { ++executed_jobs[job_idx]; });
+
+  for (const auto& executed_job : executed_jobs) {
+    EXPECT_EQ(executed_job, 1u);
+  }
+}
+
+}  // namespace opossum
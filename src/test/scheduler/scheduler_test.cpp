@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <stdexcept>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -10,7 +14,11 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/processing_unit.hpp"
+#include "scheduler/task_group.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
+#include "scheduler/work_stealing_deque.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -185,6 +193,342 @@ TEST_F(SchedulerTest, DiamondDependenciesWithoutScheduler) {
   ASSERT_EQ(counter, 7u);
 }
 
+TEST_F(SchedulerTest, NestedWaitsDoNotBlockWorkers) {
+  // With a single core, more nested waits than there are workers per core would deadlock if every waiting task blocked
+  // its worker. Instead, the waiting worker executes the tasks it waits for, so no further workers are needed.
+  Topology::use_non_numa_topology(1);
+  const auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+
+  std::atomic_uint counter{0};
+
+  std::function<void(size_t)> schedule_and_wait_recursively = [&](const size_t depth) {
+    counter++;
+    if (depth == 0) return;
+
+    auto task = std::make_shared<JobTask>([&, depth]() { schedule_and_wait_recursively(depth - 1); });
+    CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{task});
+  };
+
+  auto root_task = std::make_shared<JobTask>([&]() { schedule_and_wait_recursively(10); });
+  root_task->schedule();
+  root_task->join();
+
+  EXPECT_EQ(counter, 11u);
+  ASSERT_EQ(scheduler->processing_units().size(), 1u);
+  EXPECT_EQ(scheduler->processing_units()[0]->num_workers(), 1u);
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(SchedulerTest, WaitingWorkersOnlyExecuteAwaitedTasks) {
+  Topology::use_non_numa_topology(1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto task_group = std::make_shared<TaskGroup>();
+  const auto foreign_task_group = std::make_shared<TaskGroup>();
+  std::atomic_bool waiting{false};
+  std::atomic_bool foreign_task_executed_while_waiting{false};
+  auto waiting_thread_id = std::thread::id{};
+
+  auto outer_task = std::make_shared<JobTask>([&]() {
+    auto awaited_task = std::make_shared<JobTask>([]() {});
+    awaited_task->schedule();
+
+    // Pushed into the local deque after the awaited task, so that it is the first one the waiting worker sees
+    auto foreign_task = std::make_shared<JobTask>([&]() {
+      foreign_task_executed_while_waiting = waiting && std::this_thread::get_id() == waiting_thread_id;
+    });
+    foreign_task->set_task_group(foreign_task_group);
+    foreign_task->schedule();
+
+    waiting_thread_id = std::this_thread::get_id();
+    waiting = true;
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{awaited_task});
+    waiting = false;
+  });
+  outer_task->set_task_group(task_group);
+  outer_task->schedule();
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_TRUE(outer_task->is_done());
+  EXPECT_FALSE(foreign_task_executed_while_waiting);
+}
+
+TEST_F(SchedulerTest, TaskGroupIsRestoredAfterException) {
+  Topology::use_non_numa_topology(1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto task_group = std::make_shared<TaskGroup>();
+  auto inner_task_group = std::shared_ptr<TaskGroup>{};
+
+  auto outer_task = std::make_shared<JobTask>([&]() {
+    // Executed on this thread, the exception must not leave the foreign group installed
+    auto throwing_task = std::make_shared<JobTask>([]() { throw std::logic_error("Failed"); });
+    throwing_task->set_task_group(std::make_shared<TaskGroup>());
+    EXPECT_THROW(throwing_task->execute(), std::logic_error);
+
+    auto inner_task = std::make_shared<JobTask>([]() {});
+    inner_task->schedule();
+    inner_task_group = inner_task->task_group();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{inner_task});
+  });
+  outer_task->set_task_group(task_group);
+  outer_task->schedule();
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(inner_task_group, task_group);
+}
+
+TEST_F(SchedulerTest, TaskGroupsAreServedFairly) {
+  TaskQueue queue(NodeID{0});
+
+  const auto analytical_group = std::make_shared<TaskGroup>();
+  const auto transactional_group = std::make_shared<TaskGroup>();
+
+  // The tasks of the transactional group arrive after a large number of JobTasks of the analytical group
+  auto make_task = [](const std::shared_ptr<TaskGroup>& group, const SchedulePriority priority) {
+    auto task = std::make_shared<JobTask>([]() {});
+    task->set_task_group(group);
+    return std::make_pair(task, priority);
+  };
+
+  for (auto task_idx = 0; task_idx < 100; ++task_idx) {
+    const auto [task, priority] = make_task(analytical_group, SchedulePriority::JobTask);
+    queue.push(task, static_cast<uint32_t>(priority));
+  }
+  for (auto task_idx = 0; task_idx < 2; ++task_idx) {
+    const auto [task, priority] = make_task(transactional_group, SchedulePriority::Default);
+    queue.push(task, static_cast<uint32_t>(priority));
+  }
+
+  // Both groups have the same weight, so they are served alternately, regardless of the tasks' priorities
+  auto pulled_groups = std::vector<std::shared_ptr<TaskGroup>>{};
+  for (auto task_idx = 0; task_idx < 4; ++task_idx) {
+    pulled_groups.emplace_back(queue.pull()->task_group());
+  }
+  EXPECT_EQ(std::count(pulled_groups.begin(), pulled_groups.end(), transactional_group), 2);
+
+  // A latency-critical group is served before all other groups
+  const auto latency_critical_group = std::make_shared<TaskGroup>(true);
+  const auto [latency_critical_task, priority] = make_task(latency_critical_group, SchedulePriority::Lowest);
+  queue.push(latency_critical_task, static_cast<uint32_t>(priority));
+  EXPECT_EQ(queue.pull(), latency_critical_task);
+
+  while (queue.pull()) {
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SchedulerTest, StarvingTaskGroupsArePromotedOnce) {
+  TaskQueue queue(NodeID{0});
+
+  // The light group has to wait for 100 tasks of the heavy group every time it is served
+  const auto heavy_group = std::make_shared<TaskGroup>(false, 100);
+  const auto light_group = std::make_shared<TaskGroup>();
+
+  auto push_task = [&](const std::shared_ptr<TaskGroup>& group) {
+    auto task = std::make_shared<JobTask>([]() {});
+    task->set_task_group(group);
+    queue.push(task, static_cast<uint32_t>(SchedulePriority::Default));
+  };
+
+  for (auto task_idx = 0; task_idx < 10; ++task_idx) {
+    push_task(heavy_group);
+  }
+  for (auto task_idx = 0; task_idx < 3; ++task_idx) {
+    push_task(light_group);
+  }
+
+  EXPECT_EQ(queue.pull()->task_group(), heavy_group);
+  EXPECT_EQ(queue.pull()->task_group(), light_group);
+  EXPECT_EQ(queue.pull()->task_group(), heavy_group);
+
+  // Both groups starve now. They are promoted, but still served after latency-critical groups.
+  std::this_thread::sleep_for(TaskQueue::STARVATION_THRESHOLD * 2);
+  const auto latency_critical_group = std::make_shared<TaskGroup>(true);
+  push_task(latency_critical_group);
+  EXPECT_EQ(queue.pull()->task_group(), latency_critical_group);
+
+  // Being served ends the promotion of the heavy group, so the light group is served next despite its higher pass
+  EXPECT_EQ(queue.pull()->task_group(), heavy_group);
+  EXPECT_EQ(queue.pull()->task_group(), light_group);
+
+  // Afterwards, neither group is promoted anymore
+  EXPECT_EQ(queue.pull()->task_group(), heavy_group);
+  EXPECT_EQ(queue.pull()->task_group(), heavy_group);
+
+  while (queue.pull()) {
+  }
+}
+
+TEST_F(SchedulerTest, LocalJobTasksAreAccountedToTheirGroup) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Both groups start with the same pass
+  const auto task_group = std::make_shared<TaskGroup>();
+  const auto reference_task_group = std::make_shared<TaskGroup>();
+
+  const auto run_task = [](const std::shared_ptr<TaskGroup>& group, const size_t job_count) {
+    auto task = std::make_shared<JobTask>([&]() {
+      auto jobs = std::vector<std::shared_ptr<JobTask>>{};
+      for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+        jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+        jobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(jobs);
+    });
+    task->set_task_group(group);
+    task->schedule();
+    task->join();
+  };
+
+  const auto initial_pass = reference_task_group->pass();
+  run_task(reference_task_group, 0);
+  run_task(task_group, 100);
+
+  // The JobTasks were taken from the local deques, but their group paid for them like for tasks from a TaskQueue
+  const auto stride = reference_task_group->pass() - initial_pass;
+  EXPECT_GT(stride, 0u);
+  EXPECT_EQ(task_group->pass() - initial_pass, 101 * stride);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, TaskPrioritiesAge) {
+  TaskQueue queue(NodeID{0});
+
+  const auto old_task = std::make_shared<JobTask>([]() {});
+  queue.push(old_task, static_cast<uint32_t>(SchedulePriority::Lowest));
+
+  // After waiting for more than two aging intervals, the task is treated as if it had the highest priority
+  std::this_thread::sleep_for(TaskQueue::AGING_INTERVAL * 3);
+
+  const auto new_task = std::make_shared<JobTask>([]() {});
+  queue.push(new_task, static_cast<uint32_t>(SchedulePriority::Default));
+
+  EXPECT_EQ(queue.pull(), old_task);
+  EXPECT_EQ(queue.pull(), new_task);
+}
+
+TEST_F(SchedulerTest, TasksInheritTaskGroup) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto task_group = std::make_shared<TaskGroup>();
+  auto inner_task_group = std::shared_ptr<TaskGroup>{};
+
+  auto outer_task = std::make_shared<JobTask>([&]() {
+    auto inner_task = std::make_shared<JobTask>([]() {});
+    CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{inner_task});
+    inner_task_group = inner_task->task_group();
+  });
+  outer_task->set_task_group(task_group);
+  outer_task->schedule();
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(inner_task_group, task_group);
+}
+
+TEST_F(SchedulerTest, WorkStealingDeque) {
+  WorkStealingDeque deque(2);
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_idx = 0; task_idx < 5; ++task_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    deque.push(tasks.back());
+  }
+  EXPECT_EQ(deque.size(), 5u);
+
+  // The owner takes the most recent task, thieves take the oldest one
+  EXPECT_EQ(deque.pop(), tasks[4]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(SchedulerTest, WorkStealingDequeConcurrentSteals) {
+  WorkStealingDeque deque;
+
+  constexpr auto NUM_TASKS = 20'000u;
+  auto counters = std::vector<std::atomic_uint>(NUM_TASKS);
+  auto num_taken_tasks = std::atomic_uint{0};
+
+  const auto run = [&](const std::shared_ptr<AbstractTask>& task) {
+    task->execute();
+    ++num_taken_tasks;
+  };
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_idx = 0; thief_idx < 3; ++thief_idx) {
+    thieves.emplace_back([&]() {
+      while (num_taken_tasks < NUM_TASKS) {
+        auto task = deque.steal();
+        if (task) run(task);
+      }
+    });
+  }
+
+  // The owner pushes all tasks and pops some of them, while the thieves steal the others
+  for (auto task_idx = 0u; task_idx < NUM_TASKS; ++task_idx) {
+    deque.push(std::make_shared<JobTask>([&, task_idx]() { ++counters[task_idx]; }));
+    if (task_idx % 3 == 0) {
+      auto task = deque.pop();
+      if (task) run(task);
+    }
+  }
+  while (auto task = deque.pop()) {
+    run(task);
+  }
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  // Every task was taken exactly once
+  for (const auto& counter : counters) {
+    EXPECT_EQ(counter, 1u);
+  }
+}
+
+TEST_F(SchedulerTest, JobTasksArePushedIntoLocalDeques) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  std::atomic_uint counter{0};
+  auto queues_were_empty = false;
+
+  auto outer_task = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::shared_ptr<JobTask>>{};
+    for (auto job_idx = 0; job_idx < 100; ++job_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+      jobs.back()->schedule();
+    }
+
+    // The JobTasks are executed by this worker or stolen by others, but were never added to a TaskQueue
+    const auto& queues = CurrentScheduler::get()->queues();
+    queues_were_empty = std::all_of(queues.begin(), queues.end(), [](const auto& queue) { return queue->empty(); });
+
+    CurrentScheduler::wait_for_tasks(jobs);
+  });
+  outer_task->schedule();
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_TRUE(queues_were_empty);
+  EXPECT_EQ(counter, 100u);
+}
+
 TEST_F(SchedulerTest, MultipleOperators) {
   Topology::use_fake_numa_topology(8, 4);
   CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -415,6 +416,24 @@ TEST_F(SQLPipelineStatementTest, GetTasksNotValidated) {
   EXPECT_FALSE(_contains_validate(tasks));
 }
 
+TEST_F(SQLPipelineStatementTest, GetTasksInTaskGroup) {
+  auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.mark_as_latency_critical().create_pipeline_statement();
+  const auto& tasks = sql_pipeline.get_tasks();
+
+  // All tasks of the statement share the same, latency-critical group
+  const auto task_group = tasks.front()->task_group();
+  ASSERT_TRUE(task_group);
+  EXPECT_TRUE(task_group->is_latency_critical());
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->task_group(), task_group);
+  }
+
+  const auto session_group = std::make_shared<TaskGroup>();
+  auto session_pipeline =
+      SQLPipelineBuilder{_select_query_a}.with_task_group(session_group).create_pipeline_statement();
+  EXPECT_EQ(session_pipeline.get_tasks().front()->task_group(), session_group);
+}
+
 TEST_F(SQLPipelineStatementTest, GetResultTable) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
   const auto& table = sql_pipeline.get_result_table();
@@ -453,6 +472,30 @@ TEST_F(SQLPipelineStatementTest, GetResultTableWithScheduler) {
   EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
 }
 
+TEST_F(SQLPipelineStatementTest, GetResultTableMorselDriven) {
+  const auto sql = "SELECT b, a FROM table_a WHERE a > 1000";
+  auto reference_pipeline = SQLPipelineBuilder{sql}.create_pipeline_statement();
+  const auto& expected_table = reference_pipeline.get_result_table();
+
+  auto sql_pipeline =
+      SQLPipelineBuilder{sql}.with_execution_mode(ExecutionMode::MorselDriven).create_pipeline_statement();
+
+  // Validate, TableScan and Projection are executed as a single pipeline
+  const auto& tasks = sql_pipeline.get_tasks();
+  const auto pipeline_task = std::find_if(tasks.begin(), tasks.end(),
+                                          [](const auto& task) { return !task->pipeline().empty(); });
+  ASSERT_NE(pipeline_task, tasks.end());
+  EXPECT_EQ((*pipeline_task)->pipeline().front()->type(), OperatorType::Validate);
+  EXPECT_EQ((*pipeline_task)->pipeline().back()->type(), OperatorType::Projection);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto& table = sql_pipeline.get_result_table();
+
+  EXPECT_TABLE_EQ_UNORDERED(table, expected_table);
+  EXPECT_EQ(table->row_count(), 2u);
+}
+
 TEST_F(SQLPipelineStatementTest, GetResultTableNoOutput) {
   const auto sql = "UPDATE table_a SET a = 1 WHERE a < 5";
   auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline_statement();
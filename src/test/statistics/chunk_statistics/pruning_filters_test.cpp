@@ -8,7 +8,9 @@
 
 #include "utils/assert.hpp"
 
+#include "statistics/chunk_statistics/bloom_filter.hpp"
 #include "statistics/chunk_statistics/min_max_filter.hpp"
+#include "statistics/chunk_statistics/prefix_filter.hpp"
 #include "statistics/chunk_statistics/range_filter.hpp"
 #include "types.hpp"
 
@@ -56,4 +58,62 @@ TEST_F(PruningFiltersTest, RangeFilterFloatTest) {
   EXPECT_EQ(true, filter->can_prune({-5.f}, PredicateCondition::LessThan));
 }
 
+TEST_F(PruningFiltersTest, BloomFilterTest) {
+  auto filter = BloomFilter<int>::build_filter(_values);
+
+  for (const auto value : _values) {
+    EXPECT_EQ(false, filter->can_prune({value}, PredicateCondition::Equals));
+  }
+
+  // Values that are not contained are pruned, except for rare false positives
+  auto pruned_count = 0;
+  for (auto value = 1'000; value < 2'000; ++value) {
+    if (filter->can_prune({value}, PredicateCondition::Equals)) ++pruned_count;
+  }
+  EXPECT_GT(pruned_count, 950);
+
+  // Only Equals predicates can be pruned
+  EXPECT_EQ(false, filter->can_prune({1'000}, PredicateCondition::NotEquals));
+  EXPECT_EQ(false, filter->can_prune({1'000}, PredicateCondition::LessThan));
+}
+
+TEST_F(PruningFiltersTest, BloomFilterStringTest) {
+  pmr_vector<std::string> values = {"apple", "apricot", "banana"};
+  auto filter = BloomFilter<std::string>::build_filter(values);
+
+  EXPECT_EQ(false, filter->can_prune({"apple"}, PredicateCondition::Equals));
+  EXPECT_EQ(false, filter->can_prune({"banana"}, PredicateCondition::Equals));
+  EXPECT_EQ(true, filter->can_prune({"cherry"}, PredicateCondition::Equals));
+}
+
+TEST_F(PruningFiltersTest, PrefixFilterTest) {
+  pmr_vector<std::string> values = {"apple", "apricot", "banana", "bo"};
+  auto filter = PrefixFilter::build_filter(values);
+
+  EXPECT_EQ(filter->prefixes(), (std::vector<std::string>{"appl", "apri", "bana", "bo"}));
+
+  EXPECT_EQ(false, filter->can_prune({"ap%"}, PredicateCondition::Like));
+  EXPECT_EQ(false, filter->can_prune({"apric%"}, PredicateCondition::Like));
+  EXPECT_EQ(false, filter->can_prune({"b_n%"}, PredicateCondition::Like));
+  EXPECT_EQ(false, filter->can_prune({"%cherry"}, PredicateCondition::Like));
+  EXPECT_EQ(true, filter->can_prune({"c%"}, PredicateCondition::Like));
+  EXPECT_EQ(true, filter->can_prune({"apro%"}, PredicateCondition::Like));
+  EXPECT_EQ(true, filter->can_prune({"bob%"}, PredicateCondition::Like));
+  EXPECT_EQ(false, filter->can_prune({"c%"}, PredicateCondition::NotLike));
+
+  EXPECT_EQ(false, filter->can_prune({"bo"}, PredicateCondition::Equals));
+  EXPECT_EQ(false, filter->can_prune({"applesauce"}, PredicateCondition::Equals));
+  EXPECT_EQ(true, filter->can_prune({"b"}, PredicateCondition::Equals));
+}
+
+TEST_F(PruningFiltersTest, PrefixFilterShortensPrefixes) {
+  pmr_vector<std::string> values = {"aa", "ab", "ba", "bb"};
+  auto filter = PrefixFilter::build_filter(values, 4, 2);
+
+  EXPECT_EQ(filter->prefix_length(), 1u);
+  EXPECT_EQ(filter->prefixes(), (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(false, filter->can_prune({"ac%"}, PredicateCondition::Like));
+  EXPECT_EQ(true, filter->can_prune({"c%"}, PredicateCondition::Like));
+}
+
 }  // namespace opossum
@@ -410,6 +410,46 @@ TEST_F(ColumnStatisticsTest, NonNullRatioTwoColumnTest) {
   EXPECT_FLOAT_EQ(result.selectivity, 0.8f * 0.85f * (1.f / 3.f + 1.f / 3.f * 1.f / 2.f));
 }
 
+TEST_F(ColumnStatisticsTest, HistogramTest) {
+  // Value 5 makes up 91% of the non-null values
+  const auto histogram = std::make_shared<EquiHeightHistogram<int32_t>>(std::vector<HistogramBin<int32_t>>{
+      {1, 4, 4.0f, 4.0f}, {5, 5, 91.0f, 1.0f}, {6, 10, 5.0f, 5.0f}});
+  const auto column_statistics = std::make_shared<ColumnStatistics<int32_t>>(0.5f, 10.0f, 1, 10, histogram);
+
+  auto result = column_statistics->estimate_predicate_with_value(PredicateCondition::Equals, AllTypeVariant(5));
+  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 0.91f);
+  result = column_statistics->estimate_predicate_with_value(PredicateCondition::Equals, AllTypeVariant(2));
+  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 0.01f);
+  result = column_statistics->estimate_predicate_with_value(PredicateCondition::NotEquals, AllTypeVariant(5));
+  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 0.09f);
+  result = column_statistics->estimate_predicate_with_value(PredicateCondition::LessThan, AllTypeVariant(5));
+  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 0.04f);
+  EXPECT_FLOAT_EQ(result.column_statistics->distinct_count(), 4.0f);
+
+  result = column_statistics->estimate_predicate_with_value(PredicateCondition::GreaterThanEquals, AllTypeVariant(5));
+  EXPECT_FLOAT_EQ(result.selectivity, 0.5f * 0.96f);
+
+  // The histogram is carried over to the statistics of the output
+  const auto output_statistics = std::dynamic_pointer_cast<ColumnStatistics<int32_t>>(result.column_statistics);
+  ASSERT_TRUE(output_statistics);
+  ASSERT_TRUE(output_statistics->histogram());
+  result = output_statistics->estimate_predicate_with_value(PredicateCondition::Equals, AllTypeVariant(5));
+  EXPECT_FLOAT_EQ(result.selectivity, 91.0f / 96.0f);
+}
+
+TEST_F(ColumnStatisticsTest, HistogramStringTest) {
+  const auto histogram = std::make_shared<EquiHeightHistogram<std::string>>(std::vector<HistogramBin<std::string>>{
+      {"a", "f", 10.0f, 5.0f}, {"g", "g", 80.0f, 1.0f}, {"h", "z", 10.0f, 10.0f}});
+  const auto column_statistics = std::make_shared<ColumnStatistics<std::string>>(0.0f, 16.0f, "a", "z", histogram);
+
+  auto result = column_statistics->estimate_predicate_with_value(PredicateCondition::Equals, AllTypeVariant("g"));
+  EXPECT_FLOAT_EQ(result.selectivity, 0.8f);
+  result = column_statistics->estimate_predicate_with_value(PredicateCondition::LessThan, AllTypeVariant("g"));
+  EXPECT_NEAR(result.selectivity, 0.1f, 0.0001f);
+  result = column_statistics->estimate_predicate_with_value(PredicateCondition::GreaterThanEquals, AllTypeVariant("g"));
+  EXPECT_FLOAT_EQ(result.selectivity, 0.9f);
+}
+
 TEST_F(ColumnStatisticsTest, Dummy) {
   {
     auto dummy_col_statistics = ColumnStatistics<int>::dummy();
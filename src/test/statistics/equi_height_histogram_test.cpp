@@ -0,0 +1,164 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "statistics/equi_height_histogram.hpp"
+
+namespace opossum {
+
+class EquiHeightHistogramTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // 1..100, each value once
+    for (auto value = int32_t{1}; value <= 100; ++value) {
+      _uniform_value_counts.emplace_back(value, size_t{1});
+    }
+
+    // 1..10, each value once except for 5, which makes up most of the rows
+    for (auto value = int32_t{1}; value <= 10; ++value) {
+      _skewed_value_counts.emplace_back(value, value == 5 ? size_t{91} : size_t{1});
+    }
+  }
+
+  std::vector<std::pair<int32_t, size_t>> _uniform_value_counts;
+  std::vector<std::pair<int32_t, size_t>> _skewed_value_counts;
+};
+
+TEST_F(EquiHeightHistogramTest, BinsHaveEqualHeight) {
+  const auto histogram = EquiHeightHistogram<int32_t>::from_value_counts(_uniform_value_counts, 10);
+
+  ASSERT_EQ(histogram->bins().size(), 10u);
+  EXPECT_EQ(histogram->bins()[0].min, 1);
+  EXPECT_EQ(histogram->bins()[0].max, 10);
+  EXPECT_EQ(histogram->bins()[9].min, 91);
+  EXPECT_EQ(histogram->bins()[9].max, 100);
+  for (const auto& bin : histogram->bins()) {
+    EXPECT_FLOAT_EQ(bin.height, 10.0f);
+    EXPECT_FLOAT_EQ(bin.distinct_count, 10.0f);
+  }
+
+  EXPECT_FLOAT_EQ(histogram->total_count(), 100.0f);
+  EXPECT_FLOAT_EQ(histogram->total_distinct_count(), 100.0f);
+}
+
+TEST_F(EquiHeightHistogramTest, HeavyValuesGetOwnBin) {
+  const auto histogram = EquiHeightHistogram<int32_t>::from_value_counts(_skewed_value_counts, 10);
+
+  ASSERT_EQ(histogram->bins().size(), 3u);
+  EXPECT_EQ(histogram->bins()[0].min, 1);
+  EXPECT_EQ(histogram->bins()[0].max, 4);
+  EXPECT_FLOAT_EQ(histogram->bins()[0].height, 4.0f);
+  EXPECT_EQ(histogram->bins()[1].min, 5);
+  EXPECT_EQ(histogram->bins()[1].max, 5);
+  EXPECT_FLOAT_EQ(histogram->bins()[1].height, 91.0f);
+  EXPECT_EQ(histogram->bins()[2].min, 6);
+  EXPECT_EQ(histogram->bins()[2].max, 10);
+  EXPECT_FLOAT_EQ(histogram->bins()[2].height, 5.0f);
+
+  EXPECT_FLOAT_EQ(histogram->estimate_count_equals(5), 91.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_equals(2), 1.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_equals(0), 0.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_equals(11), 0.0f);
+}
+
+TEST_F(EquiHeightHistogramTest, EstimateRange) {
+  const auto histogram = EquiHeightHistogram<int32_t>::from_value_counts(_uniform_value_counts, 10);
+
+  EXPECT_FLOAT_EQ(histogram->estimate_count_in_range(5, 14), 10.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_in_range(1, 100), 100.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_in_range(-10, 0), 0.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_distinct_count_in_range(91, 95), 5.0f);
+
+  const auto skewed_histogram = EquiHeightHistogram<int32_t>::from_value_counts(_skewed_value_counts, 10);
+  EXPECT_FLOAT_EQ(skewed_histogram->estimate_count_in_range(1, 5), 95.0f);
+  EXPECT_FLOAT_EQ(skewed_histogram->estimate_count_in_range(6, 10), 5.0f);
+}
+
+TEST_F(EquiHeightHistogramTest, EstimateRangeFloat) {
+  const auto histogram = std::make_shared<EquiHeightHistogram<float>>(
+      std::vector<HistogramBin<float>>{{0.0f, 10.0f, 100.0f, 50.0f}, {20.0f, 20.0f, 400.0f, 1.0f}});
+
+  EXPECT_FLOAT_EQ(histogram->estimate_count_in_range(0.0f, 5.0f), 50.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_in_range(5.0f, 30.0f), 450.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_equals(20.0f), 400.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_equals(15.0f), 0.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_equals(1.0f), 2.0f);
+}
+
+TEST_F(EquiHeightHistogramTest, EstimateRangeString) {
+  const auto histogram = std::make_shared<EquiHeightHistogram<std::string>>(std::vector<HistogramBin<std::string>>{
+      {"a", "f", 10.0f, 5.0f}, {"g", "g", 80.0f, 1.0f}, {"h", "z", 10.0f, 10.0f}});
+
+  // Partially covered bins count as half
+  EXPECT_FLOAT_EQ(histogram->estimate_count_in_range("c", "g"), 85.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_in_range("a", "g"), 90.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_equals("g"), 80.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_count_equals("b"), 2.0f);
+}
+
+TEST_F(EquiHeightHistogramTest, Sliced) {
+  const auto histogram = EquiHeightHistogram<int32_t>::from_value_counts(_uniform_value_counts, 10);
+  const auto sliced_histogram = histogram->sliced(5, 14);
+
+  ASSERT_TRUE(sliced_histogram);
+  ASSERT_EQ(sliced_histogram->bins().size(), 2u);
+  EXPECT_EQ(sliced_histogram->bins()[0].min, 5);
+  EXPECT_EQ(sliced_histogram->bins()[0].max, 10);
+  EXPECT_FLOAT_EQ(sliced_histogram->bins()[0].height, 6.0f);
+  EXPECT_EQ(sliced_histogram->bins()[1].min, 11);
+  EXPECT_EQ(sliced_histogram->bins()[1].max, 14);
+  EXPECT_FLOAT_EQ(sliced_histogram->bins()[1].height, 4.0f);
+
+  EXPECT_FALSE(histogram->sliced(101, 200));
+}
+
+TEST_F(EquiHeightHistogramTest, IsApproximatelyUniform) {
+  EXPECT_TRUE(EquiHeightHistogram<int32_t>::from_value_counts(_uniform_value_counts, 10)->is_approximately_uniform());
+  EXPECT_FALSE(EquiHeightHistogram<int32_t>::from_value_counts(_skewed_value_counts, 10)->is_approximately_uniform());
+
+  // All values are equally frequent, but clustered at both ends of [min, max]
+  auto clustered_value_counts = std::vector<std::pair<int32_t, size_t>>{};
+  for (auto value = int32_t{1}; value <= 50; ++value) {
+    clustered_value_counts.emplace_back(value, size_t{1});
+  }
+  for (auto value = int32_t{951}; value <= 1000; ++value) {
+    clustered_value_counts.emplace_back(value, size_t{1});
+  }
+  EXPECT_FALSE(EquiHeightHistogram<int32_t>::from_value_counts(clustered_value_counts, 10)->is_approximately_uniform());
+}
+
+TEST_F(EquiHeightHistogramTest, Merge) {
+  // Two parts of a column that share the values 41..60
+  auto left_value_counts = std::vector<std::pair<int32_t, size_t>>{};
+  for (auto value = int32_t{1}; value <= 60; ++value) {
+    left_value_counts.emplace_back(value, size_t{1});
+  }
+  auto right_value_counts = std::vector<std::pair<int32_t, size_t>>{};
+  for (auto value = int32_t{41}; value <= 100; ++value) {
+    right_value_counts.emplace_back(value, value == 50 ? size_t{40} : size_t{1});
+  }
+
+  const auto left = EquiHeightHistogram<int32_t>::from_value_counts(left_value_counts, 10);
+  const auto right = EquiHeightHistogram<int32_t>::from_value_counts(right_value_counts, 10);
+
+  const auto merged = EquiHeightHistogram<int32_t>::merge({left, nullptr, right}, 100.0f, 10);
+
+  EXPECT_FLOAT_EQ(merged->total_count(), 159.0f);
+  EXPECT_FLOAT_EQ(merged->total_distinct_count(), 100.0f);
+  EXPECT_EQ(merged->bins().front().min, 1);
+  EXPECT_EQ(merged->bins().back().max, 100);
+  EXPECT_FLOAT_EQ(merged->estimate_count_in_range(1, 100), 159.0f);
+
+  for (auto bin_id = size_t{1}; bin_id < merged->bins().size(); ++bin_id) {
+    EXPECT_LT(merged->bins()[bin_id - 1].max, merged->bins()[bin_id].min);
+  }
+
+  // The heavy value of the right part overlaps with a bin of the left one, so its rows are spread over the combined
+  // bin. They still end up in the right range.
+  EXPECT_GT(merged->estimate_count_in_range(41, 60), 2 * merged->estimate_count_in_range(1, 20));
+}
+
+}  // namespace opossum
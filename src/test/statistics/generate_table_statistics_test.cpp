@@ -1,9 +1,15 @@
+#include <memory>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "statistics/column_statistics.hpp"
+#include "statistics/generate_column_statistics.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "statistics_test_utils.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
@@ -24,4 +30,81 @@ TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsUnsampled) {
   EXPECT_FLOAT_COLUMN_STATISTICS(table_statistics.column_statistics().at(5), 0.0f, 150, -986.96f, 9983.38f);
 }
 
+TEST_F(GenerateTableStatisticsTest, GenerateHistogramForSkewedColumn) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int);
+
+  // Column a: 91 times the value 1, then 2..10 once each, spread over multiple chunks. Column b: 0..99
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 7);
+  for (auto row = int32_t{0}; row < 100; ++row) {
+    table->append({row < 91 ? 1 : row - 89, row});
+  }
+
+  const auto table_statistics = generate_table_statistics(*table);
+  ASSERT_EQ(table_statistics.column_statistics().size(), 2u);
+
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics.column_statistics().at(0), 0.0f, 10, 1, 10);
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics.column_statistics().at(1), 0.0f, 100, 0, 99);
+
+  const auto skewed_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(table_statistics.column_statistics().at(0));
+  ASSERT_TRUE(skewed_statistics->histogram());
+  EXPECT_FLOAT_EQ(skewed_statistics->estimate_equals_with_value(1).selectivity, 0.91f);
+  EXPECT_FLOAT_EQ(skewed_statistics->estimate_equals_with_value(5).selectivity, 0.01f);
+
+  // Uniformly distributed columns do not need a histogram
+  const auto uniform_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(table_statistics.column_statistics().at(1));
+  EXPECT_FALSE(uniform_statistics->histogram());
+}
+
+TEST_F(GenerateTableStatisticsTest, EstimateDistinctCountWithSketches) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+
+  // 10'000 distinct values, each present in two chunks
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row = int32_t{0}; row < 20'000; ++row) {
+    table->append({row % 10'000});
+  }
+
+  // With a threshold this low, the values are not counted exactly, but the chunks' sketches and histograms are merged
+  const auto column_statistics = std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(
+      generate_column_statistics<int32_t>(*table, ColumnID{0}, 100));
+  ASSERT_TRUE(column_statistics);
+
+  EXPECT_NEAR(column_statistics->distinct_count(), 10'000.0f, 500.0f);
+  EXPECT_EQ(column_statistics->min(), 0);
+  EXPECT_EQ(column_statistics->max(), 9'999);
+  EXPECT_FLOAT_EQ(column_statistics->null_value_ratio(), 0.0f);
+}
+
+TEST_F(GenerateTableStatisticsTest, ReuseStatisticsOfEncodedChunks) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row = int32_t{0}; row < 5'500; ++row) {
+    table->append({row});
+  }
+
+  // Encode all but the last, mutable chunk
+  auto chunk_ids = std::vector<ChunkID>{};
+  for (ChunkID chunk_id{0}; chunk_id + 1 < table->chunk_count(); ++chunk_id) {
+    chunk_ids.emplace_back(chunk_id);
+  }
+  ChunkEncoder::encode_chunks(table, chunk_ids, {EncodingType::Dictionary});
+
+  // The encoded chunks alone exceed the threshold, so their statistics are merged instead of scanning them
+  const auto column_statistics = std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(
+      generate_column_statistics<int32_t>(*table, ColumnID{0}, 100));
+  ASSERT_TRUE(column_statistics);
+
+  EXPECT_NEAR(column_statistics->distinct_count(), 5'500.0f, 275.0f);
+  EXPECT_EQ(column_statistics->min(), 0);
+  EXPECT_EQ(column_statistics->max(), 5'499);
+  EXPECT_FLOAT_EQ(column_statistics->null_value_ratio(), 0.0f);
+}
+
 }  // namespace opossum
@@ -0,0 +1,62 @@
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "statistics/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public ::testing::Test {};
+
+TEST_F(HyperLogLogTest, EmptySketch) { EXPECT_FLOAT_EQ(HyperLogLog{}.estimate(), 0.0f); }
+
+TEST_F(HyperLogLogTest, SmallCardinalityIsAlmostExact) {
+  auto sketch = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    sketch.add(value);
+    // Duplicates do not change the sketch
+    sketch.add(value);
+  }
+
+  EXPECT_NEAR(sketch.estimate(), 100.0f, 2.0f);
+}
+
+TEST_F(HyperLogLogTest, LargeCardinality) {
+  auto sketch = HyperLogLog{};
+  for (auto value = int64_t{0}; value < 1'000'000; ++value) {
+    sketch.add(value);
+  }
+
+  // Standard error is ~1.6%, allow for about three times that
+  EXPECT_NEAR(sketch.estimate(), 1'000'000.0f, 50'000.0f);
+}
+
+TEST_F(HyperLogLogTest, Strings) {
+  auto sketch = HyperLogLog{};
+  for (auto value = 0; value < 10'000; ++value) {
+    sketch.add(std::string{"value"} + std::to_string(value % 5'000));
+  }
+
+  EXPECT_NEAR(sketch.estimate(), 5'000.0f, 250.0f);
+}
+
+TEST_F(HyperLogLogTest, MergeEqualsUnion) {
+  auto left = HyperLogLog{};
+  auto right = HyperLogLog{};
+  auto combined = HyperLogLog{};
+
+  for (auto value = int32_t{0}; value < 20'000; ++value) {
+    left.add(value);
+    combined.add(value);
+  }
+  for (auto value = int32_t{10'000}; value < 30'000; ++value) {
+    right.add(value);
+    combined.add(value);
+  }
+
+  left.merge(right);
+  EXPECT_EQ(left.registers(), combined.registers());
+  EXPECT_NEAR(left.estimate(), 30'000.0f, 1'500.0f);
+}
+
+}  // namespace opossum
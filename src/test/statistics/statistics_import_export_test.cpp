@@ -5,6 +5,7 @@
 
 #include "base_test.hpp"
 #include "statistics/column_statistics.hpp"
+#include "statistics/equi_height_histogram.hpp"
 #include "statistics/statistics_import_export.hpp"
 #include "statistics/table_statistics.hpp"
 #include "statistics_test_utils.hpp"
@@ -44,4 +45,28 @@ TEST_F(StatisticsImportExportTest, EndToEnd) {
   EXPECT_STRING_COLUMN_STATISTICS(imported_table_statistics.column_statistics().at(4), 0.7f, 53.3f, "abc", "xyz");
 }
 
+TEST_F(StatisticsImportExportTest, Histogram) {
+  const auto histogram = std::make_shared<EquiHeightHistogram<int32_t>>(std::vector<HistogramBin<int32_t>>{
+      {1, 4, 4.0f, 4.0f}, {5, 5, 91.0f, 1.0f}, {6, 10, 5.0f, 5.0f}});
+  const auto column_statistics = std::make_shared<ColumnStatistics<int32_t>>(0.5f, 10.0f, 1, 10, histogram);
+
+  const auto imported_base_column_statistics = import_column_statistics(export_column_statistics(*column_statistics));
+  EXPECT_INT32_COLUMN_STATISTICS(imported_base_column_statistics, 0.5f, 10.0f, 1, 10);
+
+  const auto imported_column_statistics =
+      std::dynamic_pointer_cast<ColumnStatistics<int32_t>>(imported_base_column_statistics);
+  ASSERT_TRUE(imported_column_statistics->histogram());
+
+  const auto& bins = imported_column_statistics->histogram()->bins();
+  ASSERT_EQ(bins.size(), 3u);
+  EXPECT_EQ(bins[1].min, 5);
+  EXPECT_EQ(bins[1].max, 5);
+  EXPECT_FLOAT_EQ(bins[1].height, 91.0f);
+  EXPECT_FLOAT_EQ(bins[1].distinct_count, 1.0f);
+  EXPECT_EQ(bins[2].min, 6);
+  EXPECT_EQ(bins[2].max, 10);
+  EXPECT_FLOAT_EQ(bins[2].height, 5.0f);
+  EXPECT_FLOAT_EQ(bins[2].distinct_count, 5.0f);
+}
+
 }  // namespace opossum
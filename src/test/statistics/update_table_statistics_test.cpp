@@ -0,0 +1,75 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/abstract_task.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "statistics/update_table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class UpdateTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    _table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*_table)));
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(UpdateTableStatisticsTest, WithModifiedRows) {
+  const auto table_statistics = _table->table_statistics()->with_modified_rows(2.0f, 1.0f);
+
+  EXPECT_FLOAT_EQ(table_statistics.row_count(), 4.0f);
+  EXPECT_FLOAT_EQ(table_statistics.modified_row_count(), 3.0f);
+  EXPECT_FLOAT_EQ(table_statistics.drift(), 0.75f);
+  EXPECT_EQ(table_statistics.column_statistics(), _table->table_statistics()->column_statistics());
+
+  // The row count never becomes negative
+  EXPECT_FLOAT_EQ(table_statistics.with_modified_rows(0.0f, 10.0f).row_count(), 0.0f);
+}
+
+TEST_F(UpdateTableStatisticsTest, UpdateRowCount) {
+  const auto column_statistics = _table->table_statistics()->column_statistics();
+
+  update_table_statistics(_table, 1.0f, 0.0f, 10.0f);
+  update_table_statistics(_table, 0.0f, 2.0f, 10.0f);
+
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count(), 2.0f);
+  EXPECT_FLOAT_EQ(_table->table_statistics()->modified_row_count(), 3.0f);
+  EXPECT_EQ(_table->table_statistics()->column_statistics(), column_statistics);
+}
+
+TEST_F(UpdateTableStatisticsTest, RefreshOnDrift) {
+  // Deleting a single row out of three does not exceed the allowed drift, deleting the other two does. The statistics
+  // are regenerated then - without a scheduler, this happens right away.
+  update_table_statistics(_table, 0.0f, 1.0f, 0.5f);
+  EXPECT_FLOAT_EQ(_table->table_statistics()->modified_row_count(), 1.0f);
+
+  update_table_statistics(_table, 0.0f, 2.0f, 0.5f);
+  EXPECT_FLOAT_EQ(_table->table_statistics()->modified_row_count(), 0.0f);
+
+  // No rows were actually deleted
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count(), 3.0f);
+}
+
+TEST_F(UpdateTableStatisticsTest, TablesWithoutStatistics) {
+  _table->set_table_statistics(nullptr);
+  update_table_statistics(_table, 1.0f, 0.0f);
+  EXPECT_FALSE(_table->table_statistics());
+
+  const auto task = refresh_table_statistics(_table);
+  ASSERT_TRUE(task);
+  EXPECT_TRUE(task->is_done());
+  ASSERT_TRUE(_table->table_statistics());
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count(), 3.0f);
+
+  // Once a refresh is done, the table is no longer marked as pending
+  EXPECT_TRUE(refresh_table_statistics(_table));
+}
+
+}  // namespace opossum
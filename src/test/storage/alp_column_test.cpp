@@ -0,0 +1,165 @@
+#include <array>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/alp_column.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/column_encoding_utils.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+class StorageAlpColumnTest : public BaseTestWithParam<VectorCompressionType> {
+ protected:
+  template <typename T>
+  std::shared_ptr<const AlpColumn<T>> _encode(const std::shared_ptr<ValueColumn<T>>& value_column) {
+    const auto encoded_column =
+        encode_column(EncodingType::Alp, data_type_from_type<T>(), value_column, GetParam());
+    return std::dynamic_pointer_cast<const AlpColumn<T>>(encoded_column);
+  }
+
+  template <typename T>
+  void _expect_equal_values(const AlpColumn<T>& column, const ValueColumn<T>& value_column) {
+    ASSERT_EQ(column.size(), value_column.size());
+
+    auto iterable = create_iterable_from_column(column);
+    auto chunk_offset = ChunkOffset{0};
+    iterable.for_each([&](const auto& value) {
+      const auto expected_value = value_column.get_typed_value(chunk_offset);
+      const auto typed_value = column.get_typed_value(chunk_offset);
+
+      ASSERT_EQ(value.is_null(), !expected_value);
+      ASSERT_EQ(typed_value.has_value(), expected_value.has_value());
+      if (expected_value) {
+        // Compare the bits, so that NaN and -0.0 are covered as well
+        EXPECT_EQ(std::memcmp(&value.value(), &*expected_value, sizeof(T)), 0);
+        EXPECT_EQ(std::memcmp(&*typed_value, &*expected_value, sizeof(T)), 0);
+      }
+      ++chunk_offset;
+    });
+    EXPECT_EQ(chunk_offset, value_column.size());
+  }
+};
+
+INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, StorageAlpColumnTest,
+                        ::testing::Values(VectorCompressionType::SimdBp128,
+                                          VectorCompressionType::FixedSizeByteAligned));
+
+TEST_P(StorageAlpColumnTest, EncodesDecimals) {
+  // Sensor readings with two decimal places
+  auto value_column = std::make_shared<ValueColumn<double>>(true);
+  for (auto row = 0; row < 3'000; ++row) {
+    value_column->append(row % 17 == 0 ? NULL_VALUE : AllTypeVariant{static_cast<double>(row * 37 % 5'000) / 100.0});
+  }
+
+  const auto alp_column = _encode(value_column);
+  ASSERT_NE(alp_column, nullptr);
+
+  EXPECT_EQ(alp_column->blocks().size(), 3u);
+  EXPECT_EQ(alp_column->blocks()[0].exponent - alp_column->blocks()[0].factor, 2);
+  EXPECT_TRUE(alp_column->exception_offsets().empty());
+  EXPECT_LT(alp_column->estimate_memory_usage(), value_column->estimate_memory_usage() / 2);
+
+  _expect_equal_values(*alp_column, *value_column);
+}
+
+TEST_P(StorageAlpColumnTest, SpecialValuesBecomeExceptions) {
+  auto value_column = std::make_shared<ValueColumn<double>>(false);
+  for (auto row = 0; row < 100; ++row) value_column->append(row * 0.25);
+
+  value_column->values()[10] = std::numeric_limits<double>::quiet_NaN();
+  value_column->values()[20] = -0.0;
+  value_column->values()[30] = std::numeric_limits<double>::infinity();
+  value_column->values()[40] = 1e300;
+
+  const auto alp_column = _encode(value_column);
+  ASSERT_NE(alp_column, nullptr);
+
+  const auto expected_exception_offsets = pmr_vector<ChunkOffset>{10u, 20u, 30u, 40u};
+  EXPECT_EQ(alp_column->exception_offsets(), expected_exception_offsets);
+
+  // NaN is ignored by the minimum and maximum
+  EXPECT_EQ(alp_column->blocks()[0].minimum, -0.0);
+  EXPECT_EQ(alp_column->blocks()[0].maximum, std::numeric_limits<double>::infinity());
+
+  _expect_equal_values(*alp_column, *value_column);
+}
+
+TEST_P(StorageAlpColumnTest, EncodesFloats) {
+  auto value_column = std::make_shared<ValueColumn<float>>(true);
+  for (auto row = 0; row < 2'000; ++row) {
+    value_column->append(row % 10 == 0 ? NULL_VALUE : AllTypeVariant{static_cast<float>(row % 300 - 150) / 10.0f});
+  }
+
+  const auto alp_column = _encode(value_column);
+  ASSERT_NE(alp_column, nullptr);
+
+  EXPECT_LT(alp_column->estimate_memory_usage(), value_column->estimate_memory_usage());
+
+  _expect_equal_values(*alp_column, *value_column);
+}
+
+TEST_P(StorageAlpColumnTest, DecodesBlocks) {
+  auto value_column = std::make_shared<ValueColumn<double>>(false);
+  for (auto row = 0; row < 1'500; ++row) value_column->append(row % 3 == 0 ? 0.1 * row : row + 0.5);
+
+  const auto alp_column = _encode(value_column);
+  ASSERT_NE(alp_column, nullptr);
+
+  auto values = std::array<double, AlpColumn<double>::block_size>{};
+  resolve_compressed_vector_type(alp_column->offset_values(), [&](const auto& offset_values) {
+    auto decoder = offset_values.create_decoder();
+
+    EXPECT_EQ(alp_column->decode_block(0u, *decoder, values), 1'024u);
+    EXPECT_EQ(values[3], 0.1 * 3);
+    EXPECT_EQ(values[1'023], 1'023.5);
+
+    EXPECT_EQ(alp_column->decode_block(1u, *decoder, values), 476u);
+    EXPECT_EQ(values[0], 1'024.5);
+    EXPECT_EQ(values[475], 0.1 * 1'499);
+  });
+}
+
+TEST_P(StorageAlpColumnTest, ScanSkipsBlocks) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Double, true}}, TableType::Data, 5'000);
+  for (auto row = 0; row < 8'000; ++row) {
+    table->append({row % 100 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row * 0.5}});
+  }
+
+  auto encoded_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Double, true}},
+                                               TableType::Data, 5'000);
+  for (auto row = 0; row < 8'000; ++row) {
+    encoded_table->append({row % 100 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row * 0.5}});
+  }
+  ChunkEncoder::encode_all_chunks(encoded_table, {EncodingType::Alp, GetParam()});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    for (const auto value : {-1.0, 0.5, 512.0, 1'999.5, 2'500.25, 3'999.5, 5'000.0}) {
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, predicate_condition, value);
+      scan->execute();
+      auto encoded_scan = std::make_shared<TableScan>(encoded_table_wrapper, ColumnID{0}, predicate_condition, value);
+      encoded_scan->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(encoded_scan->get_output(), scan->get_output());
+    }
+  }
+}
+
+}  // namespace opossum
@@ -20,7 +20,7 @@ class AnyColumnIterableTest : public BaseTest {
 
   std::shared_ptr<ValueColumn<int32_t>> create_int_w_null_value_column() {
     auto values = pmr_concurrent_vector<int32_t>(row_count);
-    auto null_values = pmr_concurrent_vector<bool>(row_count);
+    auto null_values = NullValueVector(row_count);
 
     std::default_random_engine engine{};
     std::uniform_int_distribution<int32_t> dist{0u, 10u};
@@ -28,7 +28,7 @@ class AnyColumnIterableTest : public BaseTest {
 
     for (auto i = 0u; i < row_count; ++i) {
       values[i] = dist(engine);
-      null_values[i] = bernoulli_dist(engine);
+      null_values.set(i, bernoulli_dist(engine));
     }
 
     return std::make_shared<ValueColumn<int32_t>>(std::move(values), std::move(null_values));
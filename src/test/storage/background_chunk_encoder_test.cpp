@@ -0,0 +1,94 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "storage/background_chunk_encoder.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class BackgroundChunkEncoderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The chunk size leaves the last chunk incomplete
+    _table = load_table("src/test/tables/compression_input.tbl", 5u);
+    StorageManager::get().add_table("table", _table);
+
+    // The background thread should not get in the way of the explicit calls to encode_completed_chunks()
+    _options.check_interval = std::chrono::hours{1};
+  }
+
+  bool is_encoded(const ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<const BaseDictionaryColumn>(_table->get_chunk(chunk_id)->get_column(ColumnID{0}))
+        != nullptr;
+  }
+
+  std::shared_ptr<Table> _table;
+  BackgroundChunkEncoder::Options _options;
+};
+
+TEST_F(BackgroundChunkEncoderTest, EncodesCompletedChunks) {
+  auto encoder = BackgroundChunkEncoder{_options};
+
+  EXPECT_EQ(encoder.encode_completed_chunks(), 2u);
+  EXPECT_TRUE(is_encoded(ChunkID{0}));
+  EXPECT_TRUE(is_encoded(ChunkID{1}));
+  EXPECT_FALSE(is_encoded(ChunkID{2}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+
+  EXPECT_EQ(encoder.encode_completed_chunks(), 0u);
+}
+
+TEST_F(BackgroundChunkEncoderTest, SkipsChunksWithUncommittedInserts) {
+  auto encoder = BackgroundChunkEncoder{_options};
+  EXPECT_EQ(encoder.encode_completed_chunks(), 2u);
+
+  // Fills the last chunk and adds two more full chunks
+  auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  auto insert = std::make_shared<Insert>("table", get_table);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  ASSERT_EQ(_table->chunk_count(), 5u);
+
+  EXPECT_EQ(encoder.encode_completed_chunks(), 0u);
+
+  context->commit();
+
+  EXPECT_EQ(encoder.encode_completed_chunks(), 2u);
+  EXPECT_TRUE(is_encoded(ChunkID{2}));
+  EXPECT_TRUE(is_encoded(ChunkID{3}));
+  EXPECT_FALSE(is_encoded(ChunkID{4}));
+}
+
+TEST_F(BackgroundChunkEncoderTest, EncodesInBackground) {
+  _options.check_interval = std::chrono::milliseconds{1};
+  _options.core_share = 0.01f;
+  auto encoder = BackgroundChunkEncoder{_options};
+
+  for (auto attempt = 0; attempt < 1000 && !is_encoded(ChunkID{1}); ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  }
+
+  EXPECT_TRUE(is_encoded(ChunkID{0}));
+  EXPECT_TRUE(is_encoded(ChunkID{1}));
+}
+
+TEST_F(BackgroundChunkEncoderTest, InvalidOptions) {
+  _options.core_share = 0.0f;
+  EXPECT_THROW(BackgroundChunkEncoder{_options}, std::logic_error);
+
+  _options.core_share = 0.5f;
+  _options.encoding_spec = ColumnEncodingSpec{EncodingType::Unencoded};
+  EXPECT_THROW(BackgroundChunkEncoder{_options}, std::logic_error);
+}
+
+}  // namespace opossum
@@ -7,6 +7,9 @@
 #include "gtest/gtest.h"
 
 #include "all_type_variant.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/hyper_log_log.hpp"
 #include "storage/base_encoded_column.hpp"
 #include "storage/base_value_column.hpp"
 #include "storage/chunk.hpp"
@@ -146,4 +149,28 @@ TEST_F(ChunkEncoderTest, EncodeMultipleChunksUsingSameEncoding) {
   verify_encoding(_table->get_chunk(ChunkID{1u}), unencoded_chunk_spec);
 }
 
+TEST_F(ChunkEncoderTest, BuildsMergeableStatistics) {
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{{EncodingType::Dictionary}, {EncodingType::RunLength}, {EncodingType::Unencoded}};
+
+  auto chunk = _table->get_chunk(ChunkID{1u});
+  ChunkEncoder::encode_chunk(chunk, _table->column_data_types(), chunk_encoding_spec);
+
+  ASSERT_TRUE(chunk->statistics());
+  for (const auto& chunk_column_statistics : chunk->statistics()->statistics()) {
+    ASSERT_TRUE(chunk_column_statistics->distinct_count_sketch());
+    EXPECT_NEAR(chunk_column_statistics->distinct_count_sketch()->estimate(), 5.0f, 0.1f);
+
+    const auto column_statistics =
+        std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(chunk_column_statistics->column_statistics());
+    ASSERT_TRUE(column_statistics);
+    EXPECT_FLOAT_EQ(column_statistics->distinct_count(), 5.0f);
+    EXPECT_FLOAT_EQ(column_statistics->null_value_ratio(), 0.0f);
+    EXPECT_EQ(column_statistics->min(), 5);
+    EXPECT_EQ(column_statistics->max(), 9);
+    ASSERT_TRUE(column_statistics->histogram());
+    EXPECT_FLOAT_EQ(column_statistics->histogram()->total_count(), 5.0f);
+  }
+}
+
 }  // namespace opossum
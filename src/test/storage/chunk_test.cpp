@@ -188,4 +188,22 @@ TEST_F(StorageChunkTest, RemoveIndex) {
   EXPECT_EQ(std::find(ind_col_0.cbegin(), ind_col_0.cend(), index_str), ind_col_0.cend());
 }
 
+TEST_F(StorageChunkTest, MarkImmutableMakesValueColumnsContiguous) {
+  c = std::make_shared<Chunk>(ChunkColumns({vc_int, dc_str}));
+  c->mark_immutable();
+
+  EXPECT_FALSE(c->is_mutable());
+  EXPECT_EQ(c->get_column(ColumnID{1}), dc_str);
+
+  const auto contiguous_column = std::dynamic_pointer_cast<const ValueColumn<int32_t>>(c->get_column(ColumnID{0}));
+  ASSERT_NE(contiguous_column, nullptr);
+  EXPECT_NE(contiguous_column, vc_int);
+  EXPECT_TRUE(contiguous_column->is_contiguous());
+  EXPECT_EQ(contiguous_column->contiguous_values(), (pmr_vector<int32_t>{4, 6, 3}));
+
+  // The replaced column is left untouched for operators that still read it
+  EXPECT_FALSE(vc_int->is_contiguous());
+  EXPECT_EQ(vc_int->size(), 3u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,83 @@
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/column_encoding_utils.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/delta_column.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageDeltaColumnTest : public BaseTestWithParam<VectorCompressionType> {};
+
+INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, StorageDeltaColumnTest,
+                        ::testing::Values(VectorCompressionType::SimdBp128,
+                                          VectorCompressionType::FixedSizeByteAligned));
+
+TEST_P(StorageDeltaColumnTest, ZigZagEncodesDifferences) {
+  EXPECT_EQ(DeltaColumn<int32_t>::encode_difference(5, 5), 0u);
+  EXPECT_EQ(DeltaColumn<int32_t>::encode_difference(5, 4), 1u);
+  EXPECT_EQ(DeltaColumn<int32_t>::encode_difference(5, 6), 2u);
+  EXPECT_EQ(DeltaColumn<int32_t>::encode_difference(5, 3), 3u);
+
+  const auto min = std::numeric_limits<int64_t>::min();
+  const auto max = std::numeric_limits<int64_t>::max();
+  EXPECT_EQ(DeltaColumn<int64_t>::apply_difference(max, DeltaColumn<int64_t>::encode_difference(max, max - 7)),
+            max - 7);
+  EXPECT_EQ(DeltaColumn<int64_t>::apply_difference(min, DeltaColumn<int64_t>::encode_difference(min, min + 7)),
+            min + 7);
+}
+
+TEST_P(StorageDeltaColumnTest, EncodesTimestamps) {
+  // Microsecond timestamps: large values, but small and mostly positive steps
+  auto value_column = std::make_shared<ValueColumn<int64_t>>(true);
+  auto timestamp = int64_t{1'500'000'000'000'000};
+  for (auto row = 0; row < 1'000; ++row) {
+    timestamp += (row % 7 == 0) ? -3 : 1'000 + row % 13;
+    value_column->append(row % 100 == 50 ? NULL_VALUE : AllTypeVariant{timestamp});
+  }
+
+  const auto encoded_column = encode_column(EncodingType::Delta, DataType::Long, value_column, GetParam());
+  const auto delta_column = std::dynamic_pointer_cast<const DeltaColumn<int64_t>>(encoded_column);
+  ASSERT_NE(delta_column, nullptr);
+
+  EXPECT_EQ(delta_column->size(), value_column->size());
+  EXPECT_EQ(delta_column->block_bases().size(), 8u);
+  EXPECT_LT(delta_column->estimate_memory_usage(), value_column->estimate_memory_usage());
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_column->size(); ++chunk_offset) {
+    EXPECT_EQ(delta_column->get_typed_value(chunk_offset), value_column->get_typed_value(chunk_offset));
+  }
+
+  auto iterable = create_iterable_from_column(*delta_column);
+  auto chunk_offset = ChunkOffset{0};
+  iterable.for_each([&](const auto& value) {
+    EXPECT_EQ(value.is_null(), variant_is_null((*value_column)[chunk_offset]));
+    if (!value.is_null()) EXPECT_EQ(value.value(), value_column->values()[chunk_offset]);
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, value_column->size());
+}
+
+TEST_P(StorageDeltaColumnTest, BlockStartingWithNulls) {
+  auto value_column = std::make_shared<ValueColumn<int32_t>>(true);
+  for (auto row = 0; row < 200; ++row) {
+    value_column->append(row < 130 ? NULL_VALUE : AllTypeVariant{-row});
+  }
+
+  const auto encoded_column = encode_column(EncodingType::Delta, DataType::Int, value_column, GetParam());
+  const auto delta_column = std::dynamic_pointer_cast<const DeltaColumn<int32_t>>(encoded_column);
+  ASSERT_NE(delta_column, nullptr);
+
+  EXPECT_EQ(delta_column->block_bases()[0], 0);
+  EXPECT_EQ(delta_column->block_bases()[1], -130);
+  EXPECT_FALSE(delta_column->get_typed_value(ChunkOffset{129}));
+  EXPECT_EQ(delta_column->get_typed_value(ChunkOffset{130}), -130);
+  EXPECT_EQ(delta_column->get_typed_value(ChunkOffset{199}), -199);
+}
+
+}  // namespace opossum
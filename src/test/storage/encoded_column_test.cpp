@@ -35,6 +35,9 @@ class EncodedColumnTest : public BaseTestWithParam<ColumnEncodingSpec> {
       case EncodingType::FrameOfReference:
         // fill three blocks and a bit more
         return FrameOfReferenceColumn<int32_t>::block_size * (3.3);
+      case EncodingType::PatchedFrameOfReference:
+        // fill three blocks and a bit more
+        return PatchedFrameOfReferenceColumn<int32_t>::block_size * (3.3);
       default:
         return default_row_count;
     }
@@ -55,7 +58,7 @@ class EncodedColumnTest : public BaseTestWithParam<ColumnEncodingSpec> {
 
   std::shared_ptr<ValueColumn<int32_t>> create_int_w_null_value_column() {
     auto values = pmr_concurrent_vector<int32_t>(row_count());
-    auto null_values = pmr_concurrent_vector<bool>(row_count());
+    auto null_values = NullValueVector(row_count());
 
     std::default_random_engine engine{};
     std::uniform_int_distribution<int32_t> dist{0u, max_value};
@@ -63,7 +66,7 @@ class EncodedColumnTest : public BaseTestWithParam<ColumnEncodingSpec> {
 
     for (auto i = 0u; i < row_count(); ++i) {
       values[i] = dist(engine);
-      null_values[i] = bernoulli_dist(engine);
+      null_values.set(i, bernoulli_dist(engine));
     }
 
     return std::make_shared<ValueColumn<int32_t>>(std::move(values), std::move(null_values));
@@ -124,6 +127,11 @@ INSTANTIATE_TEST_CASE_P(
                       ColumnEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
                       ColumnEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128},
                       ColumnEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedSizeByteAligned},
+                      ColumnEncodingSpec{EncodingType::Delta, VectorCompressionType::SimdBp128},
+                      ColumnEncodingSpec{EncodingType::Delta, VectorCompressionType::FixedSizeByteAligned},
+                      ColumnEncodingSpec{EncodingType::PatchedFrameOfReference, VectorCompressionType::SimdBp128},
+                      ColumnEncodingSpec{EncodingType::PatchedFrameOfReference,
+                                         VectorCompressionType::FixedSizeByteAligned},
                       ColumnEncodingSpec{EncodingType::RunLength}),
     formatter);
 
@@ -168,6 +176,9 @@ TEST_P(EncodedColumnTest, SequentiallyReadNullableIntColumn) {
             EXPECT_EQ((*value_column)[row_idx], encoded_column[row_idx]);
           }
 
+          // This covers `EncodedColumn::get_typed_value`
+          EXPECT_EQ(value_column->get_typed_value(row_idx), encoded_column.get_typed_value(row_idx));
+
           // This covers the point access iterator
           EXPECT_EQ(value_column_it->is_null(), encoded_column_it->is_null());
 
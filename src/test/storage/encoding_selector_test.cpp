@@ -0,0 +1,144 @@
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/base_encoded_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_selector.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class EncodingSelectorTest : public BaseTest {
+ protected:
+  static constexpr auto row_count = 20'000;
+
+  std::shared_ptr<ValueColumn<int32_t>> _create_int_column(const std::function<int32_t(int32_t)>& generator) {
+    auto values = pmr_concurrent_vector<int32_t>(row_count);
+    for (auto row = 0; row < row_count; ++row) values[row] = generator(row);
+    return std::make_shared<ValueColumn<int32_t>>(std::move(values));
+  }
+};
+
+TEST_F(EncodingSelectorTest, CharacterizesColumns) {
+  auto column = std::make_shared<ValueColumn<int32_t>>(true);
+  for (auto row = 0; row < 100; ++row) {
+    column->append(row % 10 == 0 ? NULL_VALUE : AllTypeVariant{row / 10});
+  }
+
+  const auto characteristics = EncodingSelector::characterize(*column);
+  EXPECT_EQ(characteristics.row_count, 100u);
+  EXPECT_EQ(characteristics.null_count, 10u);
+  EXPECT_EQ(characteristics.distinct_count, 10u);
+  // Each group of ten rows starts with a NULL run followed by a run of the same value
+  EXPECT_EQ(characteristics.run_count, 20u);
+  ASSERT_TRUE(characteristics.max_block_range);
+  EXPECT_EQ(*characteristics.max_block_range, 9u);
+  // NULLs are skipped, the largest step is from one group to the next (zig-zag encoded: 1 -> 2)
+  ASSERT_TRUE(characteristics.max_difference);
+  EXPECT_EQ(*characteristics.max_difference, 2u);
+}
+
+TEST_F(EncodingSelectorTest, CharacterizesStringColumns) {
+  auto column = std::make_shared<ValueColumn<std::string>>(pmr_concurrent_vector<std::string>{"a", "bbb", "cc", "a"});
+
+  const auto characteristics = EncodingSelector::characterize(*column);
+  EXPECT_EQ(characteristics.distinct_count, 3u);
+  EXPECT_EQ(characteristics.max_string_length, 3u);
+  EXPECT_FLOAT_EQ(characteristics.avg_string_length, 7.0f / 4.0f);
+  // "a", "bbb" and "cc" share no prefixes, so front coding needs more than their two characters on average
+  EXPECT_GT(characteristics.avg_front_coded_string_size, 2.0f);
+  EXPECT_FALSE(characteristics.max_block_range);
+  EXPECT_FALSE(characteristics.max_difference);
+  EXPECT_FALSE(characteristics.alp_max_offset);
+}
+
+TEST_F(EncodingSelectorTest, SelectsRunLengthForLongRuns) {
+  const auto column = _create_int_column([](auto row) { return row / 1'000; });
+  EXPECT_EQ(EncodingSelector{}.select(*column).encoding_type, EncodingType::RunLength);
+}
+
+TEST_F(EncodingSelectorTest, SelectsDictionaryForFewDistinctValues) {
+  const auto column = _create_int_column([](auto row) { return (row * 7'919) % 13 * 1'000'000; });
+  EXPECT_EQ(EncodingSelector{}.select(*column).encoding_type, EncodingType::Dictionary);
+}
+
+TEST_F(EncodingSelectorTest, SelectsFrameOfReferenceForManyDistinctValues) {
+  const auto column = _create_int_column([](auto row) { return (row * 7'919) % row_count; });
+  EXPECT_EQ(EncodingSelector{}.select(*column).encoding_type, EncodingType::FrameOfReference);
+}
+
+TEST_F(EncodingSelectorTest, SelectsDeltaForAscendingValues) {
+  const auto column = _create_int_column([](auto row) { return 1'000'000'000 + row * 3; });
+  EXPECT_EQ(EncodingSelector{1.0f}.select(*column).encoding_type, EncodingType::Delta);
+}
+
+TEST_F(EncodingSelectorTest, SelectsAlpForDecimals) {
+  auto values = pmr_concurrent_vector<double>(row_count);
+  for (auto row = 0; row < row_count; ++row) values[row] = static_cast<double>((row * 7'919) % row_count) / 100.0;
+  const auto column = std::make_shared<ValueColumn<double>>(std::move(values));
+
+  const auto characteristics = EncodingSelector::characterize(*column);
+  ASSERT_TRUE(characteristics.alp_max_offset);
+  EXPECT_FLOAT_EQ(characteristics.alp_exception_ratio, 0.0f);
+
+  EXPECT_EQ(EncodingSelector{}.select(*column).encoding_type, EncodingType::Alp);
+}
+
+TEST_F(EncodingSelectorTest, SelectsFixedStringDictionaryForShortStrings) {
+  auto values = pmr_concurrent_vector<std::string>(row_count);
+  for (auto row = 0; row < row_count; ++row) values[row] = std::to_string((row * 7'919) % 100);
+  const auto column = std::make_shared<ValueColumn<std::string>>(std::move(values));
+
+  EXPECT_EQ(EncodingSelector{}.select(*column).encoding_type, EncodingType::FixedStringDictionary);
+}
+
+TEST_F(EncodingSelectorTest, SelectsFrontCodedDictionaryForUrls) {
+  auto values = pmr_concurrent_vector<std::string>(row_count);
+  for (auto row = 0; row < row_count; ++row) {
+    values[row] = "https://www.example.com/products/" + std::to_string((row * 7'919) % 5'000) + "/reviews";
+  }
+  const auto column = std::make_shared<ValueColumn<std::string>>(std::move(values));
+
+  const auto characteristics = EncodingSelector::characterize(*column);
+  EXPECT_LT(characteristics.avg_front_coded_string_size, characteristics.avg_string_length / 2.0f);
+
+  EXPECT_EQ(EncodingSelector{}.select(*column).encoding_type, EncodingType::FrontCodedDictionary);
+}
+
+TEST_F(EncodingSelectorTest, MemoryWeightTradesSizeForScanSpeed) {
+  const auto column = _create_int_column([](auto row) { return (row * 7'919) % row_count; });
+
+  const auto smallest_spec = EncodingSelector{1.0f}.select(*column);
+  EXPECT_EQ(smallest_spec.vector_compression_type, VectorCompressionType::SimdBp128);
+
+  const auto fastest_spec = EncodingSelector{0.0f}.select(*column);
+  EXPECT_EQ(fastest_spec.vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+}
+
+TEST_F(EncodingSelectorTest, InvalidMemoryWeight) {
+  EXPECT_THROW(EncodingSelector{1.5f}, std::logic_error);
+}
+
+TEST_F(EncodingSelectorTest, ChunkEncoderResolvesAuto) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::String}},
+                                       TableType::Data);
+  for (auto row = 0; row < 100; ++row) table->append({row / 50, std::to_string(row)});
+
+  ChunkEncoder::encode_all_chunks(table, ColumnEncodingSpec{EncodingType::Auto});
+
+  const auto chunk = table->get_chunk(ChunkID{0});
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto encoded_column = std::dynamic_pointer_cast<const BaseEncodedColumn>(chunk->get_column(column_id));
+    ASSERT_TRUE(encoded_column);
+    EXPECT_NE(encoded_column->encoding_type(), EncodingType::Unencoded);
+  }
+}
+
+}  // namespace opossum
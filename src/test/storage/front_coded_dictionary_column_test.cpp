@@ -0,0 +1,144 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/column_encoding_utils.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionaryColumnTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueColumn<std::string>> vc_str = std::make_shared<ValueColumn<std::string>>();
+
+  void _append_urls() {
+    for (auto row = 0; row < 1'000; ++row) {
+      vc_str->append("https://www.example.com/user/" + std::to_string(row * 7'919 % 500) + "/profile");
+    }
+  }
+};
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, CompressColumnString) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Steve");
+  vc_str->append("Hasso");
+  vc_str->append("Bill");
+
+  auto col = encode_column(EncodingType::FrontCodedDictionary, DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(col);
+  ASSERT_NE(dict_col, nullptr);
+
+  // Test attribute_vector size
+  EXPECT_EQ(dict_col->size(), 6u);
+  EXPECT_EQ(dict_col->attribute_vector()->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dict_col->unique_values_count(), 4u);
+
+  // Test sorting
+  auto dict = dict_col->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Hasso");
+  EXPECT_EQ((*dict)[3], "Steve");
+}
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, Decode) {
+  _append_urls();
+
+  auto col = encode_column(EncodingType::FrontCodedDictionary, DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(col);
+
+  EXPECT_EQ(dict_col->encoding_type(), EncodingType::FrontCodedDictionary);
+  EXPECT_EQ(dict_col->compressed_vector_type(), CompressedVectorType::FixedSize2ByteAligned);
+  EXPECT_EQ(dict_col->unique_values_count(), 500u);
+
+  auto chunk_offset = ChunkOffset{0};
+  create_iterable_from_column(*dict_col).for_each([&](const auto& value) {
+    EXPECT_FALSE(value.is_null());
+    EXPECT_EQ(value.value(), vc_str->values()[chunk_offset]);
+    EXPECT_EQ(dict_col->get_typed_value(chunk_offset), vc_str->values()[chunk_offset]);
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, 1'000u);
+}
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, CopyUsingAlloctor) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+
+  auto col = encode_column(EncodingType::FrontCodedDictionary, DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(col);
+
+  auto alloc = PolymorphicAllocator<size_t>{};
+  auto base_column = dict_col->copy_using_allocator(alloc);
+  auto dict_col_copy = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(base_column);
+  ASSERT_NE(dict_col_copy, nullptr);
+
+  auto dict = dict_col_copy->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Steve");
+  EXPECT_EQ((*dict_col_copy)[1], AllTypeVariant("Steve"));
+}
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, LowerUpperBound) {
+  _append_urls();
+
+  auto col = encode_column(EncodingType::FrontCodedDictionary, DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(col);
+
+  // The dictionary is ordered as strings, i.e., "user/10/..." comes before "user/100/..."
+  const auto dict = dict_col->dictionary();
+  for (auto value_id = ValueID{0}; value_id < dict->size(); ++value_id) {
+    EXPECT_EQ(dict_col->lower_bound(AllTypeVariant((*dict)[value_id])), value_id);
+    EXPECT_EQ(dict_col->upper_bound(AllTypeVariant((*dict)[value_id])), value_id + 1u < dict->size()
+                                                                            ? ValueID{value_id + 1u}
+                                                                            : INVALID_VALUE_ID);
+  }
+
+  EXPECT_EQ(dict_col->lower_bound(AllTypeVariant("https://www.example.com/user/10/")), ValueID{2});
+  EXPECT_EQ(dict_col->upper_bound(AllTypeVariant("https://www.example.com/user/10/")), ValueID{2});
+
+  EXPECT_EQ(dict_col->lower_bound(AllTypeVariant("https://www.example.com/user/99/profile")), ValueID{499});
+  EXPECT_EQ(dict_col->lower_bound(AllTypeVariant("z")), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->upper_bound(AllTypeVariant("z")), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, NullValues) {
+  std::shared_ptr<ValueColumn<std::string>> vc_str = std::make_shared<ValueColumn<std::string>>(true);
+
+  vc_str->append("A");
+  vc_str->append(NULL_VALUE);
+  vc_str->append("E");
+
+  auto col = encode_column(EncodingType::FrontCodedDictionary, DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(col);
+
+  EXPECT_EQ(dict_col->null_value_id(), 2u);
+  EXPECT_TRUE(variant_is_null((*dict_col)[1]));
+  EXPECT_EQ((*dict_col)[2], AllTypeVariant("E"));
+}
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, MemoryUsageEstimation) {
+  _append_urls();
+
+  const auto front_coded_column = encode_column(EncodingType::FrontCodedDictionary, DataType::String, vc_str);
+  const auto dictionary_column = encode_column(EncodingType::Dictionary, DataType::String, vc_str);
+
+  // Neighboring URLs share most of their characters. The estimation of the DictionaryColumn does not even include the
+  // characters of the (long) strings.
+  EXPECT_LT(front_coded_column->estimate_memory_usage(), dictionary_column->estimate_memory_usage());
+}
+
+}  // namespace opossum
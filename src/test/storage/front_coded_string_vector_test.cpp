@@ -0,0 +1,99 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/front_coded_dictionary_column/front_coded_string_vector.hpp"
+
+namespace opossum {
+
+class FrontCodedStringVectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 100 URLs in three blocks that share long prefixes, preceded by the empty string
+    strings.emplace_back("");
+    for (auto index = 0; index < 100; ++index) {
+      strings.emplace_back("https://www.example.com/" + std::string{index < 50 ? "products/" : "users/"} +
+                           std::to_string(1'000 + index));
+    }
+    front_coded_string_vector = std::make_shared<FrontCodedStringVector>(strings);
+  }
+
+  pmr_vector<std::string> strings;
+  std::shared_ptr<FrontCodedStringVector> front_coded_string_vector = nullptr;
+};
+
+TEST_F(FrontCodedStringVectorTest, GetStringAt) {
+  EXPECT_EQ(front_coded_string_vector->size(), 101u);
+
+  for (auto pos = size_t{0u}; pos < strings.size(); ++pos) {
+    EXPECT_EQ(front_coded_string_vector->get_string_at(pos), strings[pos]);
+  }
+}
+
+TEST_F(FrontCodedStringVectorTest, ForEach) {
+  auto decoded_strings = std::vector<std::string>{};
+  front_coded_string_vector->for_each([&](const std::string& string) { decoded_strings.push_back(string); });
+
+  EXPECT_EQ(decoded_strings, std::vector<std::string>(strings.cbegin(), strings.cend()));
+  EXPECT_EQ(*front_coded_string_vector->dictionary(), strings);
+}
+
+TEST_F(FrontCodedStringVectorTest, LowerUpperBound) {
+  for (auto pos = size_t{0u}; pos < strings.size(); ++pos) {
+    EXPECT_EQ(front_coded_string_vector->lower_bound(strings[pos]), pos);
+    EXPECT_EQ(front_coded_string_vector->upper_bound(strings[pos]), pos + 1u);
+  }
+
+  EXPECT_EQ(front_coded_string_vector->lower_bound("https://www.example.com/products/10205"), 22u);
+  EXPECT_EQ(front_coded_string_vector->upper_bound("https://www.example.com/products/10205"), 22u);
+  EXPECT_EQ(front_coded_string_vector->lower_bound("a"), 1u);
+  EXPECT_EQ(front_coded_string_vector->lower_bound("z"), 101u);
+  EXPECT_EQ(front_coded_string_vector->upper_bound("z"), 101u);
+}
+
+TEST_F(FrontCodedStringVectorTest, PrefixRange) {
+  EXPECT_EQ(front_coded_string_vector->prefix_range(""), std::make_pair(size_t{0u}, size_t{101u}));
+  EXPECT_EQ(front_coded_string_vector->prefix_range("https://"), std::make_pair(size_t{1u}, size_t{101u}));
+  EXPECT_EQ(front_coded_string_vector->prefix_range("https://www.example.com/products/"),
+            std::make_pair(size_t{1u}, size_t{51u}));
+  EXPECT_EQ(front_coded_string_vector->prefix_range("https://www.example.com/users/107"),
+            std::make_pair(size_t{71u}, size_t{81u}));
+  EXPECT_EQ(front_coded_string_vector->prefix_range("https://www.example.com/users/1099"),
+            std::make_pair(size_t{100u}, size_t{101u}));
+
+  const auto [first, last] = front_coded_string_vector->prefix_range("ftp://");
+  EXPECT_EQ(first, last);
+}
+
+TEST_F(FrontCodedStringVectorTest, LongStrings) {
+  // Lengths of 128 and more need more than one byte
+  const auto long_strings = pmr_vector<std::string>{
+      std::string(200, 'a'), std::string(200, 'a') + std::string(300, 'b'), std::string(1'000, 'c')};
+  const auto long_string_vector = FrontCodedStringVector{long_strings};
+
+  EXPECT_EQ(long_string_vector.get_string_at(0u), long_strings[0]);
+  EXPECT_EQ(long_string_vector.get_string_at(1u), long_strings[1]);
+  EXPECT_EQ(long_string_vector.get_string_at(2u), long_strings[2]);
+  EXPECT_EQ(long_string_vector.lower_bound(std::string(250, 'a')), 1u);
+}
+
+TEST_F(FrontCodedStringVectorTest, Empty) {
+  const auto empty_string_vector = FrontCodedStringVector{pmr_vector<std::string>{}};
+
+  EXPECT_EQ(empty_string_vector.size(), 0u);
+  EXPECT_EQ(empty_string_vector.lower_bound("a"), 0u);
+  EXPECT_EQ(empty_string_vector.upper_bound("a"), 0u);
+  EXPECT_TRUE(empty_string_vector.dictionary()->empty());
+}
+
+TEST_F(FrontCodedStringVectorTest, DataSize) {
+  auto string_size_sum = size_t{0u};
+  for (const auto& string : strings) string_size_sum += string.size();
+
+  EXPECT_LT(front_coded_string_vector->data_size(), string_size_sum / 2u);
+}
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -216,6 +217,31 @@ TEST_F(IterablesTest, ReferenceColumnIteratorWithIterators) {
   EXPECT_EQ(sum, 24'825u);
 }
 
+TEST_F(IterablesTest, ReferenceColumnIteratorWithIteratorsMultipleChunks) {
+  // Chunk 0 stays a ValueColumn, chunk 1 is dictionary-encoded: {12345, 123}, {NULL, 1234}
+  auto table_with_null_chunked = load_table("src/test/tables/int_float_with_null.tbl", 2);
+  ChunkEncoder::encode_chunks(table_with_null_chunked, {ChunkID{1u}}, {EncodingType::Dictionary});
+
+  auto pos_list = PosList{RowID{ChunkID{1u}, 1u}, NULL_ROW_ID, RowID{ChunkID{0u}, 0u}, RowID{ChunkID{1u}, 0u},
+                          RowID{ChunkID{0u}, 1u}, RowID{ChunkID{1u}, 1u}};
+
+  auto reference_column = std::make_unique<ReferenceColumn>(table_with_null_chunked, ColumnID{0u},
+                                                            std::make_shared<PosList>(std::move(pos_list)));
+
+  auto iterable = ReferenceColumnIterable<int>{*reference_column};
+
+  auto values = std::vector<std::optional<int>>{};
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  iterable.for_each([&](const auto& value) {
+    values.emplace_back(value.is_null() ? std::nullopt : std::optional<int>{value.value()});
+    chunk_offsets.emplace_back(value.chunk_offset());
+  });
+
+  const auto expected_values = std::vector<std::optional<int>>{1234, std::nullopt, 12345, std::nullopt, 123, 1234};
+  EXPECT_EQ(values, expected_values);
+  EXPECT_EQ(chunk_offsets, (std::vector<ChunkOffset>{0u, 1u, 2u, 3u, 4u, 5u}));
+}
+
 TEST_F(IterablesTest, ValueColumnIteratorForEach) {
   auto chunk = table->get_chunk(ChunkID{0u});
 
@@ -0,0 +1,90 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/mvcc_columns.hpp"
+
+namespace opossum {
+
+class StorageMvccColumnsTest : public BaseTest {};
+
+TEST_F(StorageMvccColumnsTest, Compact) {
+  auto mvcc_columns = MvccColumns{1'000};
+  mvcc_columns.set_end_cid(10, 5u);
+  const auto dense_memory_usage = mvcc_columns.estimate_memory_usage();
+
+  mvcc_columns.compact();
+
+  ASSERT_TRUE(mvcc_columns.is_compact());
+  EXPECT_EQ(mvcc_columns.size(), 1'000u);
+  EXPECT_LT(mvcc_columns.estimate_memory_usage(), dense_memory_usage / 10);
+
+  EXPECT_EQ(mvcc_columns.begin_cid(10), 0u);
+  EXPECT_EQ(mvcc_columns.end_cid(10), 5u);
+  EXPECT_EQ(mvcc_columns.end_cid(11), MvccColumns::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_columns.tid(10), 0u);
+}
+
+TEST_F(StorageMvccColumnsTest, DeleteFromCompactColumns) {
+  auto mvcc_columns = MvccColumns{1'000};
+  mvcc_columns.compact();
+  ASSERT_TRUE(mvcc_columns.is_compact());
+
+  // Unlocking does not need the TIDs, locking does
+  mvcc_columns.set_tid(20, 0u);
+  const auto memory_usage_without_tids = mvcc_columns.estimate_memory_usage();
+
+  EXPECT_TRUE(mvcc_columns.compare_exchange_tid(20, 0u, 7u));
+  EXPECT_FALSE(mvcc_columns.compare_exchange_tid(20, 0u, 8u));
+  EXPECT_GT(mvcc_columns.estimate_memory_usage(), memory_usage_without_tids);
+  EXPECT_EQ(mvcc_columns.tid(20), 7u);
+  EXPECT_EQ(mvcc_columns.tid(21), 0u);
+
+  mvcc_columns.set_end_cid(20, 3u);
+  EXPECT_EQ(mvcc_columns.end_cid(20), 3u);
+  EXPECT_EQ(mvcc_columns.end_cid(21), MvccColumns::MAX_COMMIT_ID);
+}
+
+TEST_F(StorageMvccColumnsTest, CompactKeepsLockedRows) {
+  auto mvcc_columns = MvccColumns{10};
+  mvcc_columns.set_tid(3, 42u);
+  mvcc_columns.compact();
+
+  ASSERT_TRUE(mvcc_columns.is_compact());
+  EXPECT_EQ(mvcc_columns.tid(3), 42u);
+  EXPECT_EQ(mvcc_columns.tid(4), 0u);
+}
+
+TEST_F(StorageMvccColumnsTest, NoCompactionOfRowsWithDifferentBeginCids) {
+  auto mvcc_columns = MvccColumns{10};
+  mvcc_columns.set_begin_cid(3, 2u);
+  mvcc_columns.compact();
+  EXPECT_FALSE(mvcc_columns.is_compact());
+
+  // Uncommitted rows
+  auto uncommitted_mvcc_columns = MvccColumns{0};
+  uncommitted_mvcc_columns.grow_by(10, MvccColumns::MAX_COMMIT_ID);
+  uncommitted_mvcc_columns.compact();
+  EXPECT_FALSE(uncommitted_mvcc_columns.is_compact());
+  EXPECT_EQ(uncommitted_mvcc_columns.begin_cid(3), MvccColumns::MAX_COMMIT_ID);
+}
+
+TEST_F(StorageMvccColumnsTest, SetEndCidUpdatesVisibilitySummary) {
+  // Rows of MvccColumns(size) are committed at CID 0 and have not been counted as uncommitted
+  auto mvcc_columns = MvccColumns{10};
+  EXPECT_TRUE(mvcc_columns.all_rows_visible(0u));
+
+  mvcc_columns.set_end_cid(3, 2u);
+  EXPECT_FALSE(mvcc_columns.all_rows_visible(5u));
+
+  auto compact_mvcc_columns = MvccColumns{10};
+  compact_mvcc_columns.compact();
+  ASSERT_TRUE(compact_mvcc_columns.is_compact());
+  EXPECT_TRUE(compact_mvcc_columns.all_rows_visible(0u));
+
+  compact_mvcc_columns.set_end_cid(3, 2u);
+  EXPECT_FALSE(compact_mvcc_columns.all_rows_visible(5u));
+}
+
+}  // namespace opossum
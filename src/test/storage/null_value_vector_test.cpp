@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/value_column/null_value_vector.hpp"
+
+namespace opossum {
+
+class StorageNullValueVectorTest : public BaseTest {};
+
+TEST_F(StorageNullValueVectorTest, SetAndGet) {
+  auto null_values = NullValueVector{130u};
+  EXPECT_EQ(null_values.size(), 130u);
+  EXPECT_EQ(null_values.word_count(), 3u);
+  EXPECT_FALSE(null_values.contains_nulls());
+  EXPECT_TRUE(std::none_of(null_values.cbegin(), null_values.cend(), [](const auto is_null) { return is_null; }));
+
+  null_values.set(1u, true);
+  null_values.set(64u, true);
+  null_values.set(129u, true);
+  EXPECT_TRUE(null_values.contains_nulls());
+
+  EXPECT_FALSE(null_values[0]);
+  EXPECT_TRUE(null_values[1]);
+  EXPECT_TRUE(null_values[64]);
+  EXPECT_TRUE(null_values[129]);
+  EXPECT_EQ(std::count(null_values.cbegin(), null_values.cend(), true), 3);
+
+  EXPECT_EQ(null_values.word(0u), NullValueVector::Word{0b10});
+  EXPECT_EQ(null_values.word(1u), NullValueVector::Word{0b1});
+  EXPECT_EQ(null_values.word(2u), NullValueVector::Word{0b10});
+
+  null_values.set(1u, false);
+  EXPECT_FALSE(null_values[1]);
+  EXPECT_EQ(null_values.word(0u), NullValueVector::Word{0});
+}
+
+TEST_F(StorageNullValueVectorTest, Grow) {
+  auto null_values = NullValueVector{};
+  for (auto index = 0u; index < 100u; ++index) {
+    null_values.push_back(index % 3 == 0);
+  }
+  EXPECT_EQ(null_values.size(), 100u);
+  EXPECT_EQ(null_values.word_count(), 2u);
+  EXPECT_TRUE(null_values[99]);
+  EXPECT_FALSE(null_values[98]);
+
+  null_values.resize(200u);
+  EXPECT_EQ(null_values.size(), 200u);
+  EXPECT_EQ(null_values.word_count(), 4u);
+  EXPECT_FALSE(null_values[199]);
+  EXPECT_EQ(null_values.word(3u), NullValueVector::Word{0});
+
+  EXPECT_THROW(null_values.resize(10u), std::logic_error);
+}
+
+TEST_F(StorageNullValueVectorTest, Construction) {
+  const auto bools = std::vector<bool>{true, true, false, false, false};
+
+  const auto null_values = NullValueVector{bools};
+  EXPECT_EQ(std::vector<bool>(null_values.cbegin(), null_values.cend()), bools);
+  EXPECT_EQ(std::vector<bool>(null_values.crbegin(), null_values.crend()),
+            (std::vector<bool>{false, false, false, true, true}));
+
+  const auto copied_null_values = NullValueVector{null_values, PolymorphicAllocator<NullValueVector::Word>{}};
+  EXPECT_EQ(std::vector<bool>(copied_null_values.cbegin(), copied_null_values.cend()), bools);
+  EXPECT_TRUE(copied_null_values.contains_nulls());
+
+  EXPECT_FALSE((NullValueVector{std::vector<bool>(3u, false)}.contains_nulls()));
+}
+
+}  // namespace opossum
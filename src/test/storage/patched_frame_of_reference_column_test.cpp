@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/column_encoding_utils.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/patched_frame_of_reference_column.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StoragePatchedFrameOfReferenceColumnTest : public BaseTestWithParam<VectorCompressionType> {
+ protected:
+  template <typename T>
+  void _expect_equal_values(const PatchedFrameOfReferenceColumn<T>& column, const ValueColumn<T>& value_column) {
+    ASSERT_EQ(column.size(), value_column.size());
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_column.size(); ++chunk_offset) {
+      EXPECT_EQ(column.get_typed_value(chunk_offset), value_column.get_typed_value(chunk_offset));
+    }
+
+    auto iterable = create_iterable_from_column(column);
+    auto chunk_offset = ChunkOffset{0};
+    iterable.for_each([&](const auto& value) {
+      EXPECT_EQ(value.is_null(), variant_is_null(value_column[chunk_offset]));
+      if (!value.is_null()) EXPECT_EQ(value.value(), value_column.values()[chunk_offset]);
+      ++chunk_offset;
+    });
+    EXPECT_EQ(chunk_offset, value_column.size());
+  }
+};
+
+INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, StoragePatchedFrameOfReferenceColumnTest,
+                        ::testing::Values(VectorCompressionType::SimdBp128,
+                                          VectorCompressionType::FixedSizeByteAligned));
+
+TEST_P(StoragePatchedFrameOfReferenceColumnTest, OutliersBecomeExceptions) {
+  auto value_column = std::make_shared<ValueColumn<int32_t>>(true);
+  for (auto row = 0; row < 5'000; ++row) {
+    if (row % 1'000 == 17) {
+      value_column->append(row % 2 == 0 ? std::numeric_limits<int32_t>::max() : std::numeric_limits<int32_t>::min());
+    } else {
+      value_column->append(row % 10 == 3 ? NULL_VALUE : AllTypeVariant{1'000 + row % 100});
+    }
+  }
+
+  const auto encoded_column =
+      encode_column(EncodingType::PatchedFrameOfReference, DataType::Int, value_column, GetParam());
+  const auto pfor_column = std::dynamic_pointer_cast<const PatchedFrameOfReferenceColumn<int32_t>>(encoded_column);
+  ASSERT_NE(pfor_column, nullptr);
+
+  // Neither the outliers nor the NULLs widen the frames
+  EXPECT_EQ(pfor_column->exception_offsets().size(), 5u);
+  EXPECT_EQ(pfor_column->exception_offsets()[0], 17u);
+  EXPECT_EQ(pfor_column->block_references()[0], 1'000);
+
+  _expect_equal_values(*pfor_column, *value_column);
+}
+
+TEST_P(StoragePatchedFrameOfReferenceColumnTest, EncodesWideInt64Ranges) {
+  // The range of each block exceeds uint32_t, which FrameOfReference cannot encode
+  auto value_column = std::make_shared<ValueColumn<int64_t>>(false);
+  for (auto row = int64_t{0}; row < 3'000; ++row) {
+    value_column->append(row % 500 == 0 ? -row * (int64_t{1} << 40) : int64_t{1'600'000'000'000'000} + row * 1'000);
+  }
+
+  const auto encoded_column =
+      encode_column(EncodingType::PatchedFrameOfReference, DataType::Long, value_column, GetParam());
+  const auto pfor_column = std::dynamic_pointer_cast<const PatchedFrameOfReferenceColumn<int64_t>>(encoded_column);
+  ASSERT_NE(pfor_column, nullptr);
+
+  EXPECT_EQ(pfor_column->exception_offsets().size(), 6u);
+  EXPECT_LT(pfor_column->estimate_memory_usage(), value_column->estimate_memory_usage());
+
+  _expect_equal_values(*pfor_column, *value_column);
+}
+
+}  // namespace opossum
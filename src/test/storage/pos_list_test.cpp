@@ -0,0 +1,181 @@
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/column_iterables/chunk_offset_mapping.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class PosListTest : public BaseTest {
+ protected:
+  // ChunkOffsetMapping has no comparison operator, so it is converted into pairs for comparison
+  std::map<ChunkID, std::vector<std::pair<ChunkOffset, ChunkOffset>>> split(const PosList& pos_list) {
+    auto result = std::map<ChunkID, std::vector<std::pair<ChunkOffset, ChunkOffset>>>{};
+    for (const auto& [chunk_id, mapped_chunk_offsets] : split_pos_list_by_chunk_id(pos_list)) {
+      for (const auto& mapping : mapped_chunk_offsets) {
+        result[chunk_id].emplace_back(mapping.into_referencing, mapping.into_referenced);
+      }
+    }
+    return result;
+  }
+};
+
+TEST_F(PosListTest, ChunkRange) {
+  const auto pos_list = PosList::chunk_range(ChunkID{3}, 2u, 5u);
+
+  EXPECT_TRUE(pos_list.is_chunk_range());
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_TRUE(pos_list.grouped_by_chunk());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{3});
+
+  ASSERT_EQ(pos_list.size(), 3u);
+  EXPECT_EQ(pos_list[0], (RowID{ChunkID{3}, 2u}));
+  EXPECT_EQ(pos_list.at(2), (RowID{ChunkID{3}, 4u}));
+  EXPECT_EQ(pos_list.back(), (RowID{ChunkID{3}, 4u}));
+  EXPECT_EQ(pos_list.begin()->chunk_offset, 2u);
+  EXPECT_EQ(pos_list.end() - pos_list.begin(), 3);
+
+  const auto expected_pos_list = PosList{{ChunkID{3}, 2u}, {ChunkID{3}, 3u}, {ChunkID{3}, 4u}};
+  EXPECT_EQ(pos_list, expected_pos_list);
+  EXPECT_FALSE(expected_pos_list.is_chunk_range());
+
+  const auto copied_pos_list = PosList{pos_list.begin() + 1, pos_list.end()};
+  EXPECT_EQ(copied_pos_list, (PosList{{ChunkID{3}, 3u}, {ChunkID{3}, 4u}}));
+
+  EXPECT_TRUE(PosList::chunk_range(ChunkID{3}, 2u, 2u).empty());
+}
+
+TEST_F(PosListTest, Guarantees) {
+  auto pos_list = PosList{{ChunkID{1}, 2u}, {ChunkID{1}, 0u}};
+  EXPECT_FALSE(pos_list.references_single_chunk());
+  EXPECT_FALSE(pos_list.grouped_by_chunk());
+
+  pos_list.guarantee_single_chunk();
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_TRUE(pos_list.grouped_by_chunk());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{1});
+
+  auto grouped_pos_list = PosList{{ChunkID{1}, 2u}, {ChunkID{1}, 0u}, {ChunkID{0}, 0u}, NULL_ROW_ID};
+  grouped_pos_list.guarantee_grouped_by_chunk();
+  EXPECT_FALSE(grouped_pos_list.references_single_chunk());
+  EXPECT_TRUE(grouped_pos_list.grouped_by_chunk());
+
+  auto filtered_pos_list = PosList{{ChunkID{1}, 0u}};
+  filtered_pos_list.inherit_guarantees(pos_list);
+  EXPECT_TRUE(filtered_pos_list.references_single_chunk());
+
+  // Copies keep the guarantees
+  const auto copied_pos_list = filtered_pos_list;
+  EXPECT_TRUE(copied_pos_list.references_single_chunk());
+}
+
+TEST_F(PosListTest, ModifyingDropsGuarantees) {
+  auto pos_list = PosList{{ChunkID{1}, 2u}, {ChunkID{1}, 0u}};
+  pos_list.guarantee_single_chunk();
+
+  // Writing to and removing positions keeps the guarantees
+  pos_list[0].chunk_offset = 1u;
+  pos_list.pop_back();
+  EXPECT_TRUE(pos_list.references_single_chunk());
+
+  pos_list.emplace_back(ChunkID{0}, 0u);
+  EXPECT_FALSE(pos_list.references_single_chunk());
+  EXPECT_FALSE(pos_list.grouped_by_chunk());
+
+  pos_list.guarantee_grouped_by_chunk();
+  pos_list.push_back(RowID{ChunkID{1}, 3u});
+  EXPECT_FALSE(pos_list.grouped_by_chunk());
+
+  pos_list.assign({RowID{ChunkID{2}, 0u}, RowID{ChunkID{2}, 1u}});
+  pos_list.guarantee_single_chunk();
+  pos_list.assign({RowID{ChunkID{2}, 0u}, RowID{ChunkID{1}, 0u}});
+  EXPECT_FALSE(pos_list.references_single_chunk());
+}
+
+TEST_F(PosListTest, MaterializeChunkRanges) {
+  auto pos_list = PosList::chunk_range(ChunkID{3}, 2u, 4u);
+  pos_list.materialize();
+  EXPECT_FALSE(pos_list.is_chunk_range());
+  EXPECT_TRUE(pos_list.references_single_chunk());
+
+  pos_list.push_back(RowID{ChunkID{1}, 0u});
+
+  EXPECT_FALSE(pos_list.is_chunk_range());
+  EXPECT_FALSE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list, (PosList{{ChunkID{3}, 2u}, {ChunkID{3}, 3u}, {ChunkID{1}, 0u}}));
+
+  // Copies of chunk ranges are chunk ranges as well, until they are modified
+  const auto chunk_range = PosList::chunk_range(ChunkID{3}, 2u, 4u);
+  auto copied_pos_list = chunk_range;
+  EXPECT_TRUE(copied_pos_list.is_chunk_range());
+  copied_pos_list.materialize();
+  for (auto& row_id : copied_pos_list) {
+    row_id.chunk_id = ChunkID{5};
+  }
+
+  EXPECT_FALSE(copied_pos_list.is_chunk_range());
+  EXPECT_TRUE(copied_pos_list.references_single_chunk());
+  EXPECT_EQ(copied_pos_list, (PosList{{ChunkID{5}, 2u}, {ChunkID{5}, 3u}}));
+  EXPECT_EQ(chunk_range.front(), (RowID{ChunkID{3}, 2u}));
+
+  auto cleared_pos_list = PosList::chunk_range(ChunkID{3}, 2u, 4u);
+  cleared_pos_list.clear();
+  EXPECT_FALSE(cleared_pos_list.is_chunk_range());
+  EXPECT_TRUE(cleared_pos_list.empty());
+}
+
+TEST_F(PosListTest, ModifyingChunkRangesRequiresMaterialize) {
+  if (!IS_DEBUG) return;
+
+  auto pos_list = PosList::chunk_range(ChunkID{3}, 2u, 4u);
+  EXPECT_THROW(pos_list[0], std::logic_error);
+  EXPECT_THROW(pos_list.begin(), std::logic_error);
+  EXPECT_THROW(pos_list.push_back(RowID{ChunkID{1}, 0u}), std::logic_error);
+  EXPECT_TRUE(pos_list.is_chunk_range());
+
+  // Read-only access does not require materialization
+  EXPECT_EQ(std::as_const(pos_list)[0], (RowID{ChunkID{3}, 2u}));
+}
+
+TEST_F(PosListTest, GuaranteesAreChecked) {
+  if (!IS_DEBUG) return;
+
+  auto pos_list = PosList{{ChunkID{1}, 2u}, {ChunkID{0}, 0u}, {ChunkID{1}, 0u}};
+  EXPECT_THROW(pos_list.guarantee_single_chunk(), std::logic_error);
+  EXPECT_THROW(pos_list.guarantee_grouped_by_chunk(), std::logic_error);
+
+  auto pos_list_with_null = PosList{{ChunkID{1}, 2u}, NULL_ROW_ID};
+  EXPECT_THROW(pos_list_with_null.guarantee_single_chunk(), std::logic_error);
+}
+
+TEST_F(PosListTest, SplitByChunkID) {
+  using Split = std::map<ChunkID, std::vector<std::pair<ChunkOffset, ChunkOffset>>>;
+  const auto expected_split = Split{{ChunkID{1}, {{0u, 2u}, {1u, 0u}}}, {ChunkID{0}, {{2u, 0u}, {4u, 1u}}}};
+
+  auto pos_list = PosList{{ChunkID{1}, 2u}, {ChunkID{1}, 0u}, {ChunkID{0}, 0u}, NULL_ROW_ID, {ChunkID{0}, 1u}};
+  EXPECT_EQ(split(pos_list), expected_split);
+
+  pos_list.guarantee_grouped_by_chunk();
+  EXPECT_EQ(split(pos_list), expected_split);
+
+  // NULLs before, between, and after the runs of a grouped PosList
+  auto grouped_pos_list =
+      PosList{NULL_ROW_ID, {ChunkID{2}, 1u}, NULL_ROW_ID, {ChunkID{1}, 0u}, {ChunkID{1}, 3u}, NULL_ROW_ID};
+  grouped_pos_list.guarantee_grouped_by_chunk();
+  EXPECT_EQ(split(grouped_pos_list), (Split{{ChunkID{2}, {{1u, 1u}}}, {ChunkID{1}, {{3u, 0u}, {4u, 3u}}}}));
+
+  auto single_chunk_pos_list = PosList{{ChunkID{1}, 2u}, {ChunkID{1}, 0u}};
+  single_chunk_pos_list.guarantee_single_chunk();
+  EXPECT_EQ(split(single_chunk_pos_list), (Split{{ChunkID{1}, {{0u, 2u}, {1u, 0u}}}}));
+
+  EXPECT_EQ(split(PosList::chunk_range(ChunkID{2}, 1u, 3u)), (Split{{ChunkID{2}, {{0u, 1u}, {1u, 2u}}}}));
+  EXPECT_TRUE(split_pos_list_by_chunk_id(PosList::chunk_range(ChunkID{2}, 1u, 1u)).empty());
+}
+
+}  // namespace opossum
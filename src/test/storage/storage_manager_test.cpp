@@ -56,6 +56,18 @@ TEST_F(StorageManagerTest, DropTable) {
   EXPECT_THROW(sm.drop_table("first_table"), std::exception);
 }
 
+TEST_F(StorageManagerTest, TablesSnapshot) {
+  auto& sm = StorageManager::get();
+  const auto tables = sm.tables();
+
+  // Dropping a table does not affect the snapshot
+  sm.drop_table("first_table");
+  ASSERT_EQ(tables.size(), 2u);
+  EXPECT_EQ(tables.begin()->first, "first_table");
+  EXPECT_EQ(tables.at("second_table"), sm.get_table("second_table"));
+  EXPECT_EQ(sm.tables().size(), 1u);
+}
+
 TEST_F(StorageManagerTest, DoesNotHaveTable) {
   auto& sm = StorageManager::get();
   EXPECT_EQ(sm.has_table("third_table"), false);
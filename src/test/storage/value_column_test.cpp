@@ -1,10 +1,13 @@
 #include <limits>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "../lib/storage/create_iterable_from_column.hpp"
 #include "../lib/storage/value_column.hpp"
 
 namespace opossum {
@@ -96,6 +99,55 @@ TEST_F(StorageValueColumnTest, ArraySubscriptOperatorReturnsNullValue) {
   EXPECT_TRUE(variant_is_null(vc_double[0]));
 }
 
+TEST_F(StorageValueColumnTest, NullValuesSpanningMultipleWords) {
+  auto vc_nullable = ValueColumn<int>{true};
+  for (auto value = 0; value < 200; ++value) {
+    vc_nullable.append(value % 63 == 1 ? NULL_VALUE : AllTypeVariant{value});
+  }
+  EXPECT_TRUE(vc_nullable.contains_nulls());
+
+  auto visited_count = 0u;
+  create_iterable_from_column(vc_nullable).for_each([&](const auto& value) {
+    EXPECT_EQ(value.is_null(), value.chunk_offset() % 63 == 1);
+    if (!value.is_null()) {
+      EXPECT_EQ(value.value(), static_cast<int>(value.chunk_offset()));
+    }
+    ++visited_count;
+  });
+  EXPECT_EQ(visited_count, 200u);
+
+  // A nullable column without any NULLs is iterated without looking at the null values
+  auto vc_without_nulls = ValueColumn<int>{true};
+  vc_without_nulls.append(1);
+  EXPECT_TRUE(vc_without_nulls.is_nullable());
+  EXPECT_FALSE(vc_without_nulls.contains_nulls());
+  EXPECT_FALSE(vc_int.contains_nulls());
+}
+
+TEST_F(StorageValueColumnTest, CopyToContiguous) {
+  auto vc_nullable = ValueColumn<int>{true};
+  vc_nullable.append(1);
+  vc_nullable.append(NULL_VALUE);
+  vc_nullable.append(3);
+  EXPECT_FALSE(vc_nullable.is_contiguous());
+
+  const auto copy = std::dynamic_pointer_cast<ValueColumn<int>>(vc_nullable.copy_to_contiguous());
+  ASSERT_NE(copy, nullptr);
+  EXPECT_TRUE(copy->is_contiguous());
+  EXPECT_EQ(copy->size(), 3u);
+  EXPECT_EQ(copy->contiguous_values().size(), 3u);
+  EXPECT_EQ(copy->get(0), 1);
+  EXPECT_TRUE(variant_is_null((*copy)[1]));
+  EXPECT_EQ(copy->get_typed_value(2), 3);
+  EXPECT_THROW(copy->append(4), std::logic_error);
+
+  auto values = std::vector<std::optional<int>>{};
+  create_iterable_from_column(*copy).for_each([&](const auto& value) {
+    values.emplace_back(value.is_null() ? std::nullopt : std::optional<int>{value.value()});
+  });
+  EXPECT_EQ(values, (std::vector<std::optional<int>>{1, std::nullopt, 3}));
+}
+
 TEST_F(StorageValueColumnTest, MemoryUsageEstimation) {
   /**
    * WARNING: Since it's hard to assert what constitutes a correct "estimation", this just tests basic sanity of the
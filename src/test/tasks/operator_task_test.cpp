@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -5,14 +6,22 @@
 
 #include "../base_test.hpp"
 
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
 
+using namespace opossum::expression_functional;  // NOLINT
+
 namespace opossum {
 
 class OperatorTaskTest : public BaseTest {
@@ -117,4 +126,126 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(scan_b->get_output(), nullptr);
   EXPECT_EQ(scan_c->get_output(), nullptr);
 }
+
+TEST_F(OperatorTaskTest, MorselDrivenPipeline) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < _test_table_a->chunk_count(); ++chunk_id) {
+    auto mvcc_columns = _test_table_a->get_chunk(chunk_id)->get_scoped_mvcc_columns_lock();
+    std::fill(mvcc_columns->begin_cids.begin(), mvcc_columns->begin_cids.end(), 0u);
+  }
+  // Hide the row with a = 12345
+  _test_table_a->get_chunk(ChunkID{0})->get_scoped_mvcc_columns_lock()->end_cids[0] = 2u;
+
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto validate = std::make_shared<Validate>(gt);
+  auto scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::LessThan, 100'000);
+  const auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  const auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto projection = std::make_shared<Projection>(scan, expression_vector(b, add_(a, 1)));
+
+  const auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  // Execute a copy operator at a time for comparison
+  const auto reference_projection = projection->deep_copy();
+  reference_projection->set_transaction_context_recursively(context);
+  for (auto& task : OperatorTask::make_tasks_from_operator(reference_projection, CleanupTemporaries::Yes)) {
+    task->schedule();
+  }
+
+  projection->set_transaction_context_recursively(context);
+  auto tasks = OperatorTask::make_tasks_from_operator(projection, CleanupTemporaries::Yes, ExecutionMode::MorselDriven);
+
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt);
+  EXPECT_TRUE(tasks[0]->pipeline().empty());
+  EXPECT_EQ(tasks[1]->get_operator(), projection);
+  const auto expected_pipeline = std::vector<std::shared_ptr<AbstractOperator>>{validate, scan, projection};
+  EXPECT_EQ(tasks[1]->pipeline(), expected_pipeline);
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), reference_projection->get_output());
+  EXPECT_EQ(projection->get_output()->row_count(), 2u);
+
+  // The operators within the pipeline are never executed on their own
+  EXPECT_EQ(validate->get_output(), nullptr);
+  EXPECT_EQ(scan->get_output(), nullptr);
+  EXPECT_EQ(gt->get_output(), nullptr);
+}
+
+TEST_F(OperatorTaskTest, MorselDrivenPipelineReferencesInputTable) {
+  auto gt = std::make_shared<GetTable>("table_b");
+  auto scan_a = std::make_shared<TableScan>(gt, ColumnID{0}, PredicateCondition::Equals, 12345);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::GreaterThan, 457.0f);
+
+  // As if the chunk was handled by an IndexScan. Excluded chunks only work at the bottom of a pipeline.
+  scan_a->set_excluded_chunk_ids({ChunkID{1}});
+
+  auto tasks = OperatorTask::make_tasks_from_operator(scan_b, CleanupTemporaries::No, ExecutionMode::MorselDriven);
+  ASSERT_EQ(tasks.size(), 2u);
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  // Only the second row of the first chunk matches. It must be referenced by its position in the stored table.
+  const auto output = scan_b->get_output();
+  ASSERT_EQ(output->chunk_count(), 1u);
+  const auto reference_column =
+      std::dynamic_pointer_cast<const ReferenceColumn>(output->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  ASSERT_TRUE(reference_column);
+  EXPECT_EQ(reference_column->referenced_table(), _test_table_b);
+  EXPECT_EQ(*reference_column->pos_list(), PosList({RowID{ChunkID{0}, ChunkOffset{1}}}));
+}
+
+TEST_F(OperatorTaskTest, MorselDrivenPipelineRemapsChunkRanges) {
+  // No row of the first chunk matches, all rows of the second one do. For the latter, the TableScan outputs a chunk
+  // range, which the Projection forwards.
+  auto gt = std::make_shared<GetTable>("table_b");
+  auto scan = std::make_shared<TableScan>(gt, ColumnID{0}, PredicateCondition::LessThan, 1'000);
+  const auto a = PQPColumnExpression::from_table(*_test_table_b, "a");
+  const auto b = PQPColumnExpression::from_table(*_test_table_b, "b");
+  auto projection = std::make_shared<Projection>(scan, expression_vector(b, a));
+
+  const auto reference_projection = projection->deep_copy();
+  for (auto& task : OperatorTask::make_tasks_from_operator(reference_projection, CleanupTemporaries::Yes)) {
+    task->schedule();
+  }
+
+  auto tasks = OperatorTask::make_tasks_from_operator(projection, CleanupTemporaries::No, ExecutionMode::MorselDriven);
+  ASSERT_EQ(tasks.size(), 2u);
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), reference_projection->get_output());
+
+  const auto output = projection->get_output();
+  ASSERT_EQ(output->chunk_count(), 1u);
+  const auto reference_column =
+      std::dynamic_pointer_cast<const ReferenceColumn>(output->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  ASSERT_TRUE(reference_column);
+  EXPECT_EQ(reference_column->referenced_table(), _test_table_b);
+  EXPECT_TRUE(reference_column->pos_list()->is_chunk_range());
+  EXPECT_EQ(*reference_column->pos_list(),
+            PosList({RowID{ChunkID{1}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{1}}}));
+}
+
+TEST_F(OperatorTaskTest, MorselDrivenDiamondShapeIsNotFused) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto scan_a = std::make_shared<TableScan>(gt_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::LessThan, 1000);
+  auto scan_c = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::GreaterThan, 2000);
+  auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_c);
+
+  // scan_a is consumed by two operators and thus materialized
+  auto tasks =
+      OperatorTask::make_tasks_from_operator(union_positions, CleanupTemporaries::Yes, ExecutionMode::MorselDriven);
+
+  ASSERT_EQ(tasks.size(), 5u);
+  for (const auto& task : tasks) {
+    EXPECT_TRUE(task->pipeline().empty());
+  }
+}
+
 }  // namespace opossum